@@ -0,0 +1,121 @@
+#include <bellman_ford/algorithm.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <length_edge_data.hpp>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+namespace {
+using graph_type
+    = gp::DirectedGraph<int, std::nullptr_t, int, gp::LengthEdgeData<int>>;
+using edge_type = graph_type::edge_type;
+
+// Large enough for everything a single iteration allocates, so the arena
+// never has to go upstream.
+constexpr std::size_t arenaSize{64U * 1024U * 1024U};
+
+void fill(graph_type& graph, int vertexCount)
+{
+    std::mt19937                       engine{42};
+    std::uniform_int_distribution<int> vertices{0, vertexCount - 1};
+    std::uniform_int_distribution<int> lengths{1, 100};
+
+    for (int v{0}; v < vertexCount; ++v) { (void)graph.addVertex(v, nullptr); }
+
+    for (int e{0}; e < (vertexCount * 4); ++e) {
+        (void)graph.addEdge(
+            e,
+            vertices(engine),
+            vertices(engine),
+            gp::LengthEdgeData<int>{lengths(engine)});
+    }
+}
+
+int edgeLength(const edge_type& edge) { return edge.data().edgeLength(); }
+
+struct Dijkstra {
+    auto operator()(
+        const graph_type&          graph,
+        std::pmr::memory_resource* resource) const
+    {
+        return gp::dijkstra::algorithm(graph, 0, &edgeLength, resource);
+    }
+};
+
+struct BellmanFord {
+    auto operator()(
+        const graph_type&          graph,
+        std::pmr::memory_resource* resource) const
+    {
+        return gp::bellman_ford::algorithm(graph, 0, &edgeLength, resource);
+    }
+};
+
+// Runs a query repeatedly, allocating with new and delete.
+template<typename Query>
+void queryMalloc(benchmark::State& state)
+{
+    graph_type graph{};
+    fill(graph, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            Query{}(graph, std::pmr::new_delete_resource()));
+    }
+}
+
+// Runs a query repeatedly, allocating from an arena that is released after
+// every query.
+template<typename Query>
+void queryArena(benchmark::State& state)
+{
+    graph_type graph{};
+    fill(graph, static_cast<int>(state.range(0)));
+
+    std::vector<std::byte>              buffer(arenaSize);
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Query{}(graph, &resource));
+        resource.release();
+    }
+}
+
+// Builds a graph and runs a query on it, allocating with new and delete.
+void buildAndQueryMalloc(benchmark::State& state)
+{
+    for (auto _ : state) {
+        graph_type graph{std::pmr::new_delete_resource()};
+        fill(graph, static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(
+            Dijkstra{}(graph, std::pmr::new_delete_resource()));
+    }
+}
+
+// Builds a graph and runs a query on it in an arena, releasing both at once.
+void buildAndQueryArena(benchmark::State& state)
+{
+    std::vector<std::byte>              buffer(arenaSize);
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+
+    for (auto _ : state) {
+        {
+            graph_type graph{&resource};
+            fill(graph, static_cast<int>(state.range(0)));
+            benchmark::DoNotOptimize(Dijkstra{}(graph, &resource));
+        }
+
+        resource.release();
+    }
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(queryMalloc, Dijkstra)->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(queryArena, Dijkstra)->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(queryMalloc, BellmanFord)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE(queryArena, BellmanFord)->Arg(256)->Arg(1024);
+BENCHMARK(buildAndQueryMalloc)->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK(buildAndQueryArena)->Arg(256)->Arg(1024)->Arg(4096);
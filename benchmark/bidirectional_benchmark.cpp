@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/bidirectional.hpp>
+#include <dijkstra/point_to_point.hpp>
+#include <dijkstra/search_statistics.hpp>
+#include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
+#include <memory_resource>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+using graph_type = gp::lattice::graph_type;
+using edge_type  = graph_type::edge_type;
+
+std::size_t lengthOf(const edge_type& edge) { return edge.data(); }
+
+// A road-like side x side lattice with lengths between 50 and 150, where
+// one street in ten is missing.
+graph_type roadNetwork(int side)
+{
+    return gp::lattice::createGraph(
+        side, std::uniform_int_distribution<std::size_t>{50, 150}, 0.1);
+}
+
+// Random pairs of vertices, most of them far apart.
+std::vector<std::pair<int, int>> queries(int side)
+{
+    std::mt19937                       engine{7};
+    std::uniform_int_distribution<int> vertices{0, (side * side) - 1};
+    std::vector<std::pair<int, int>>   result{};
+
+    for (int i{0}; i < 16; ++i) {
+        result.emplace_back(vertices(engine), vertices(engine));
+    }
+
+    return result;
+}
+
+void pointToPoint(benchmark::State& state, bool isBidirectional)
+{
+    const int side{static_cast<int>(state.range(0))};
+
+    const graph_type                       graph{roadNetwork(side)};
+    const std::vector<std::pair<int, int>> pairs{queries(side)};
+    std::size_t                            settled{0};
+    std::int64_t                           queryCount{0};
+
+    for (auto _ : state) {
+        for (const std::pair<int, int>& pair : pairs) {
+            gp::dijkstra::SearchStatistics statistics{0};
+            const auto                     paths{
+                isBidirectional
+                    ? gp::dijkstra::bidirectional(
+                        graph,
+                        pair.first,
+                        pair.second,
+                        &lengthOf,
+                        std::pmr::get_default_resource(),
+                        &statistics)
+                    : gp::dijkstra::pointToPoint(
+                        graph,
+                        pair.first,
+                        pair.second,
+                        &lengthOf,
+                        std::pmr::get_default_resource(),
+                        gp::dijkstra::QueueKind::IndexedHeap,
+                        &statistics)};
+            benchmark::DoNotOptimize(paths.distanceTo(pair.second));
+            settled += statistics.settledVertices;
+            ++queryCount;
+        }
+    }
+
+    state.SetItemsProcessed(queryCount);
+    state.counters["settledPerQuery"] = benchmark::Counter(
+        static_cast<double>(settled) / static_cast<double>(queryCount));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(pointToPoint, unidirectional, false)
+    ->Arg(256)
+    ->Arg(512)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(pointToPoint, bidirectional, true)
+    ->Arg(256)
+    ->Arg(512)
+    ->Unit(benchmark::kMillisecond);
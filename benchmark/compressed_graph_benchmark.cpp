@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <compact_graph.hpp>
+#include <compressed_graph.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
+#include <random>
+#include <vertex_order.hpp>
+
+namespace {
+using graph_type = gp::lattice::graph_type;
+using edge_type  = graph_type::edge_type;
+
+std::size_t lengthOf(const edge_type& edge) { return edge.data(); }
+
+// A road-like side x side lattice with lengths of up to 99, reordered for
+// locality.
+graph_type roadLikeGraph(int side)
+{
+    graph_type graph{gp::lattice::createGraph(
+        side, std::uniform_int_distribution<std::size_t>{1, 99})};
+    (void)gp::reorder(graph, gp::VertexOrder::ReverseCuthillMcKee);
+    return graph;
+}
+
+void decodeCompressedGraph(benchmark::State& state)
+{
+    const graph_type                graph{
+        roadLikeGraph(static_cast<int>(state.range(0)))};
+    const gp::CompressedGraph<int> compressed{graph, &lengthOf};
+
+    for (auto _ : state) {
+        std::size_t sum{0};
+
+        for (std::uint32_t v{0}; v < compressed.vertexCount(); ++v) {
+            for (const auto& neighbor : compressed.outboundEdges(v)) {
+                sum += neighbor.target + neighbor.length;
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(compressed.edgeCount()));
+    // The edge storage alone and everything, including the identifiers.
+    state.counters["edge_bytes_per_edge"]
+        = static_cast<double>(compressed.memoryUsage().edges)
+          / static_cast<double>(compressed.edgeCount());
+    state.counters["total_bytes_per_edge"]
+        = static_cast<double>(compressed.memoryUsage().total())
+          / static_cast<double>(compressed.edgeCount());
+}
+
+void scanCompactGraph(benchmark::State& state)
+{
+    const graph_type graph{roadLikeGraph(static_cast<int>(state.range(0)))};
+    const gp::CompactGraph<int, int, std::size_t> compact{graph};
+
+    for (auto _ : state) {
+        std::size_t sum{0};
+
+        for (std::uint32_t v{0}; v < compact.vertexCount(); ++v) {
+            for (const auto edge : compact.outboundEdges(v)) {
+                sum += edge.targetIndex() + edge.data();
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(compact.edgeCount()));
+    // The edge storage alone and everything, including the identifiers.
+    state.counters["edge_bytes_per_edge"]
+        = static_cast<double>(compact.memoryUsage().edges)
+          / static_cast<double>(compact.edgeCount());
+    state.counters["total_bytes_per_edge"]
+        = static_cast<double>(compact.memoryUsage().total())
+          / static_cast<double>(compact.edgeCount());
+}
+} // namespace
+
+BENCHMARK(decodeCompressedGraph)->Arg(256)->Arg(1024);
+BENCHMARK(scanCompactGraph)->Arg(256)->Arg(1024);
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/algorithm.hpp>
+#include <dijkstra/multi_source.hpp>
+#include <dijkstra/point_to_point.hpp>
+#include <dijkstra/workspace.hpp>
+#include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+namespace {
+using graph_type = gp::lattice::graph_type;
+using edge_type  = graph_type::edge_type;
+
+std::size_t lengthOf(const edge_type& edge) { return edge.data(); }
+
+// A side x side lattice with random lengths.
+graph_type lattice(int side)
+{
+    return gp::lattice::createGraph(
+        side, std::uniform_int_distribution<std::size_t>{1, 100});
+}
+
+void dijkstraWithQueue(
+    benchmark::State&        state,
+    gp::dijkstra::QueueKind queueKind)
+{
+    const graph_type graph{lattice(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        const auto paths{gp::dijkstra::algorithm(
+            graph, 0, &lengthOf, std::pmr::get_default_resource(), queueKind)};
+        benchmark::DoNotOptimize(&paths);
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(graph.vertexCount()));
+}
+
+// Queries a target a few steps away from the source in the middle of the
+// lattice, with the full search and with the one stopping at the target.
+void nearbyTarget(benchmark::State& state, bool stopAtTarget)
+{
+    const int        side{static_cast<int>(state.range(0))};
+    const graph_type graph{lattice(side)};
+    const int        source{(side / 2) * (side + 1)};
+    const int        target{source + (3 * side) + 3};
+
+    for (auto _ : state) {
+        const auto paths{
+            stopAtTarget
+                ? gp::dijkstra::pointToPoint(graph, source, target, &lengthOf)
+                : gp::dijkstra::algorithm(graph, source, &lengthOf)};
+        benchmark::DoNotOptimize(paths.distanceTo(target));
+    }
+}
+
+// Same as the pointToPoint variant of nearbyTarget, but keeps the working
+// state between the queries, so only the explored region gets reset.
+void nearbyTargetWithWorkspace(
+    benchmark::State&        state,
+    gp::dijkstra::QueueKind queueKind)
+{
+    const int        side{static_cast<int>(state.range(0))};
+    const graph_type graph{lattice(side)};
+    const int        source{(side / 2) * (side + 1)};
+    const int        target{source + (3 * side) + 3};
+    gp::dijkstra::Workspace<graph_type::index_type> workspace{};
+
+    for (auto _ : state) {
+        const auto paths{gp::dijkstra::pointToPoint(
+            graph, source, target, &lengthOf, workspace, queueKind)};
+        benchmark::DoNotOptimize(paths.distanceTo(target));
+    }
+}
+
+// Computes the distance to the nearest of eight depots, with one search per
+// depot and with a single search from all of them.
+void nearestDepot(benchmark::State& state, bool singlePass)
+{
+    const int        side{static_cast<int>(state.range(0))};
+    const graph_type graph{lattice(side)};
+    std::vector<int> depots{};
+
+    for (int i{0}; i < 8; ++i) {
+        depots.push_back((i * side * side) / 8 + (i * side) / 8);
+    }
+
+    for (auto _ : state) {
+        if (singlePass) {
+            const auto nearest{
+                gp::dijkstra::nearestSources(graph, depots, &lengthOf)};
+            benchmark::DoNotOptimize(nearest.distanceTo(0));
+            continue;
+        }
+
+        std::vector<std::size_t> nearest(graph.vertexCount(), SIZE_MAX);
+
+        for (int depot : depots) {
+            const auto paths{gp::dijkstra::algorithm(graph, depot, &lengthOf)};
+
+            for (int v{0}; v < side * side; ++v) {
+                nearest[v] = std::min(nearest[v], paths.distanceTo(v));
+            }
+        }
+
+        benchmark::DoNotOptimize(nearest.data());
+    }
+}
+} // namespace
+
+BENCHMARK_CAPTURE(
+    dijkstraWithQueue,
+    indexedHeap,
+    gp::dijkstra::QueueKind::IndexedHeap)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(512);
+BENCHMARK_CAPTURE(
+    dijkstraWithQueue,
+    sortedVector,
+    gp::dijkstra::QueueKind::SortedVector)
+    ->Arg(32)
+    ->Arg(128);
+BENCHMARK_CAPTURE(
+    dijkstraWithQueue,
+    dialBuckets,
+    gp::dijkstra::QueueKind::DialBuckets)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(512);
+BENCHMARK_CAPTURE(
+    dijkstraWithQueue,
+    radixHeap,
+    gp::dijkstra::QueueKind::RadixHeap)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(512);
+BENCHMARK_CAPTURE(nearbyTarget, fullSearch, false)->Arg(128)->Arg(512);
+BENCHMARK_CAPTURE(nearbyTarget, pointToPoint, true)->Arg(128)->Arg(512);
+BENCHMARK_CAPTURE(
+    nearbyTargetWithWorkspace,
+    indexedHeap,
+    gp::dijkstra::QueueKind::IndexedHeap)
+    ->Arg(128)
+    ->Arg(512);
+BENCHMARK_CAPTURE(
+    nearbyTargetWithWorkspace,
+    dialBuckets,
+    gp::dijkstra::QueueKind::DialBuckets)
+    ->Arg(128)
+    ->Arg(512);
+BENCHMARK_CAPTURE(nearestDepot, searchPerDepot, false)->Arg(128)->Arg(512);
+BENCHMARK_CAPTURE(nearestDepot, multiSource, true)->Arg(128)->Arg(512);
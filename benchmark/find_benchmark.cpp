@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <directed_graph.hpp>
+#include <execution>
+#include <random>
+#include <vector>
+
+namespace {
+struct Position {
+    double latitude;
+    double longitude;
+};
+
+using graph_type = gp::DirectedGraph<int, std::nullptr_t, int, Position>;
+using column_graph_type
+    = gp::DirectedGraph<int, std::nullptr_t, int, Position, gp::ColumnStorage>;
+
+template<typename Graph>
+Graph randomGraph(int edgeCount)
+{
+    constexpr int                          vertexCount{1024};
+    std::mt19937                           engine{42};
+    std::uniform_int_distribution<int>     vertices{0, vertexCount - 1};
+    std::uniform_real_distribution<double> latitudes{-90.0, 90.0};
+    std::uniform_real_distribution<double> longitudes{-180.0, 180.0};
+    Graph                                  graph{};
+
+    for (int v{0}; v < vertexCount; ++v) { (void)graph.addVertex(v, nullptr); }
+
+    for (int e{0}; e < edgeCount; ++e) {
+        (void)graph.addEdge(
+            e,
+            vertices(engine),
+            vertices(engine),
+            Position{latitudes(engine), longitudes(engine)});
+    }
+
+    return graph;
+}
+
+// An expensive predicate: is the edge within 1000 km of Amsterdam?
+template<typename EdgeReference>
+bool isNearAmsterdam(const EdgeReference& edge)
+{
+    constexpr double radians{3.14159265358979323846 / 180.0};
+    constexpr double latitude{52.37 * radians};
+    constexpr double longitude{4.90 * radians};
+    constexpr double earthRadius{6371.0};
+
+    const double otherLatitude{edge.data().latitude * radians};
+    const double otherLongitude{edge.data().longitude * radians};
+    const double a{
+        std::pow(std::sin((otherLatitude - latitude) / 2.0), 2.0)
+        + (std::cos(latitude) * std::cos(otherLatitude)
+           * std::pow(std::sin((otherLongitude - longitude) / 2.0), 2.0))};
+
+    return (2.0 * earthRadius * std::asin(std::sqrt(a))) < 1000.0;
+}
+
+template<typename Graph>
+void findEdgesSequential(benchmark::State& state)
+{
+    const Graph graph{randomGraph<Graph>(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        const std::vector<typename Graph::edge_pointer> result{graph.findEdges(
+            &isNearAmsterdam<typename Graph::edge_reference>)};
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+
+template<typename ExecutionPolicy>
+void findEdgesWithPolicy(
+    benchmark::State&      state,
+    const ExecutionPolicy& policy)
+{
+    const graph_type graph{
+        randomGraph<graph_type>(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        const std::vector<const graph_type::edge_type*> result{graph.findEdges(
+            policy, &isNearAmsterdam<graph_type::edge_reference>)};
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(findEdgesSequential, graph_type)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+// Reads the data column only, instead of striding over whole edges.
+BENCHMARK_TEMPLATE(findEdgesSequential, column_graph_type)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_CAPTURE(findEdgesWithPolicy, seq, std::execution::seq)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_CAPTURE(findEdgesWithPolicy, par, std::execution::par)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
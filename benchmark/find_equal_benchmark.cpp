@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <compact_graph.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <directed_graph.hpp>
+#include <find_equal.hpp>
+#include <pl/algo/ranged_algorithms.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+using graph_type = gp::DirectedGraph<int, std::nullptr_t, int, std::nullptr_t>;
+
+std::vector<std::uint32_t> randomTargets(std::size_t size)
+{
+    std::mt19937                                 engine{42};
+    std::uniform_int_distribution<std::uint32_t> distribution{0, 1023};
+    std::vector<std::uint32_t>                   result(size);
+
+    for (std::uint32_t& target : result) { target = distribution(engine); }
+
+    return result;
+}
+
+graph_type randomGraph(int vertexCount, int edgeCount)
+{
+    std::mt19937                       engine{42};
+    std::uniform_int_distribution<int> distribution{0, vertexCount - 1};
+    graph_type                         graph{};
+
+    for (int v{0}; v < vertexCount; ++v) { (void)graph.addVertex(v, nullptr); }
+
+    for (int e{0}; e < edgeCount; ++e) {
+        (void)graph.addEdge(
+            e, distribution(engine), distribution(engine), nullptr);
+    }
+
+    return graph;
+}
+
+// The scalar scan, one pl::algo::find_if step per match.
+void findIf(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> targets{
+        randomTargets(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state) {
+        std::vector<std::uint32_t> result{};
+
+        for (auto it{pl::algo::find_if(
+                 targets, [](std::uint32_t target) { return target == 7; })};
+             it != targets.end();
+             it = std::find(it + 1, targets.end(), 7U)) {
+            result.push_back(static_cast<std::uint32_t>(it - targets.begin()));
+        }
+
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void findEqual(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> targets{
+        randomTargets(static_cast<std::size_t>(state.range(0)))};
+
+    for (auto _ : state) {
+        const std::vector<std::uint32_t> result{gp::findEqual(targets, 7)};
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void directedGraphFindEdges(benchmark::State& state)
+{
+    const graph_type graph{randomGraph(1024, static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        const std::vector<const graph_type::edge_type*> result{graph.findEdges(
+            [](const graph_type::edge_type& edge) {
+                return edge.target() == 7;
+            })};
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void compactGraphFindEdgesByTarget(benchmark::State& state)
+{
+    const gp::CompactGraph graph{
+        randomGraph(1024, static_cast<int>(state.range(0)))};
+    const std::uint32_t target{*graph.index(7)};
+
+    for (auto _ : state) {
+        const std::vector<std::uint32_t> result{
+            graph.findEdgesByTarget(target)};
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(findIf)->Range(1 << 10, 1 << 20);
+BENCHMARK(findEqual)->Range(1 << 10, 1 << 20);
+BENCHMARK(directedGraphFindEdges)->Range(1 << 10, 1 << 18);
+BENCHMARK(compactGraphFindEdgesByTarget)->Range(1 << 10, 1 << 18);
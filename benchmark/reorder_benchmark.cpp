@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
+#include <random>
+#include <vector>
+#include <vertex_order.hpp>
+
+namespace {
+using graph_type = gp::lattice::graph_type;
+using edge_type  = graph_type::edge_type;
+
+graph_type createGraph(benchmark::State& state)
+{
+    // Shuffled like a graph loaded from a file.
+    graph_type graph{gp::lattice::createGraph(
+        static_cast<int>(state.range(0)),
+        std::uniform_int_distribution<std::size_t>{1, 100},
+        0.0,
+        gp::lattice::InsertionOrder::Shuffled)};
+
+    if (state.range(1) >= 0) {
+        (void)gp::reorder(graph, static_cast<gp::VertexOrder>(state.range(1)));
+    }
+
+    return graph;
+}
+
+// Breadth first search over the dense indices, returns the amount of
+// vertices reached.
+std::size_t breadthFirstSearch(const graph_type& graph, std::uint32_t source)
+{
+    std::vector<bool>          visited(graph.vertexIndexBound(), false);
+    std::vector<std::uint32_t> queue{source};
+    visited[source] = true;
+
+    for (std::size_t head{0}; head < queue.size(); ++head) {
+        const auto range{graph.outboundEdgeRangeAt(queue[head])};
+
+        for (auto it{range.begin()}; it != range.end(); ++it) {
+            const std::uint32_t target{graph.endpointIndices(it).target};
+
+            if (not visited[target]) {
+                visited[target] = true;
+                queue.push_back(target);
+            }
+        }
+    }
+
+    return queue.size();
+}
+
+void dijkstraAfterReordering(benchmark::State& state)
+{
+    const graph_type graph{createGraph(state)};
+
+    for (auto _ : state) {
+        const auto paths{gp::dijkstra::algorithm(
+            graph, 0, [](const edge_type& edge) { return edge.data(); })};
+        benchmark::DoNotOptimize(&paths);
+    }
+}
+
+void breadthFirstSearchAfterReordering(benchmark::State& state)
+{
+    const graph_type    graph{createGraph(state)};
+    const std::uint32_t source{*graph.vertexIndex(0)};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(breadthFirstSearch(graph, source));
+    }
+}
+
+// The second argument is the gp::VertexOrder applied, -1 for none.
+void addOrders(benchmark::internal::Benchmark* benchmark, int side)
+{
+    benchmark->Args({side, -1});
+
+    for (gp::VertexOrder order : {gp::VertexOrder::BreadthFirst,
+                                  gp::VertexOrder::ReverseCuthillMcKee,
+                                  gp::VertexOrder::DegreeDescending}) {
+        benchmark->Args({side, static_cast<int>(order)});
+    }
+}
+} // namespace
+
+BENCHMARK(dijkstraAfterReordering)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) {
+        addOrders(benchmark, 128);
+        addOrders(benchmark, 512);
+    });
+BENCHMARK(breadthFirstSearchAfterReordering)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) {
+        addOrders(benchmark, 128);
+        addOrders(benchmark, 512);
+    });
@@ -4,78 +4,62 @@
  **/
 #ifndef INCG_GP_A_STAR_ALGORITHM_HPP
 #define INCG_GP_A_STAR_ALGORITHM_HPP
+#include "../compact_graph.hpp"   // gp::CompactGraph
 #include "../contains.hpp"        // gp::contains
 #include "../directed_graph.hpp"  // gp::DirectedGraph
+#include "../graph_snapshot.hpp"  // gp::GraphSnapshot
 #include "expand.hpp"             // gp::a_star::expand
 #include "generate_new_paths.hpp" // gp::a_star::generateNewPaths
 #include "insert.hpp"             // gp::a_star::insert
 #include "path.hpp"               // gp::a_star::Path
 #include <ciso646>                // not, or
+#include <memory_resource>        // std::pmr::memory_resource
 #include <pl/invoke.hpp>          // pl::invoke
-#include <vector>                 // std::vector
+#include <utility>                // std::move
+#include <vector>                 // std::vector, std::pmr::vector
 
 namespace gp {
 namespace a_star {
+namespace detail {
 /*!
- * \brief Implementation of the A* algorithm.
- * \tparam VertexIdentifier The type of the objects used to identify vertices in
- *                          the graph.
- * \tparam VertexData The type of the data that is stored on the
- *                    vertices in the graph.
- * \tparam EdgeIdentifier The type of the objects used to
- *                        identify edges in the graph.
- * \tparam EdgeData The type of the data that is
- *                  stored on the edges in the graph.
- * \tparam IsGoal The type of the unary predicate invoked to determine whether
- *                a given VertexIdentifier identifies the goal vertex.
- * \tparam Heuristic The type of the unary invocable invoked to get
- *                   the heuristic (h) value for a given VertexIdentifier.
- * \param graph The directed graph that shall be operated on.
- * \param startVertices The vertices considered to be the start vertices.
- * \param isGoal Unary predicate to determine whether a given VertexIdentifier
- *               identifies the goal vertex.
- * \param heuristic Unary invocable to get the heuristic (h) value of the given
- *                  VertexIdentifier
- * \param useClosedList Whether a closed list shall be used. (Defaults to true)
- *                      Must be set to false to work with non-monotonic
- *                      heuristics.
- * \param return The shortest Path that was found.
+ * \brief Implementation of the A* algorithm shared by all graph types.
+ * \tparam Graph The type of the graph, must be usable with
+ *               gp::a_star::expand.
+ * \see gp::a_star::algorithm
  **/
 template<
+    typename Graph,
     typename VertexIdentifier,
-    typename VertexData,
-    typename EdgeIdentifier,
-    typename EdgeData,
     typename IsGoal,
     typename Heuristic>
 Path<VertexIdentifier> algorithm(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                                  graph,
+    const Graph&                  graph,
     std::vector<VertexIdentifier> startVertices,
     IsGoal                        isGoal,
     Heuristic                     heuristic,
-    bool                          useClosedList = true)
+    bool                          useClosedList,
+    std::pmr::memory_resource*    resource)
 {
     // Contains vertices already visited
-    std::vector<VertexIdentifier> closedList{};
+    std::pmr::vector<VertexIdentifier> closedList{resource};
 
     // The open list. Contains paths of which the last vertex isn't yet
     // expanded. This list must always remain sorted by the f values of the
     // paths (f = g + h) in ascending order.
-    std::vector<Path<VertexIdentifier>> openList{};
+    // The paths inserted are copied into the memory resource.
+    std::pmr::vector<Path<VertexIdentifier>> openList{resource};
 
     for (const VertexIdentifier& vertex : startVertices) {
-        insert(
-            heuristic,
-            openList,
-            Path<VertexIdentifier>{
-                IdentifierWithCost<VertexIdentifier>{vertex, 0}});
+        Path<VertexIdentifier> path{resource};
+        path.append(vertex, 0);
+        insert(heuristic, openList, path);
     }
 
     // As long as we have paths to explace
     while (not openList.empty()) {
         // Grab the lowes f path
-        const Path<VertexIdentifier> currentPath{openList.front()};
+        Path<VertexIdentifier> currentPath{
+            std::move(openList.front()), resource};
 
         // Delete it from the open list
         openList.erase(openList.begin());
@@ -96,8 +80,8 @@ Path<VertexIdentifier> algorithm(
                 expand(lastVertexOfPath, graph)};
 
             // Generate new paths with the neighbors.
-            const std::vector<Path<VertexIdentifier>> newPaths{
-                generateNewPaths(currentPath, neighbors)};
+            const std::pmr::vector<Path<VertexIdentifier>> newPaths{
+                generateNewPaths(currentPath, neighbors, resource)};
 
             for (const Path<VertexIdentifier>& path : newPaths) {
                 insert(heuristic, openList, path);
@@ -108,7 +92,163 @@ Path<VertexIdentifier> algorithm(
     // If the open list is empty but we still haven't found a solution
     // -> there is no solution
     // -> return the empty path.
-    return Path<VertexIdentifier>{};
+    return Path<VertexIdentifier>{resource};
+}
+} // namespace detail
+
+/*!
+ * \brief Implementation of the A* algorithm.
+ * \tparam VertexIdentifier The type of the objects used to identify vertices in
+ *                          the graph.
+ * \tparam VertexData The type of the data that is stored on the
+ *                    vertices in the graph.
+ * \tparam EdgeIdentifier The type of the objects used to
+ *                        identify edges in the graph.
+ * \tparam EdgeData The type of the data that is
+ *                  stored on the edges in the graph.
+ * \tparam IsGoal The type of the unary predicate invoked to determine whether
+ *                a given VertexIdentifier identifies the goal vertex.
+ * \tparam Heuristic The type of the unary invocable invoked to get
+ *                   the heuristic (h) value for a given VertexIdentifier.
+ * \param graph The directed graph that shall be operated on.
+ * \param startVertices The vertices considered to be the start vertices.
+ * \param isGoal Unary predicate to determine whether a given VertexIdentifier
+ *               identifies the goal vertex.
+ * \param heuristic Unary invocable to get the heuristic (h) value of the given
+ *                  VertexIdentifier
+ * \param useClosedList Whether a closed list shall be used. (Defaults to true)
+ *                      Must be set to false to work with non-monotonic
+ *                      heuristics.
+ * \param resource The memory resource to allocate the working state and the
+ *                 path returned from.
+ * \param return The shortest Path that was found.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename IsGoal,
+    typename Heuristic>
+Path<VertexIdentifier> algorithm(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                  graph,
+    std::vector<VertexIdentifier> startVertices,
+    IsGoal                        isGoal,
+    Heuristic                     heuristic,
+    bool                          useClosedList = true,
+    std::pmr::memory_resource*    resource = std::pmr::get_default_resource())
+{
+    return detail::algorithm(
+        graph,
+        std::move(startVertices),
+        std::move(isGoal),
+        std::move(heuristic),
+        useClosedList,
+        resource);
+}
+
+/*!
+ * \brief Implementation of the A* algorithm for snapshots of directed graphs.
+ * \tparam VertexIdentifier The type of the objects used to identify vertices in
+ *                          the graph.
+ * \tparam VertexData The type of the data that is stored on the
+ *                    vertices in the graph.
+ * \tparam EdgeIdentifier The type of the objects used to
+ *                        identify edges in the graph.
+ * \tparam EdgeData The type of the data that is
+ *                  stored on the edges in the graph.
+ * \tparam IsGoal The type of the unary predicate invoked to determine whether
+ *                a given VertexIdentifier identifies the goal vertex.
+ * \tparam Heuristic The type of the unary invocable invoked to get
+ *                   the heuristic (h) value for a given VertexIdentifier.
+ * \param snapshot The snapshot that shall be operated on, as taken from a
+ *                 ConcurrentDirectedGraph.
+ * \param startVertices The vertices considered to be the start vertices.
+ * \param isGoal Unary predicate to determine whether a given VertexIdentifier
+ *               identifies the goal vertex.
+ * \param heuristic Unary invocable to get the heuristic (h) value of the given
+ *                  VertexIdentifier
+ * \param useClosedList Whether a closed list shall be used. (Defaults to true)
+ *                      Must be set to false to work with non-monotonic
+ *                      heuristics.
+ * \param resource The memory resource to allocate the working state and the
+ *                 path returned from.
+ * \param return The shortest Path that was found.
+ * \note Sees the version of the graph of the snapshot, regardless of what is
+ *       published while the algorithm runs.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename IsGoal,
+    typename Heuristic>
+Path<VertexIdentifier> algorithm(
+    const GraphSnapshot<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                  snapshot,
+    std::vector<VertexIdentifier> startVertices,
+    IsGoal                        isGoal,
+    Heuristic                     heuristic,
+    bool                          useClosedList = true,
+    std::pmr::memory_resource*    resource = std::pmr::get_default_resource())
+{
+    return detail::algorithm(
+        snapshot.graph(),
+        std::move(startVertices),
+        std::move(isGoal),
+        std::move(heuristic),
+        useClosedList,
+        resource);
+}
+
+/*!
+ * \brief Implementation of the A* algorithm for CompactGraphs.
+ * \tparam VertexIdentifier The type of the objects used to identify vertices in
+ *                          the graph.
+ * \tparam EdgeIdentifier The type of the objects used to
+ *                        identify edges in the graph.
+ * \tparam EdgeData The type of the data that is
+ *                  stored on the edges in the graph.
+ * \tparam IsGoal The type of the unary predicate invoked to determine whether
+ *                a given VertexIdentifier identifies the goal vertex.
+ * \tparam Heuristic The type of the unary invocable invoked to get
+ *                   the heuristic (h) value for a given VertexIdentifier.
+ * \param graph The graph that shall be operated on.
+ * \param startVertices The vertices considered to be the start vertices.
+ * \param isGoal Unary predicate to determine whether a given VertexIdentifier
+ *               identifies the goal vertex.
+ * \param heuristic Unary invocable to get the heuristic (h) value of the given
+ *                  VertexIdentifier
+ * \param useClosedList Whether a closed list shall be used. (Defaults to true)
+ *                      Must be set to false to work with non-monotonic
+ *                      heuristics.
+ * \param resource The memory resource to allocate the working state and the
+ *                 path returned from.
+ * \param return The shortest Path that was found.
+ **/
+template<
+    typename VertexIdentifier,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename IsGoal,
+    typename Heuristic>
+Path<VertexIdentifier> algorithm(
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph,
+    std::vector<VertexIdentifier> startVertices,
+    IsGoal                        isGoal,
+    Heuristic                     heuristic,
+    bool                          useClosedList = true,
+    std::pmr::memory_resource*    resource = std::pmr::get_default_resource())
+{
+    return detail::algorithm(
+        graph,
+        std::move(startVertices),
+        std::move(isGoal),
+        std::move(heuristic),
+        useClosedList,
+        resource);
 }
 } // namespace a_star
 } // namespace gp
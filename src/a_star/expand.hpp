@@ -1,7 +1,10 @@
 #ifndef INCG_GP_A_STAR_EXPAND_HPP
 #define INCG_GP_A_STAR_EXPAND_HPP
+#include "../compact_graph.hpp"     // gp::CompactGraph
 #include "../directed_graph.hpp"    // gp::DirectedGraph
 #include "identifier_with_cost.hpp" // gp::a_star::IdentifierWithCost
+#include <ciso646>                  // not
+#include <tl/optional.hpp>          // tl::optional
 #include <vector>                   // std::vector
 
 namespace gp {
@@ -36,15 +39,54 @@ std::vector<IdentifierWithCost<VertexIdentifier>> expand(
     using edge_type = typename graph_type::edge_type;
 
     // Get the outbound edges of the vertex.
-    const std::vector<const edge_type*> edges{
-        graph.outboundEdges(vertexToExpand)};
+    const typename graph_type::edge_range edges{
+        graph.outboundEdgeRange(vertexToExpand)};
 
     std::vector<IdentifierWithCost<VertexIdentifier>> result{};
+    result.reserve(edges.size());
 
     // Put the neighboring (and reachable) vertex associated with the edges
     // length in the result vector.
-    for (const edge_type* edge : edges) {
-        result.emplace_back(edge->target(), edge->data().edgeLength());
+    for (const edge_type& edge : edges) {
+        result.emplace_back(edge.target(), edge.data().edgeLength());
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Expands a given vertex of a CompactGraph.
+ * \tparam VertexIdentifier The type used to identify vertices.
+ * \tparam EdgeIdentifier The type used to identify edges.
+ * \tparam EdgeData The data that is stored on edges.
+ * \param vertexToExpand The vertex that shall be expanded.
+ * \param graph The graph that the vertex is in.
+ * \return A vector containing vertex identifiers associated with
+ *         the g value (edge length) of the edge used to get to it
+ *         from 'vertexToExpand'. Empty if 'vertexToExpand' is not
+ *         a vertex of 'graph'.
+ * \note The EdgeData shall have a nullary edgeLength member function
+ *       returning the length (g value) of the edge.
+ **/
+template<typename VertexIdentifier, typename EdgeIdentifier, typename EdgeData>
+std::vector<IdentifierWithCost<VertexIdentifier>> expand(
+    const VertexIdentifier& vertexToExpand,
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph)
+{
+    using graph_type = CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+    using index_type = typename graph_type::index_type;
+
+    std::vector<IdentifierWithCost<VertexIdentifier>> result{};
+
+    const tl::optional<index_type> index{graph.index(vertexToExpand)};
+
+    if (not index.has_value()) { return result; }
+
+    const typename graph_type::EdgeRange edges{graph.outboundEdges(*index)};
+    result.reserve(edges.size());
+
+    for (const typename graph_type::EdgeReference edge : edges) {
+        result.emplace_back(edge.target(), edge.data().edgeLength());
     }
 
     return result;
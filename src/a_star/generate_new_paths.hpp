@@ -1,7 +1,8 @@
 #ifndef INCG_GP_A_STAR_GENERATE_NEW_PATHS_HPP
 #define INCG_GP_A_STAR_GENERATE_NEW_PATHS_HPP
-#include "path.hpp" // gp::a_star::Path
-#include <vector>   // std::vector
+#include "path.hpp"        // gp::a_star::Path
+#include <memory_resource> // std::pmr::memory_resource
+#include <vector>          // std::vector, std::pmr::vector
 
 namespace gp {
 namespace a_star {
@@ -11,21 +12,23 @@ namespace a_star {
  * \param oldPath The old path that shall be used to generate new paths.
  * \param neighbors The neighboring vertices previously acquired through
  *                  vertex expansion.
+ * \param resource The memory resource to allocate the new paths from.
  * \return A vector of the newly generated Paths.
  **/
 template<typename VertexIdentifier>
-std::vector<Path<VertexIdentifier>> generateNewPaths(
+std::pmr::vector<Path<VertexIdentifier>> generateNewPaths(
     const Path<VertexIdentifier>&                            oldPath,
-    const std::vector<IdentifierWithCost<VertexIdentifier>>& neighbors)
+    const std::vector<IdentifierWithCost<VertexIdentifier>>& neighbors,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
 {
-    std::vector<Path<VertexIdentifier>> result{};
+    std::pmr::vector<Path<VertexIdentifier>> result{resource};
+    result.reserve(neighbors.size());
 
     for (const auto& e : neighbors) {
-        Path<VertexIdentifier> copy{oldPath};
+        // Constructs a copy of oldPath using the memory resource of result.
+        Path<VertexIdentifier>& copy{result.emplace_back(oldPath)};
 
         copy.append(e);
-
-        result.push_back(copy);
     }
 
     return result;
@@ -11,6 +11,7 @@ namespace a_star {
  * \brief Insertion routine used by the A* algorithm.
  * \tparam Heuristic The type of the unary heuristic invocable.
  * \tparam VertexIdentifier The type used to identity vertices in the graph.
+ * \tparam Allocator The allocator type of the open list.
  * \param heuristic The unary heuristic invocable. Shall return a heuristic
  *                  value of type std::size_t for a given VertexIdentifier.
  * \param openList The open list to instert into.
@@ -21,16 +22,16 @@ namespace a_star {
  *          second lowest and so on. If the sorting criterion is not met
  *          then the behaviour of the program is undefined!
  **/
-template<typename Heuristic, typename VertexIdentifier>
+template<typename Heuristic, typename VertexIdentifier, typename Allocator>
 void insert(
-    const Heuristic&                     heuristic,
-    std::vector<Path<VertexIdentifier>>& openList,
-    const Path<VertexIdentifier>&        pathToInsert)
+    const Heuristic&                                heuristic,
+    std::vector<Path<VertexIdentifier>, Allocator>& openList,
+    const Path<VertexIdentifier>&                   pathToInsert)
 {
     // Find the first position at which 'pathToInsert' may be inserted
     // without violating the sorting criterion.
-    const typename std::vector<Path<VertexIdentifier>>::const_iterator
-        insertionPoint{pl::algo::lower_bound(
+    const typename std::vector<Path<VertexIdentifier>, Allocator>::
+        const_iterator insertionPoint{pl::algo::lower_bound(
             openList,
             pathToInsert,
             [&heuristic](const auto& lhs, const auto& rhs) {
@@ -8,10 +8,12 @@
 #include <cstddef>                       // std::size_t
 #include <initializer_list>              // std::initializer_list
 #include <iterator>                      // std::back_inserter
+#include <memory_resource>               // std::pmr::polymorphic_allocator
 #include <ostream>                       // std::ostream
 #include <pl/algo/ranged_algorithms.hpp> // pl::algo::transform
 #include <stdexcept>                     // std::out_of_range
-#include <vector>                        // std::vector
+#include <utility>                       // std::move
+#include <vector>                        // std::vector, std::pmr::vector
 
 namespace gp {
 namespace a_star {
@@ -19,6 +21,9 @@ namespace a_star {
  * \brief Type for a path of vertices through a graph.
  * \tparam VertexIdentifier the type of the kind of object used to identify a
  *                          vertex.
+ * \note Allocator-aware: a path allocates from the memory resource it was
+ *       created with and containers using polymorphic allocators pass their
+ *       memory resource on to the paths they store.
  **/
 template<typename VertexIdentifier>
 class Path {
@@ -26,11 +31,13 @@ public:
     // Type aliases
     // See https://www.youtube.com/watch?v=qGxuD9o4GDA for the usage of the
     // typename keyword in this context.
-    typedef Path                                              this_type;
-    typedef std::vector<IdentifierWithCost<VertexIdentifier>> container_type;
-    typedef typename container_type::iterator                 iterator;
-    typedef typename container_type::const_iterator           const_iterator;
-    typedef typename container_type::reverse_iterator         reverse_iterator;
+    typedef Path this_type;
+    typedef std::pmr::vector<IdentifierWithCost<VertexIdentifier>>
+        container_type;
+    typedef typename container_type::allocator_type   allocator_type;
+    typedef typename container_type::iterator         iterator;
+    typedef typename container_type::const_iterator   const_iterator;
+    typedef typename container_type::reverse_iterator reverse_iterator;
     typedef
         typename container_type::const_reverse_iterator const_reverse_iterator;
 
@@ -39,6 +46,38 @@ public:
      **/
     Path() = default;
 
+    /*!
+     * \brief Creates an empty path that allocates from a given memory
+     *        resource.
+     * \param allocator The allocator to use.
+     **/
+    explicit Path(const allocator_type& allocator) : m_vector{allocator} {}
+
+    /*!
+     * \brief Copies a path into a given memory resource.
+     * \param other The path to copy.
+     * \param allocator The allocator the copy uses.
+     **/
+    Path(const this_type& other, const allocator_type& allocator)
+        : m_vector{other.m_vector, allocator}
+    {
+    }
+
+    /*!
+     * \brief Moves a path into a given memory resource.
+     * \param other The path to move from.
+     * \param allocator The allocator the new path uses.
+     **/
+    Path(this_type&& other, const allocator_type& allocator)
+        : m_vector{std::move(other.m_vector), allocator}
+    {
+    }
+
+    Path(const this_type&) = default;
+    Path(this_type&&)      = default;
+    this_type& operator=(const this_type&) = default;
+    this_type& operator=(this_type&&) = default;
+
     /*!
      * \brief Initializer list constructor.
      * \param initList The initializer_list to initialize with.
@@ -48,6 +87,15 @@ public:
     {
     }
 
+    /*!
+     * \brief Read accessor for the allocator.
+     * \return The allocator this path allocates with.
+     **/
+    allocator_type get_allocator() const noexcept
+    {
+        return m_vector.get_allocator();
+    }
+
     /*!
      * \brief Returns an iterator to the first element of the path.
      * \return Iterator to the first element.
@@ -306,8 +354,7 @@ public:
     }
 
 private:
-    std::vector<IdentifierWithCost<VertexIdentifier>>
-        m_vector; /*!< The underlying container */
+    container_type m_vector; /*!< The underlying container */
 };
 
 /*!
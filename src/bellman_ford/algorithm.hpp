@@ -1,16 +1,20 @@
 #ifndef INCG_GP_BELLMAN_FORD_ALGORITHM_HPP
 #define INCG_GP_BELLMAN_FORD_ALGORITHM_HPP
+#include "../compact_graph.hpp"  // gp::CompactGraph
 #include "../directed_graph.hpp" // gp::DirectedGraph
+#include "../graph_snapshot.hpp" // gp::GraphSnapshot
 #include "../shortest_paths.hpp" // gp::ShortestPaths
+#include <ciso646>               // not
 #include <cstddef>               // std::size_t
 #include <cstdint>               // std::int32_t, std::int64_t, INT32_MAX
+#include <memory_resource>       // std::pmr::memory_resource, ...
 #include <pl/except.hpp>         // PL_THROW_WITH_SOURCE_INFO
 #include <pl/invoke.hpp>         // pl::invoke
 #include <pl/size_t.hpp>   // pl::literals::integer_literals::operator""_zu
 #include <stdexcept>       // std::runtime_error
 #include <tl/optional.hpp> // tl::optional, tl::nullopt
-#include <unordered_map>   // std::unordered_map
 #include <utility>         // std::move
+#include <vector>          // std::vector
 
 namespace gp {
 namespace bellman_ford {
@@ -22,14 +26,22 @@ namespace bellman_ford {
  * \tparam EdgeIdentifier The type of the unique identifiers used for the
  *                        edges in the directed graph to operate on.
  * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam EdgeStorage The edge storage policy of the directed graph.
  * \tparam LengthInvocable The type of the unary length invocable.
  * \param graph The directed graph to find the shortest paths in.
  * \param source The source vertex to use.
- * \param lengthInvocable The unary length invocable object.
+ * \param lengthInvocable The unary length invocable object. Is invoked with
+ *                        the edge_reference objects of the directed graph.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
  * \return The result object containing the shortest paths from 'source'
  *         to all the vertices in the graph given.
  * \note Unlike Dijkstra's algorithm this algorithm supports negatively
  *       weighted edges.
+ * \note The length of every edge is computed once. The passes over the
+ *       edges only read the adjacency lists, the endpoint index column of the
+ *       graph and those lengths. With ColumnStorage computing the lengths
+ *       only reads the columns the length invocable reads.
  * \throws std::runtime_error if there is a negative-weight cycle in the graph
  *                            given.
  **/
@@ -38,48 +50,239 @@ template<
     typename VertexData,
     typename EdgeIdentifier,
     typename EdgeData,
+    typename EdgeStorage,
     typename LengthInvocable>
 ShortestPaths<VertexIdentifier, std::int32_t> algorithm(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                     graph,
-    VertexIdentifier source,
-    LengthInvocable  lengthInvocable)
+    const DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData,
+        EdgeStorage>&          graph,
+    VertexIdentifier           source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
 {
     using namespace pl::literals::integer_literals;
 
-    using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using vertex_type = typename graph_type::vertex_type;
-    using edge_type   = typename graph_type::edge_type;
+    using graph_type = DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData,
+        EdgeStorage>;
+    using index_type          = typename graph_type::index_type;
+    using edge_range          = typename graph_type::edge_range;
+    using shortest_paths_type = ShortestPaths<VertexIdentifier, std::int32_t>;
+
+    constexpr std::int32_t infinity{INT32_MAX};
+
+    // The working state is kept in vectors indexed by the dense vertex
+    // indices of the graph.
+    const index_type indexBound{graph.vertexIndexBound()};
+
+    // Initialize the distance to all vertices to infinity
+    std::pmr::vector<std::int32_t> distance(indexBound, infinity, resource);
+
+    // And having a null predecessor
+    std::pmr::vector<tl::optional<index_type>> predecessor(
+        indexBound, tl::nullopt, resource);
+
+    const tl::optional<index_type> sourceIndex{graph.vertexIndex(source)};
 
-    constexpr std::int32_t               infinity{INT32_MAX};
-    const tl::optional<VertexIdentifier> undefined{tl::nullopt};
+    // The distance from the source to itself is zero
+    if (sourceIndex.has_value()) { distance[*sourceIndex] = 0; }
 
-    std::unordered_map<VertexIdentifier, std::int32_t> distance{};
-    std::unordered_map<VertexIdentifier, tl::optional<VertexIdentifier>>
-        predecessor{};
+    // The length of every edge by its index, computed once so that the
+    // passes over the edges don't invoke the length invocable.
+    std::pmr::vector<std::int32_t> lengths(
+        graph.edgeIndexBound(), 0, resource);
 
-    const std::vector<vertex_type>& vertices{graph.vertices()};
-    const std::vector<edge_type>&   edges{graph.edges()};
+    for (index_type u{0}; u < indexBound; ++u) {
+        if (not graph.hasVertexAt(u)) { continue; }
 
-    // Initialize graph
-    for (const vertex_type& vertex : vertices) {
-        const VertexIdentifier& v{vertex.identifier()};
+        const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
 
-        distance[v]
-            = infinity; // Initialize the distance to all vertices to infinity
-        predecessor[v] = undefined; // And having a null predecessor
+        for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+            lengths[it.slot()]
+                = static_cast<std::int32_t>(pl::invoke(lengthInvocable, *it));
+        }
     }
 
-    distance[source] = 0; // The distance from the source to itself is zero
+    // Invokes an invocable with the source index, the target index and the
+    // length of every edge, grouped by the source vertices. The adjacency
+    // lists never refer to removed edges.
+    const auto forEachEdge = [&graph, indexBound, &lengths](
+                                 const auto& invocable) {
+        for (index_type u{0}; u < indexBound; ++u) {
+            if (not graph.hasVertexAt(u)) { continue; }
+
+            const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+            for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                invocable(
+                    u, graph.endpointIndices(it).target, lengths[it.slot()]);
+            }
+        }
+    };
 
     // Relax edges repeatedly
-    for (std::size_t i{1_zu}; i <= (vertices.size() - 1_zu); ++i) {
-        for (const edge_type& edge : edges) {
-            const VertexIdentifier& u{edge.source()};
-            const VertexIdentifier& v{edge.target()};
-            const std::int32_t      w{
-                static_cast<std::int32_t>(std::invoke(lengthInvocable, edge))};
+    for (std::size_t i{1_zu}; i < graph.vertexCount(); ++i) {
+        forEachEdge([&distance, &predecessor](
+                        index_type u, index_type v, std::int32_t w) {
+            if ((static_cast<std::int64_t>(distance[u]) + w) < distance[v]) {
+                distance[v]    = distance[u] + w;
+                predecessor[v] = u;
+            }
+        });
+    }
+
+    // Check for negative-weight cycles
+    forEachEdge([&distance](index_type u, index_type v, std::int32_t w) {
+        if ((static_cast<std::int64_t>(distance[u]) + w) < distance[v]) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::runtime_error, "Graph contains a negative-weight cycle");
+        }
+    });
+
+    // Translate the dense indices back to the vertex identifiers.
+    typename shortest_paths_type::prev_map_type predecessorMap{resource};
+    typename shortest_paths_type::dist_map_type distanceMap{resource};
+    predecessorMap.reserve(graph.vertexCount());
+    distanceMap.reserve(graph.vertexCount());
+
+    // The source is always reported, even if it isn't part of the graph.
+    distanceMap.emplace(source, 0);
+
+    for (index_type v{0}; v < indexBound; ++v) {
+        if (not graph.hasVertexAt(v)) { continue; }
+
+        const VertexIdentifier& identifier{graph.vertexAt(v).identifier()};
+        distanceMap[identifier] = distance[v];
+        predecessorMap.emplace(
+            identifier, predecessor[v].map([&graph](index_type index) {
+                return graph.vertexAt(index).identifier();
+            }));
+    }
+
+    return shortest_paths_type{
+        std::move(source), std::move(predecessorMap), std::move(distanceMap)};
+}
+
+/*!
+ * \brief Implements the bellman ford algorithm for snapshots of directed
+ *        graphs.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the directed graph to operate on.
+ * \tparam VertexData The type of the data that is stored on a vertex.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the directed graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param snapshot The snapshot to find the shortest paths in, as taken from a
+ *                 ConcurrentDirectedGraph.
+ * \param source The source vertex to use.
+ * \param lengthInvocable The unary length invocable object.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \return The result object containing the shortest paths from 'source'
+ *         to all the vertices in the graph given.
+ * \throws std::runtime_error if there is a negative-weight cycle in the graph
+ *                            given.
+ * \note Sees the version of the graph of the snapshot, regardless of what is
+ *       published while the algorithm runs.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+ShortestPaths<VertexIdentifier, std::int32_t> algorithm(
+    const GraphSnapshot<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                               snapshot,
+    VertexIdentifier           source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    return algorithm(
+        snapshot.graph(),
+        std::move(source),
+        std::move(lengthInvocable),
+        resource);
+}
+
+/*!
+ * \brief Implements the bellman ford algorithm for CompactGraphs.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the graph to operate on.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param graph The graph to find the shortest paths in.
+ * \param source The source vertex to use.
+ * \param lengthInvocable The unary length invocable object. Is invoked with
+ *                        CompactGraph<VertexIdentifier,
+ *                                     EdgeIdentifier,
+ *                                     EdgeData>::EdgeReference objects.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \return The result object containing the shortest paths from 'source'
+ *         to all the vertices in the graph given.
+ * \throws std::runtime_error if there is a negative-weight cycle in the graph
+ *                            given.
+ * \note Yields the same result as the DirectedGraph overload, also if
+ *       source is not a vertex of graph.
+ * \note The edges are relaxed grouped by their source vertices. The passes
+ *       over the edges only read the sources and targets columns of the graph
+ *       and a column of the edge lengths computed up front.
+ **/
+template<
+    typename VertexIdentifier,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+ShortestPaths<VertexIdentifier, std::int32_t> algorithm(
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph,
+    VertexIdentifier                                                source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    using namespace pl::literals::integer_literals;
+
+    using graph_type = CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+    using index_type = typename graph_type::index_type;
+
+    constexpr std::int32_t infinity{INT32_MAX};
+
+    const tl::optional<index_type> sourceIndex{graph.index(source)};
+    const std::size_t              vertexCount{graph.vertexCount()};
+
+    std::pmr::vector<std::int32_t> distance(vertexCount, infinity, resource);
+    std::pmr::vector<tl::optional<index_type>> predecessor(
+        vertexCount, tl::nullopt, resource);
+
+    if (sourceIndex.has_value()) { distance[*sourceIndex] = 0; }
+
+    const std::vector<index_type>& sources{graph.sources()};
+    const std::vector<index_type>& targets{graph.targets()};
+    const std::size_t              edgeCount{graph.edgeCount()};
+
+    // The lengths column, parallel to the sources and targets columns.
+    std::pmr::vector<std::int32_t> lengths(edgeCount, resource);
+
+    for (const typename graph_type::EdgeReference edge : graph.edges()) {
+        lengths[edge.index()]
+            = static_cast<std::int32_t>(pl::invoke(lengthInvocable, edge));
+    }
+
+    // Relax edges repeatedly
+    for (std::size_t i{1_zu}; i < vertexCount; ++i) {
+        for (std::size_t e{0_zu}; e < edgeCount; ++e) {
+            const index_type   u{sources[e]};
+            const index_type   v{targets[e]};
+            const std::int32_t w{lengths[e]};
 
             if ((static_cast<std::int64_t>(distance[u]) + w) < distance[v]) {
                 distance[v]    = distance[u] + w;
@@ -89,20 +292,36 @@ ShortestPaths<VertexIdentifier, std::int32_t> algorithm(
     }
 
     // Check for negative-weight cycles
-    for (const edge_type& edge : edges) {
-        const VertexIdentifier& u{edge.source()};
-        const VertexIdentifier& v{edge.target()};
-        const std::int32_t      w{
-            static_cast<std::int32_t>(std::invoke(lengthInvocable, edge))};
-
-        if ((static_cast<std::int64_t>(distance[u]) + w) < distance[v]) {
+    for (std::size_t e{0_zu}; e < edgeCount; ++e) {
+        if ((static_cast<std::int64_t>(distance[sources[e]]) + lengths[e])
+            < distance[targets[e]]) {
             PL_THROW_WITH_SOURCE_INFO(
                 std::runtime_error, "Graph contains a negative-weight cycle");
         }
     }
 
+    // Translate the dense indices back to the vertex identifiers.
+    typename ShortestPaths<VertexIdentifier, std::int32_t>::prev_map_type
+        predecessorMap{resource};
+    typename ShortestPaths<VertexIdentifier, std::int32_t>::dist_map_type
+        distanceMap{resource};
+    predecessorMap.reserve(vertexCount);
+    distanceMap.reserve(vertexCount);
+
+    // The source is always reported, even if it isn't part of the graph.
+    distanceMap.emplace(source, 0);
+
+    for (index_type v{0}; v < vertexCount; ++v) {
+        const VertexIdentifier& identifier{graph.identifier(v)};
+        distanceMap[identifier] = distance[v];
+        predecessorMap.emplace(
+            identifier, predecessor[v].map([&graph](index_type index) {
+                return graph.identifier(index);
+            }));
+    }
+
     return ShortestPaths<VertexIdentifier, std::int32_t>{
-        std::move(source), std::move(predecessor), std::move(distance)};
+        std::move(source), std::move(predecessorMap), std::move(distanceMap)};
 }
 } // namespace bellman_ford
 } // namespace gp
@@ -0,0 +1,638 @@
+#ifndef INCG_GP_COMPACT_GRAPH_HPP
+#define INCG_GP_COMPACT_GRAPH_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include "find_equal.hpp"     // gp::findEqual, gp::countEqual
+#include "memory_usage.hpp"   // gp::MemoryUsage, gp::memory::usedBytes, ...
+#include <ciso646>            // not
+#include <cstddef>            // std::size_t, std::ptrdiff_t
+#include <cstdint>            // std::uint32_t, UINT32_MAX
+#include <iterator>           // std::forward_iterator_tag
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <pl/except.hpp>      // PL_THROW_WITH_SOURCE_INFO
+#include <pl/invoke.hpp>      // pl::invoke
+#include <stdexcept>          // std::length_error
+#include <tl/optional.hpp>    // tl::optional, tl::nullopt
+#include <unordered_map>      // std::unordered_map
+#include <utility>            // std::move
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief Immutable compressed sparse row (CSR) representation of a directed
+ *        graph.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ *
+ * Every vertex is mapped to a dense 32 bit index. The edges are stored as a
+ * structure of arrays: the sources(), targets(), edgeIdentifiers() and
+ * edgeData() columns. The outbound edges of the vertex with index i are
+ * stored contiguously at the positions [offsets()[i], offsets()[i + 1]) of
+ * the columns. Within a vertex the edges keep the order they had in the
+ * DirectedGraph the CompactGraph was created from.
+ *
+ * Edges are handed out as EdgeReference proxies, so scans over the edges only
+ * touch the columns they actually read.
+ **/
+template<typename VertexIdentifier, typename EdgeIdentifier, typename EdgeData>
+class CompactGraph {
+public:
+    using this_type         = CompactGraph;
+    using vertex_identifier = VertexIdentifier;
+    using edge_identifier   = EdgeIdentifier;
+    using edge_data         = EdgeData;
+    using size_type         = std::size_t;
+
+    /*!
+     * \brief The type of the dense indices of the vertices and edges.
+     **/
+    using index_type = std::uint32_t;
+
+    /*!
+     * \brief Lightweight handle to an edge of a CompactGraph.
+     *
+     * Provides the same read accessors as gp::Edge, so that invocables
+     * written against gp::Edge (e.g. length invocables) can be reused.
+     **/
+    class EdgeReference {
+    public:
+        /*!
+         * \brief Creates an EdgeReference.
+         * \param graph The graph the edge belongs to.
+         * \param edge The index of the edge.
+         **/
+        EdgeReference(const CompactGraph& graph, index_type edge) noexcept
+            : m_graph{&graph}, m_edge{edge}
+        {
+        }
+
+        /*!
+         * \brief Read accessor for the unique identifier.
+         * \return The unique identifier.
+         **/
+        PL_NODISCARD const edge_identifier& identifier() const noexcept
+        {
+            return m_graph->m_edgeIdentifiers[m_edge];
+        }
+
+        /*!
+         * \brief Read accessor for the source vertex.
+         * \return The source vertex.
+         **/
+        PL_NODISCARD const vertex_identifier& source() const noexcept
+        {
+            return m_graph->m_identifiers[sourceIndex()];
+        }
+
+        /*!
+         * \brief Read accessor for the target vertex.
+         * \return The target vertex.
+         **/
+        PL_NODISCARD const vertex_identifier& target() const noexcept
+        {
+            return m_graph->m_identifiers[targetIndex()];
+        }
+
+        /*!
+         * \brief Read accessor for the edge data.
+         * \return The edge data.
+         **/
+        PL_NODISCARD const edge_data& data() const noexcept
+        {
+            return m_graph->m_edgeData[m_edge];
+        }
+
+        /*!
+         * \brief Read accessor for the dense index of this edge.
+         * \return The dense index of this edge.
+         **/
+        PL_NODISCARD index_type index() const noexcept { return m_edge; }
+
+        /*!
+         * \brief Read accessor for the dense index of the source vertex.
+         * \return The dense index of the source vertex.
+         **/
+        PL_NODISCARD index_type sourceIndex() const noexcept
+        {
+            return m_graph->m_sources[m_edge];
+        }
+
+        /*!
+         * \brief Read accessor for the dense index of the target vertex.
+         * \return The dense index of the target vertex.
+         **/
+        PL_NODISCARD index_type targetIndex() const noexcept
+        {
+            return m_graph->m_targets[m_edge];
+        }
+
+    private:
+        const CompactGraph* m_graph;
+        index_type          m_edge;
+    };
+
+    /*!
+     * \brief Forward iterator over consecutive edges.
+     **/
+    class EdgeIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = EdgeReference;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const EdgeReference*;
+        using reference         = EdgeReference;
+
+        EdgeIterator(const CompactGraph& graph, index_type edge) noexcept
+            : m_graph{&graph}, m_edge{edge}
+        {
+        }
+
+        PL_NODISCARD reference operator*() const noexcept
+        {
+            return EdgeReference{*m_graph, m_edge};
+        }
+
+        EdgeIterator& operator++() noexcept
+        {
+            ++m_edge;
+            return *this;
+        }
+
+        EdgeIterator operator++(int) noexcept
+        {
+            EdgeIterator copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(EdgeIterator lhs, EdgeIterator rhs) noexcept
+        {
+            return lhs.m_edge == rhs.m_edge;
+        }
+
+        friend bool operator!=(EdgeIterator lhs, EdgeIterator rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+    private:
+        const CompactGraph* m_graph;
+        index_type          m_edge;
+    };
+
+    /*!
+     * \brief Range of consecutive edges.
+     **/
+    class EdgeRange {
+    public:
+        EdgeRange(EdgeIterator first, EdgeIterator last, size_type size)
+            : m_first{first}, m_last{last}, m_size{size}
+        {
+        }
+
+        PL_NODISCARD EdgeIterator begin() const noexcept { return m_first; }
+
+        PL_NODISCARD EdgeIterator end() const noexcept { return m_last; }
+
+        PL_NODISCARD size_type size() const noexcept { return m_size; }
+
+        PL_NODISCARD bool empty() const noexcept { return m_size == 0; }
+
+    private:
+        EdgeIterator m_first;
+        EdgeIterator m_last;
+        size_type    m_size;
+    };
+
+    /*!
+     * \brief Creates an empty CompactGraph.
+     **/
+    CompactGraph()
+        : m_identifiers{}
+        , m_indices{}
+        , m_offsets(1, 0)
+        , m_sources{}
+        , m_targets{}
+        , m_edgeIdentifiers{}
+        , m_edgeData{}
+    {
+    }
+
+    /*!
+     * \brief Freezes a DirectedGraph into a CompactGraph.
+     * \tparam VertexData The type of the data stored on the vertices of the
+     *                    graph given. The vertex data is not copied.
+     * \param graph The graph to freeze.
+     * \throws std::length_error if graph has too many vertices or edges to be
+     *                           indexed using index_type.
+     * \note Complexity is linear in the amount of vertices plus the amount of
+     *       edges in graph.
+     **/
+    template<typename VertexData>
+    explicit CompactGraph(const DirectedGraph<
+                          VertexIdentifier,
+                          VertexData,
+                          EdgeIdentifier,
+                          EdgeData>& graph)
+        : CompactGraph{}
+    {
+        using vertex_type = typename DirectedGraph<
+            VertexIdentifier,
+            VertexData,
+            EdgeIdentifier,
+            EdgeData>::vertex_type;
+
+        checkSize(graph);
+
+        // Assign the dense indices.
+        m_identifiers.reserve(graph.vertexCount());
+        m_indices.reserve(graph.vertexCount());
+
+        for (const vertex_type& vertex : graph.vertices()) {
+            m_indices.emplace(
+                vertex.identifier(),
+                static_cast<index_type>(m_identifiers.size()));
+            m_identifiers.push_back(vertex.identifier());
+        }
+
+        fillEdges(graph);
+    }
+
+    /*!
+     * \brief Freezes a DirectedGraph into a CompactGraph, storing the
+     *        vertices in a given order.
+     * \tparam VertexData The type of the data stored on the vertices of the
+     *                    graph given. The vertex data is not copied.
+     * \param graph The graph to freeze.
+     * \param order The dense indices of all the vertices of graph (see
+     *              DirectedGraph::vertexIndex) in the order to store them in.
+     *              The vertex order[i] gets the index i.
+     * \throws std::length_error if graph has too many vertices or edges to be
+     *                           indexed using index_type.
+     * \note Complexity is linear in the amount of vertices plus the amount of
+     *       edges in graph.
+     * \note See vertex_order.hpp for orders that improve the locality of
+     *       traversals.
+     **/
+    template<typename VertexData>
+    CompactGraph(
+        const DirectedGraph<
+            VertexIdentifier,
+            VertexData,
+            EdgeIdentifier,
+            EdgeData>&                 graph,
+        const std::vector<index_type>& order)
+        : CompactGraph{}
+    {
+        PL_ASSERT(order.size() == graph.vertexCount());
+        checkSize(graph);
+
+        m_identifiers.reserve(graph.vertexCount());
+        m_indices.reserve(graph.vertexCount());
+
+        for (index_type index : order) {
+            const vertex_identifier& identifier{
+                graph.vertexAt(index).identifier()};
+            m_indices.emplace(
+                identifier, static_cast<index_type>(m_identifiers.size()));
+            m_identifiers.push_back(identifier);
+        }
+
+        fillEdges(graph);
+    }
+
+    /*!
+     * \brief Queries the amount of vertices in this graph.
+     * \return The amount of vertices in this graph.
+     **/
+    PL_NODISCARD size_type vertexCount() const noexcept
+    {
+        return m_identifiers.size();
+    }
+
+    /*!
+     * \brief Queries the amount of edges in this graph.
+     * \return The amount of edges in this graph.
+     **/
+    PL_NODISCARD size_type edgeCount() const noexcept
+    {
+        return m_targets.size();
+    }
+
+    /*!
+     * \brief Checks whether this graph contains a vertex with the identifier
+     *        given.
+     * \param identifier The identifier.
+     * \return true if there is such a vertex; otherwise false.
+     **/
+    PL_NODISCARD bool hasVertex(const vertex_identifier& identifier) const
+    {
+        return m_indices.find(identifier) != m_indices.end();
+    }
+
+    /*!
+     * \brief Maps a vertex identifier to its dense index.
+     * \param identifier The vertex identifier.
+     * \return The dense index of the vertex or a nullopt if this graph doesn't
+     *         contain a vertex with the identifier given.
+     **/
+    PL_NODISCARD tl::optional<index_type> index(
+        const vertex_identifier& identifier) const
+    {
+        const typename std::unordered_map<vertex_identifier, index_type>::
+            const_iterator it{m_indices.find(identifier)};
+
+        if (it == m_indices.end()) { return tl::nullopt; }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Maps a dense vertex index back to the original identifier.
+     * \param index The dense index. Must be less than vertexCount().
+     * \return The identifier of the vertex.
+     **/
+    PL_NODISCARD const vertex_identifier& identifier(index_type index) const
+        noexcept
+    {
+        return m_identifiers[index];
+    }
+
+    /*!
+     * \brief Read accessor for the vertex identifiers ordered by dense index.
+     * \return The vertex identifiers.
+     **/
+    PL_NODISCARD const std::vector<vertex_identifier>& identifiers() const
+        noexcept
+    {
+        return m_identifiers;
+    }
+
+    /*!
+     * \brief Fetches the outbound edges of a vertex.
+     * \param vertex The dense index of the vertex. Must be less than
+     *               vertexCount().
+     * \return The range of the outbound edges of the vertex.
+     * \note Constant complexity, doesn't allocate.
+     **/
+    PL_NODISCARD EdgeRange outboundEdges(index_type vertex) const noexcept
+    {
+        const index_type first{m_offsets[vertex]};
+        const index_type last{m_offsets[vertex + 1]};
+
+        return edgeRange(first, last);
+    }
+
+    /*!
+     * \brief Fetches all the edges.
+     * \return The range of all the edges, grouped by their source vertex.
+     * \note Constant complexity, doesn't allocate.
+     **/
+    PL_NODISCARD EdgeRange edges() const noexcept
+    {
+        return edgeRange(0, static_cast<index_type>(edgeCount()));
+    }
+
+    /*!
+     * \brief Fetches an edge by its dense index.
+     * \param edge The dense index of the edge. Must be less than edgeCount().
+     * \return The edge.
+     **/
+    PL_NODISCARD EdgeReference edge(index_type edge) const noexcept
+    {
+        return EdgeReference{*this, edge};
+    }
+
+    /*!
+     * \brief Finds the edges satisfying a predicate.
+     * \param unaryPredicate The predicate, invoked with EdgeReference objects.
+     * \return The dense indices of the edges satisfying the predicate in
+     *         ascending order.
+     * \note Only reads the columns the predicate reads.
+     **/
+    template<typename UnaryPredicate>
+    PL_NODISCARD std::vector<index_type> findEdges(
+        UnaryPredicate unaryPredicate) const
+    {
+        std::vector<index_type> result{};
+
+        for (index_type edge{0}; edge < edgeCount(); ++edge) {
+            if (pl::invoke(unaryPredicate, EdgeReference{*this, edge})) {
+                result.push_back(edge);
+            }
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Finds the inbound edges of a vertex.
+     * \param vertex The dense index of the vertex.
+     * \return The dense indices of the edges entering the vertex in
+     *         ascending order.
+     * \note Only reads the targets column, several targets per instruction
+     *       if SIMD instructions are available.
+     **/
+    PL_NODISCARD std::vector<index_type> findEdgesByTarget(
+        index_type vertex) const
+    {
+        return findEqual(m_targets, vertex);
+    }
+
+    /*!
+     * \brief Returns the inbound degree of a vertex.
+     * \param vertex The dense index of the vertex.
+     * \return The inbound degree of the vertex.
+     * \note Linear complexity, as only the outbound edges are indexed.
+     *       Only reads the targets column, several targets per instruction
+     *       if SIMD instructions are available.
+     **/
+    PL_NODISCARD size_type inboundDegree(index_type vertex) const noexcept
+    {
+        return countEqual(m_targets, vertex);
+    }
+
+    /*!
+     * \brief Returns the outbound degree of a vertex.
+     * \param vertex The dense index of the vertex. Must be less than
+     *               vertexCount().
+     * \return The outbound degree of the vertex.
+     **/
+    PL_NODISCARD size_type outboundDegree(index_type vertex) const noexcept
+    {
+        return m_offsets[vertex + 1] - m_offsets[vertex];
+    }
+
+    /*!
+     * \brief Read accessor for the offsets column.
+     * \return The offsets, vertexCount() + 1 elements.
+     **/
+    PL_NODISCARD const std::vector<index_type>& offsets() const noexcept
+    {
+        return m_offsets;
+    }
+
+    /*!
+     * \brief Read accessor for the sources column.
+     * \return The dense indices of the source vertices of the edges, in
+     *         ascending order.
+     **/
+    PL_NODISCARD const std::vector<index_type>& sources() const noexcept
+    {
+        return m_sources;
+    }
+
+    /*!
+     * \brief Read accessor for the targets column.
+     * \return The dense indices of the target vertices of the edges.
+     **/
+    PL_NODISCARD const std::vector<index_type>& targets() const noexcept
+    {
+        return m_targets;
+    }
+
+    /*!
+     * \brief Read accessor for the edge identifiers column.
+     * \return The edge identifiers.
+     **/
+    PL_NODISCARD const std::vector<edge_identifier>& edgeIdentifiers() const
+        noexcept
+    {
+        return m_edgeIdentifiers;
+    }
+
+    /*!
+     * \brief Read accessor for the edge data column.
+     * \return The edge data.
+     **/
+    PL_NODISCARD const std::vector<edge_data>& edgeData() const noexcept
+    {
+        return m_edgeData;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes held by this CompactGraph.
+     * \return The bytes. The vertex identifiers count as vertices, the edge
+     *         columns as edges and the offsets and the hash index as
+     *         indices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{
+            sizeof(this_type),
+            memory::usedBytes(m_identifiers),
+            memory::usedBytes(m_sources) + memory::usedBytes(m_targets)
+                + memory::usedBytes(m_edgeIdentifiers)
+                + memory::usedBytes(m_edgeData),
+            memory::usedBytes(m_offsets) + memory::nodeBytes(m_indices),
+            memory::bucketBytes(m_indices),
+            memory::slackBytes(m_identifiers) + memory::slackBytes(m_offsets)
+                + memory::slackBytes(m_sources)
+                + memory::slackBytes(m_targets)
+                + memory::slackBytes(m_edgeIdentifiers)
+                + memory::slackBytes(m_edgeData)};
+    }
+
+private:
+    /*!
+     * \brief Throws if a graph is too large to be indexed using index_type.
+     * \param graph The graph.
+     * \throws std::length_error if graph has too many vertices or edges.
+     **/
+    template<typename Graph>
+    static void checkSize(const Graph& graph)
+    {
+        if ((graph.vertexCount() > UINT32_MAX)
+            or (graph.edgeCount() > UINT32_MAX)) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::length_error,
+                "graph is too large to be indexed using 32 bit indices");
+        }
+    }
+
+    /*!
+     * \brief Fills the offsets and the edge columns from a graph.
+     * \param graph The graph, its vertices must already have been assigned
+     *              their dense indices.
+     * \note The edges are stored grouped by the dense index of their source
+     *       vertex. The outbound edges of a vertex keep their order.
+     **/
+    template<typename Graph>
+    void fillEdges(const Graph& graph)
+    {
+        using edge_type = typename Graph::edge_type;
+
+        // Count the outbound edges of every vertex ...
+        m_offsets.assign(m_identifiers.size() + 1, 0);
+
+        for (const edge_type& edge : graph.edges()) {
+            ++m_offsets[m_indices.at(edge.source()) + 1];
+        }
+
+        // ... and turn the counts into offsets.
+        for (size_type i{1}; i < m_offsets.size(); ++i) {
+            m_offsets[i] += m_offsets[i - 1];
+        }
+
+        // Counting sort the edges by their source vertex.
+        std::vector<index_type> next(m_offsets.begin(), m_offsets.end() - 1);
+        std::vector<const edge_type*> sorted(graph.edgeCount(), nullptr);
+
+        for (const edge_type& edge : graph.edges()) {
+            sorted[next[m_indices.at(edge.source())]++] = &edge;
+        }
+
+        // Fill the columns.
+        m_sources.reserve(sorted.size());
+        m_targets.reserve(sorted.size());
+        m_edgeIdentifiers.reserve(sorted.size());
+        m_edgeData.reserve(sorted.size());
+
+        for (const edge_type* edge : sorted) {
+            m_sources.push_back(m_indices.at(edge->source()));
+            m_targets.push_back(m_indices.at(edge->target()));
+            m_edgeIdentifiers.push_back(edge->identifier());
+            m_edgeData.push_back(edge->data());
+        }
+    }
+
+    /*!
+     * \brief Creates a range over consecutive edges.
+     * \param first The dense index of the first edge.
+     * \param last The dense index one past the last edge.
+     * \return The range.
+     **/
+    PL_NODISCARD EdgeRange edgeRange(index_type first, index_type last) const
+        noexcept
+    {
+        return EdgeRange{EdgeIterator{*this, first},
+                         EdgeIterator{*this, last},
+                         static_cast<size_type>(last - first)};
+    }
+
+    std::vector<vertex_identifier> m_identifiers; /*!< Index -> identifier */
+    std::unordered_map<vertex_identifier, index_type>
+                                 m_indices; /*!< Identifier -> index */
+    std::vector<index_type>      m_offsets; /*!< Row offsets */
+    std::vector<index_type>      m_sources; /*!< Source vertex indices */
+    std::vector<index_type>      m_targets; /*!< Target vertex indices */
+    std::vector<edge_identifier> m_edgeIdentifiers; /*!< Edge identifiers */
+    std::vector<edge_data>       m_edgeData;        /*!< Edge data */
+};
+
+/*!
+ * \brief Deduction guide to freeze a DirectedGraph into a CompactGraph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+CompactGraph(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&)
+    -> CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+} // namespace gp
+#endif // INCG_GP_COMPACT_GRAPH_HPP
@@ -0,0 +1,487 @@
+#ifndef INCG_GP_COMPRESSED_GRAPH_HPP
+#define INCG_GP_COMPRESSED_GRAPH_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include "memory_usage.hpp"   // gp::MemoryUsage, gp::memory::usedBytes, ...
+#include "varint.hpp"         // gp::encodeVarint, gp::decodeVarint, ...
+#include <algorithm>          // std::sort, std::count_if
+#include <ciso646>            // not, or
+#include <cstddef>            // std::size_t, std::ptrdiff_t
+#include <cstdint>            // std::uint8_t, std::uint32_t, UINT32_MAX, ...
+#include <iterator>           // std::forward_iterator_tag
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <pl/except.hpp>      // PL_THROW_WITH_SOURCE_INFO
+#include <pl/invoke.hpp>      // pl::invoke
+#include <stdexcept>          // std::length_error
+#include <tl/optional.hpp>    // tl::optional, tl::nullopt
+#include <unordered_map>      // std::unordered_map
+#include <utility>            // std::pair
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief Immutable compressed representation of the topology and the edge
+ *        lengths of a directed graph.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ *
+ * Every vertex is mapped to a dense 32 bit index like in a CompactGraph. The
+ * outbound edges of a vertex are sorted by the index of their target and
+ * stored as a byte string of varints: the first target as the zig-zag
+ * encoded difference to the index of the source, every further target as
+ * the difference to the previous one, each followed by the length of the
+ * edge. Neighbouring vertices mostly have nearby indices, more so after
+ * reordering the graph (see vertex_order.hpp), so most edges take 2 or 3
+ * bytes instead of the 32 bytes and more of a DirectedGraph edge.
+ *
+ * The lengths can be quantized: with a length quantum q a length l is stored
+ * as round(l / q) and read back as round(l / q) * q. A quantum of 1 keeps
+ * the lengths exact.
+ *
+ * The edge identifiers and the edge data are not kept. The edges are only
+ * accessible by decoding them with a NeighborIterator.
+ **/
+template<typename VertexIdentifier>
+class CompressedGraph {
+public:
+    using this_type         = CompressedGraph;
+    using vertex_identifier = VertexIdentifier;
+    using size_type         = std::size_t;
+    using length_type       = std::size_t;
+
+    /*!
+     * \brief The type of the dense indices of the vertices.
+     **/
+    using index_type = std::uint32_t;
+
+    /*!
+     * \brief A decoded outbound edge.
+     **/
+    struct Neighbor {
+        index_type  target; /*!< The dense index of the target vertex */
+        length_type length; /*!< The (quantized) length of the edge */
+    };
+
+    /*!
+     * \brief Forward iterator decoding the outbound edges of a vertex as it
+     *        goes.
+     **/
+    class NeighborIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Neighbor;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Neighbor*;
+        using reference         = const Neighbor&;
+
+        /*!
+         * \brief Creates a NeighborIterator.
+         * \param position The first byte of the edge to start at.
+         * \param last One past the last byte of the edges of the vertex.
+         * \param source The dense index of the source vertex.
+         * \param lengthQuantum The length quantum of the graph.
+         **/
+        NeighborIterator(
+            const std::uint8_t* position,
+            const std::uint8_t* last,
+            index_type          source,
+            length_type         lengthQuantum) noexcept
+            : m_position{position}
+            , m_next{position}
+            , m_last{last}
+            , m_source{source}
+            , m_lengthQuantum{lengthQuantum}
+            , m_current{source, 0}
+            , m_isFirst{true}
+        {
+            decode();
+        }
+
+        PL_NODISCARD reference operator*() const noexcept
+        {
+            return m_current;
+        }
+
+        PL_NODISCARD pointer operator->() const noexcept
+        {
+            return &m_current;
+        }
+
+        NeighborIterator& operator++() noexcept
+        {
+            m_position = m_next;
+            decode();
+            return *this;
+        }
+
+        NeighborIterator operator++(int) noexcept
+        {
+            NeighborIterator copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(
+            const NeighborIterator& lhs,
+            const NeighborIterator& rhs) noexcept
+        {
+            return lhs.m_position == rhs.m_position;
+        }
+
+        friend bool operator!=(
+            const NeighborIterator& lhs,
+            const NeighborIterator& rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+    private:
+        /*!
+         * \brief Decodes the edge at m_position, unless at the end.
+         **/
+        void decode() noexcept
+        {
+            if (m_position == m_last) { return; }
+
+            const std::uint64_t delta{decodeVarint(m_next)};
+
+            if (m_isFirst) {
+                m_current.target = static_cast<index_type>(
+                    static_cast<std::int64_t>(m_source) + zigZagDecode(delta));
+                m_isFirst = false;
+            }
+            else {
+                m_current.target += static_cast<index_type>(delta);
+            }
+
+            m_current.length = static_cast<length_type>(decodeVarint(m_next))
+                               * m_lengthQuantum;
+        }
+
+        const std::uint8_t* m_position; /*!< The current edge */
+        const std::uint8_t* m_next;     /*!< The edge after the current one */
+        const std::uint8_t* m_last;     /*!< One past the last edge */
+        index_type          m_source;
+        length_type         m_lengthQuantum;
+        Neighbor            m_current;
+        bool                m_isFirst; /*!< Whether nothing was decoded */
+    };
+
+    /*!
+     * \brief Range over the outbound edges of a vertex.
+     **/
+    class NeighborRange {
+    public:
+        NeighborRange(NeighborIterator first, NeighborIterator last)
+            : m_first{first}, m_last{last}
+        {
+        }
+
+        PL_NODISCARD NeighborIterator begin() const noexcept
+        {
+            return m_first;
+        }
+
+        PL_NODISCARD NeighborIterator end() const noexcept { return m_last; }
+
+        PL_NODISCARD bool empty() const noexcept { return m_first == m_last; }
+
+    private:
+        NeighborIterator m_first;
+        NeighborIterator m_last;
+    };
+
+    /*!
+     * \brief Creates an empty CompressedGraph.
+     **/
+    CompressedGraph()
+        : m_identifiers{}
+        , m_indices{}
+        , m_offsets(1, 0)
+        , m_bytes{}
+        , m_edgeCount{0}
+        , m_lengthQuantum{1}
+    {
+    }
+
+    /*!
+     * \brief Compresses a DirectedGraph.
+     * \tparam VertexData The type of the data stored on the vertices of the
+     *                    graph given. Not copied.
+     * \tparam EdgeIdentifier The type of the identifiers of the edges of the
+     *                        graph given. Not copied.
+     * \tparam EdgeData The type of the data stored on the edges of the graph
+     *                  given. Not copied.
+     * \tparam LengthInvocable The type of the unary length invocable.
+     * \param graph The graph to compress.
+     * \param lengthInvocable A unary invocable that shall take an lvalue
+     *                        reference to const edge_type of graph and return
+     *                        the length of the given edge as an object of
+     *                        type std::size_t.
+     * \param lengthQuantum The length quantum, must not be 0. 1 keeps the
+     *                      lengths exact.
+     * \throws std::length_error if graph has too many vertices or the
+     *                           encoded edges take too many bytes to be
+     *                           indexed using index_type.
+     * \note The vertices get the dense indices in the order of the vertices of
+     *       graph. Reorder graph first for the best compression.
+     * \note Complexity is linearithmic in the amount of edges, as the outbound
+     *       edges of every vertex are sorted.
+     **/
+    template<
+        typename VertexData,
+        typename EdgeIdentifier,
+        typename EdgeData,
+        typename LengthInvocable>
+    CompressedGraph(
+        const DirectedGraph<
+            VertexIdentifier,
+            VertexData,
+            EdgeIdentifier,
+            EdgeData>&  graph,
+        LengthInvocable lengthInvocable,
+        length_type     lengthQuantum = 1)
+        : CompressedGraph{}
+    {
+        using graph_type = DirectedGraph<
+            VertexIdentifier,
+            VertexData,
+            EdgeIdentifier,
+            EdgeData>;
+        using graph_index_type = typename graph_type::index_type;
+        using vertex_type      = typename graph_type::vertex_type;
+        using edge_range       = typename graph_type::edge_range;
+
+        PL_ASSERT(lengthQuantum != 0);
+
+        if (graph.vertexCount() > UINT32_MAX) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::length_error,
+                "graph is too large to be indexed using 32 bit indices");
+        }
+
+        m_lengthQuantum = lengthQuantum;
+        m_edgeCount     = graph.edgeCount();
+
+        // Assign the dense indices.
+        m_identifiers.reserve(graph.vertexCount());
+        m_indices.reserve(graph.vertexCount());
+
+        for (const vertex_type& vertex : graph.vertices()) {
+            m_indices.emplace(
+                vertex.identifier(),
+                static_cast<index_type>(m_identifiers.size()));
+            m_identifiers.push_back(vertex.identifier());
+        }
+
+        // The dense indices of the graph may have holes, so they are mapped
+        // to the ones of this graph.
+        std::vector<index_type> indices(graph.vertexIndexBound(), 0);
+
+        for (graph_index_type i{0}; i < graph.vertexIndexBound(); ++i) {
+            if (graph.hasVertexAt(i)) {
+                indices[i] = m_indices.at(graph.vertexAt(i).identifier());
+            }
+        }
+
+        // Encode the outbound edges of every vertex, sorted by their target.
+        std::vector<std::pair<index_type, length_type>> neighbors{};
+        m_offsets.reserve(m_identifiers.size() + 1);
+
+        for (graph_index_type i{0}; i < graph.vertexIndexBound(); ++i) {
+            if (not graph.hasVertexAt(i)) { continue; }
+
+            const index_type source{indices[i]};
+            const edge_range outbounds{graph.outboundEdgeRangeAt(i)};
+            neighbors.clear();
+
+            for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                const length_type length{
+                    pl::invoke(lengthInvocable, *it)};
+                neighbors.emplace_back(
+                    indices[graph.endpointIndices(it).target],
+                    (length + (m_lengthQuantum / 2)) / m_lengthQuantum);
+            }
+
+            std::sort(neighbors.begin(), neighbors.end());
+            index_type previous{source};
+
+            for (std::size_t j{0}; j < neighbors.size(); ++j) {
+                const index_type target{neighbors[j].first};
+
+                if (j == 0) {
+                    encodeVarint(
+                        m_bytes,
+                        zigZagEncode(
+                            static_cast<std::int64_t>(target)
+                            - static_cast<std::int64_t>(source)));
+                }
+                else {
+                    encodeVarint(m_bytes, target - previous);
+                }
+
+                encodeVarint(m_bytes, neighbors[j].second);
+                previous = target;
+            }
+
+            if (m_bytes.size() > UINT32_MAX) {
+                PL_THROW_WITH_SOURCE_INFO(
+                    std::length_error,
+                    "encoded edges are too large to be indexed using 32 bit "
+                    "offsets");
+            }
+
+            m_offsets.push_back(static_cast<index_type>(m_bytes.size()));
+        }
+
+        // The graph is immutable, so the slack would be wasted.
+        m_bytes.shrink_to_fit();
+    }
+
+    /*!
+     * \brief Queries the amount of vertices in this graph.
+     * \return The amount of vertices in this graph.
+     **/
+    PL_NODISCARD size_type vertexCount() const noexcept
+    {
+        return m_identifiers.size();
+    }
+
+    /*!
+     * \brief Queries the amount of edges in this graph.
+     * \return The amount of edges in this graph.
+     **/
+    PL_NODISCARD size_type edgeCount() const noexcept { return m_edgeCount; }
+
+    /*!
+     * \brief Read accessor for the length quantum.
+     * \return The length quantum, 1 if the lengths are exact.
+     **/
+    PL_NODISCARD length_type lengthQuantum() const noexcept
+    {
+        return m_lengthQuantum;
+    }
+
+    /*!
+     * \brief Checks whether this graph contains a vertex with the identifier
+     *        given.
+     * \param identifier The identifier.
+     * \return true if there is such a vertex; otherwise false.
+     **/
+    PL_NODISCARD bool hasVertex(const vertex_identifier& identifier) const
+    {
+        return m_indices.find(identifier) != m_indices.end();
+    }
+
+    /*!
+     * \brief Maps a vertex identifier to its dense index.
+     * \param identifier The vertex identifier.
+     * \return The dense index of the vertex or a nullopt if this graph doesn't
+     *         contain a vertex with the identifier given.
+     **/
+    PL_NODISCARD tl::optional<index_type> index(
+        const vertex_identifier& identifier) const
+    {
+        const typename std::unordered_map<vertex_identifier, index_type>::
+            const_iterator it{m_indices.find(identifier)};
+
+        if (it == m_indices.end()) { return tl::nullopt; }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Maps a dense vertex index back to the original identifier.
+     * \param index The dense index. Must be less than vertexCount().
+     * \return The identifier of the vertex.
+     **/
+    PL_NODISCARD const vertex_identifier& identifier(index_type index) const
+        noexcept
+    {
+        return m_identifiers[index];
+    }
+
+    /*!
+     * \brief Fetches the outbound edges of a vertex.
+     * \param vertex The dense index of the vertex. Must be less than
+     *               vertexCount().
+     * \return The range of the outbound edges of the vertex, sorted by the
+     *         dense index of their target.
+     * \note Constant complexity, doesn't allocate. The edges are decoded
+     *       while iterating.
+     **/
+    PL_NODISCARD NeighborRange outboundEdges(index_type vertex) const noexcept
+    {
+        const std::uint8_t* first{m_bytes.data() + m_offsets[vertex]};
+        const std::uint8_t* last{m_bytes.data() + m_offsets[vertex + 1]};
+
+        return NeighborRange{
+            NeighborIterator{first, last, vertex, m_lengthQuantum},
+            NeighborIterator{last, last, vertex, m_lengthQuantum}};
+    }
+
+    /*!
+     * \brief Returns the outbound degree of a vertex.
+     * \param vertex The dense index of the vertex. Must be less than
+     *               vertexCount().
+     * \return The outbound degree of the vertex.
+     * \note Linear in the amount of bytes of the edges of the vertex, but
+     *       doesn't decode them: every edge consists of two varints, each
+     *       ending with a byte that has its high bit cleared.
+     **/
+    PL_NODISCARD size_type outboundDegree(index_type vertex) const noexcept
+    {
+        const std::uint8_t* first{m_bytes.data() + m_offsets[vertex]};
+        const std::uint8_t* last{m_bytes.data() + m_offsets[vertex + 1]};
+
+        return static_cast<size_type>(
+                   std::count_if(
+                       first,
+                       last,
+                       [](std::uint8_t byte) { return (byte & 0x80U) == 0; }))
+               / 2;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes held by this CompressedGraph.
+     * \return The bytes. The vertex identifiers count as vertices, the
+     *         encoded edges as edges and the offsets and the hash index as
+     *         indices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{
+            sizeof(this_type),
+            memory::usedBytes(m_identifiers),
+            memory::usedBytes(m_bytes),
+            memory::usedBytes(m_offsets) + memory::nodeBytes(m_indices),
+            memory::bucketBytes(m_indices),
+            memory::slackBytes(m_identifiers) + memory::slackBytes(m_offsets)
+                + memory::slackBytes(m_bytes)};
+    }
+
+private:
+    std::vector<vertex_identifier> m_identifiers; /*!< Index -> identifier */
+    std::unordered_map<vertex_identifier, index_type>
+                              m_indices; /*!< Identifier -> index */
+    std::vector<index_type>   m_offsets; /*!< Byte offsets per vertex */
+    std::vector<std::uint8_t> m_bytes;   /*!< The encoded edges */
+    size_type                 m_edgeCount;
+    length_type               m_lengthQuantum;
+};
+
+/*!
+ * \brief Deduction guide to compress a DirectedGraph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+CompressedGraph(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&,
+    LengthInvocable,
+    std::size_t = 1) -> CompressedGraph<VertexIdentifier>;
+} // namespace gp
+#endif // INCG_GP_COMPRESSED_GRAPH_HPP
@@ -0,0 +1,152 @@
+#ifndef INCG_GP_CONCURRENT_DIRECTED_GRAPH_HPP
+#define INCG_GP_CONCURRENT_DIRECTED_GRAPH_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include "graph_snapshot.hpp" // gp::GraphSnapshot
+#include <cstdint>            // std::uint64_t
+#include <memory>             // std::shared_ptr, std::atomic_load, ...
+#include <mutex>              // std::mutex, std::lock_guard
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/invoke.hpp>      // pl::invoke
+#include <utility>            // std::move
+
+namespace gp {
+/*!
+ * \brief A directed graph that can be read by many threads while it is
+ *        being modified.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam VertexData The type of the data stored on a vertex.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ *
+ * Publishes immutable versions of the graph (read-copy-update). Readers take
+ * a snapshot of the current version without blocking and keep working on it,
+ * while writers apply batches of mutations to a copy and atomically publish
+ * the copy as the next version. A version is freed once the last snapshot
+ * referring to it is gone.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+class ConcurrentDirectedGraph {
+public:
+    using this_type = ConcurrentDirectedGraph;
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using snapshot_type = GraphSnapshot<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>;
+
+    /*!
+     * \brief Creates a ConcurrentDirectedGraph publishing an empty graph as
+     *        version 0.
+     **/
+    ConcurrentDirectedGraph() : ConcurrentDirectedGraph{graph_type{}} {}
+
+    /*!
+     * \brief Creates a ConcurrentDirectedGraph publishing a graph as
+     *        version 0.
+     * \param graph The initial graph.
+     **/
+    explicit ConcurrentDirectedGraph(graph_type graph)
+        : m_writerMutex{}
+        , m_current{
+              std::make_shared<const Version>(Version{std::move(graph), 0})}
+    {
+    }
+
+    ConcurrentDirectedGraph(const this_type&) = delete;
+    this_type& operator=(const this_type&) = delete;
+
+    /*!
+     * \brief Takes a snapshot of the current version.
+     * \return The snapshot.
+     * \note Thread safe, never waits for writers.
+     **/
+    PL_NODISCARD snapshot_type snapshot() const
+    {
+        const std::shared_ptr<const Version> current{
+            std::atomic_load(&m_current)};
+
+        // Share ownership of the version, but point at the graph.
+        return snapshot_type{
+            std::shared_ptr<const graph_type>{current, &current->graph},
+            current->number};
+    }
+
+    /*!
+     * \brief Applies a batch of mutations and publishes the result as a new
+     *        version.
+     * \param mutation Unary invocable that is invoked with a graph_type& to
+     *                 a copy of the current version and applies the
+     *                 mutations to it.
+     * \return The snapshot of the version published.
+     * \note Thread safe. Writers are serialized, readers are never blocked.
+     *       Snapshots taken before see none of the mutations.
+     * \note Copies the graph, so mutations should be batched.
+     * \warning If mutation throws nothing is published.
+     **/
+    template<typename Mutation>
+    snapshot_type update(Mutation&& mutation)
+    {
+        const std::lock_guard<std::mutex> lock{m_writerMutex};
+
+        const std::shared_ptr<const Version> current{
+            std::atomic_load(&m_current)};
+        graph_type graph{current->graph};
+        pl::invoke(mutation, graph);
+
+        return publish(std::move(graph), current->number + 1);
+    }
+
+    /*!
+     * \brief Publishes a graph as a new version.
+     * \param graph The graph to publish.
+     * \return The snapshot of the version published.
+     * \note Thread safe.
+     **/
+    snapshot_type replace(graph_type graph)
+    {
+        const std::lock_guard<std::mutex> lock{m_writerMutex};
+
+        return publish(
+            std::move(graph), std::atomic_load(&m_current)->number + 1);
+    }
+
+private:
+    /*!
+     * \brief A published version.
+     **/
+    struct Version {
+        graph_type    graph;  /*!< The graph */
+        std::uint64_t number; /*!< The version number */
+    };
+
+    /*!
+     * \brief Publishes a graph as the current version.
+     * \param graph The graph.
+     * \param number The version number.
+     * \return The snapshot of the version published.
+     * \note m_writerMutex must be locked.
+     **/
+    snapshot_type publish(graph_type graph, std::uint64_t number)
+    {
+        const std::shared_ptr<const Version> next{
+            std::make_shared<const Version>(Version{std::move(graph), number})};
+        std::atomic_store(&m_current, next);
+
+        return snapshot_type{
+            std::shared_ptr<const graph_type>{next, &next->graph}, number};
+    }
+
+    std::mutex m_writerMutex; /*!< Serializes the writers */
+    std::shared_ptr<const Version>
+        m_current; /*!< The current version, accessed atomically */
+};
+} // namespace gp
+#endif // INCG_GP_CONCURRENT_DIRECTED_GRAPH_HPP
@@ -0,0 +1,69 @@
+#ifndef INCG_GP_DATA_STORAGE_HPP
+#define INCG_GP_DATA_STORAGE_HPP
+#include <ciso646>            // and, not
+#include <cstddef>            // std::nullptr_t
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <type_traits>        // std::enable_if_t, std::is_empty, std::is_final
+#include <utility>            // std::move, std::swap
+
+namespace gp {
+namespace detail {
+/*!
+ * \brief Stores the data of a vertex or an edge.
+ * \tparam Data The type of the data.
+ * \note Vertices and edges derive from DataStorage, so that the
+ *       specializations for tag types take no space thanks to the empty base
+ *       optimization.
+ **/
+template<typename Data, typename = void>
+class DataStorage {
+public:
+    explicit DataStorage(Data data) : m_data{std::move(data)} {}
+
+    PL_NODISCARD const Data& get() const noexcept { return m_data; }
+
+    void swap(DataStorage& other) noexcept
+    {
+        using std::swap;
+        swap(m_data, other.m_data);
+    }
+
+private:
+    Data m_data;
+};
+
+/*!
+ * \brief Stores empty class types as a base class, so they take no space.
+ **/
+template<typename Data>
+class DataStorage<
+    Data,
+    std::enable_if_t<
+        std::is_empty<Data>::value and not std::is_final<Data>::value>>
+    : private Data {
+public:
+    explicit DataStorage(Data data) : Data{std::move(data)} {}
+
+    PL_NODISCARD const Data& get() const noexcept { return *this; }
+
+    void swap(DataStorage&) noexcept {}
+};
+
+/*!
+ * \brief Doesn't store std::nullptr_t at all, as it only has one value.
+ **/
+template<>
+class DataStorage<std::nullptr_t> {
+public:
+    explicit DataStorage(std::nullptr_t) noexcept {}
+
+    PL_NODISCARD const std::nullptr_t& get() const noexcept { return s_data; }
+
+    void swap(DataStorage&) noexcept {}
+
+private:
+    static constexpr std::nullptr_t s_data{nullptr};
+};
+} // namespace detail
+} // namespace gp
+#endif // INCG_GP_DATA_STORAGE_HPP
@@ -1,19 +1,23 @@
 #ifndef INCG_GP_DIJKSTRA_ALGORITHM_HPP
 #define INCG_GP_DIJKSTRA_ALGORITHM_HPP
-#include "../directed_graph.hpp"         // gp::DirectedGraph
-#include "../shortest_paths.hpp"         // gp::ShortestPaths
-#include "insert.hpp"                    // gp::dijkstra::insert
-#include "vertex_with_priority.hpp"      // gp::dijkstra::VertexWithPriority
-#include <ciso646>                       // not
-#include <cstddef>                       // std::size_t
-#include <cstdint>                       // SIZE_MAX
-#include <pl/algo/ranged_algorithms.hpp> // pl::algo::find_if
-#include <pl/annotations.hpp>            // PL_NODISCARD
-#include <pl/invoke.hpp>                 // pl::invoke
-#include <tl/optional.hpp>               // tl::optional, tl::nullopt
-#include <unordered_map>                 // std::unordered_map
-#include <utility>                       // std::move
-#include <vector>                        // std::vector
+#include "../compact_graph.hpp"    // gp::CompactGraph
+#include "../compressed_graph.hpp" // gp::CompressedGraph
+#include "../directed_graph.hpp"   // gp::DirectedGraph
+#include "../graph_snapshot.hpp"   // gp::GraphSnapshot
+#include "../shortest_paths.hpp"   // gp::ShortestPaths
+#include "queue_kind.hpp"          // gp::dijkstra::QueueKind
+#include "search.hpp"              // gp::dijkstra::detail::search
+#include <ciso646>                 // not
+#include <cstddef>                 // std::size_t
+#include <cstdint>                 // SIZE_MAX
+#include <memory_resource>         // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>      // PL_NODISCARD
+#include <pl/except.hpp>           // PL_THROW_WITH_SOURCE_INFO
+#include <pl/invoke.hpp>           // pl::invoke
+#include <stdexcept>               // std::logic_error
+#include <tl/optional.hpp>         // tl::optional, tl::nullopt
+#include <utility>                 // std::move
+#include <vector>                  // std::pmr::vector
 
 namespace gp {
 namespace dijkstra {
@@ -36,6 +40,10 @@ namespace dijkstra {
  *                                                        EdgeData>::edge_type
  *                        and return the length of the given edge as an object
  *                        of type std::size_t.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param queueKind The priority queue to use. The default IndexedHeap runs in
+ *                  O((V + E) log V), SortedVector is kept for comparison.
  * \return The resulting ShortestPaths object.
  **/
 template<
@@ -46,111 +54,293 @@ template<
     typename LengthInvocable>
 PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> algorithm(
     const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                     graph,
-    VertexIdentifier source,
-    LengthInvocable  lengthInvocable)
+                               graph,
+    VertexIdentifier           source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
 {
     // Type aliases to cut down on the typing a little.
     using graph_type
         = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using vertex_type          = typename graph_type::vertex_type;
-    using edge_type            = typename graph_type::edge_type;
-    using vertex_with_priority = VertexWithPriority<VertexIdentifier>;
+    using index_type          = typename graph_type::index_type;
+    using edge_range          = typename graph_type::edge_range;
+    using shortest_paths_type = ShortestPaths<VertexIdentifier, std::size_t>;
 
     // Constants
-    constexpr std::size_t                infinity{SIZE_MAX};
-    const tl::optional<VertexIdentifier> undefined{tl::nullopt};
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    // The working state is kept in vectors indexed by the dense vertex
+    // indices of the graph.
+    const index_type indexBound{graph.vertexIndexBound()};
 
-    // Data structures
     // 'prev' associates vertices with their predecessors on the current
     // shortest path to them.
-    std::unordered_map<VertexIdentifier, tl::optional<VertexIdentifier>> prev{};
+    std::pmr::vector<tl::optional<index_type>> prev(
+        indexBound, tl::nullopt, resource);
 
     // 'dist' associates vertices with their distance (cost) values to get to
     // them from the source.
-    std::unordered_map<VertexIdentifier, std::size_t> dist{};
+    // The distance to all the vertices is considered to be 'infinity' for
+    // now, as it is unknown at this point.
+    std::pmr::vector<std::size_t> dist(indexBound, infinity, resource);
+
+    const tl::optional<index_type> sourceIndex{graph.vertexIndex(source)};
 
-    // The queue used by Dijkstra's algorithm.
-    std::vector<vertex_with_priority> q{};
+    if (sourceIndex.has_value()) {
+        detail::search(
+            queueKind,
+            *sourceIndex,
+            dist,
+            prev,
+            [&graph, &lengthInvocable](index_type u, auto&& relax) {
+                // Get the outbound edges of 'u'.
+                // We want to get to all the neighbors of 'u'.
+                // But we need to keep the edges around to query them for
+                // their length.
+                const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
 
-    // Initialization.
-    // The distance to the source is 0. (We're already there.)
-    dist[source] = 0;
+                for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                    relax(
+                        graph.endpointIndices(it).target,
+                        pl::invoke(lengthInvocable, *it));
+                }
+            },
+            detail::SettleAll{},
+            resource);
+    }
 
-    for (const vertex_type& v : graph.vertices()) {
-        const VertexIdentifier& identifier{v.identifier()};
+    // Translate the dense indices back to the vertex identifiers.
+    typename shortest_paths_type::prev_map_type prevMap{resource};
+    typename shortest_paths_type::dist_map_type distMap{resource};
+    prevMap.reserve(graph.vertexCount());
+    distMap.reserve(graph.vertexCount());
 
-        // If it ain't the source -> consider the distance to be 'infinity' for
-        // now. We consider the distance (cost) from source to 'v' to be unknown
-        // at this point.
-        if (identifier != source) { dist[identifier] = infinity; }
+    // The source is always reported, even if it isn't part of the graph.
+    distMap.emplace(source, 0);
 
-        // Set all the predecessor
-        prev[identifier] = undefined;
+    for (index_type v{0}; v < indexBound; ++v) {
+        if (not graph.hasVertexAt(v)) { continue; }
 
-        // Insert 'em all into the queue using their current distance value as
-        // the priority.
-        insert(q, vertex_with_priority{identifier, dist[identifier]});
+        const VertexIdentifier& identifier{graph.vertexAt(v).identifier()};
+        distMap[identifier] = dist[v];
+        prevMap.emplace(identifier, prev[v].map([&graph](index_type index) {
+            return graph.vertexAt(index).identifier();
+        }));
     }
-    // Done with the initialization.
-
-    // The main loop.
-    while (not q.empty()) {
-        // Get the best vertex.
-        const vertex_with_priority u{q.front()};
-        q.erase(q.begin()); // Remove it from the queue
-
-        // Get the outbound edges of the vertex that's the best one.
-        // We want to get to all the neighbors of 'u'.
-        // But we need to keep the edges around to query them for their length.
-        const std::vector<const edge_type*> outbounds{
-            graph.outboundEdges(u.vertex())};
-
-        for (const edge_type* edge : outbounds) {
-            // Get a neighbor of 'u'.
-            const VertexIdentifier& target{edge->target()};
-
-            // Try to get an iterator to the neighbor in the queue.
-            const auto targetIterator{pl::algo::find_if(
-                q, [&target](const vertex_with_priority& vertexWithPriority) {
-                    return vertexWithPriority.vertex() == target;
-                })};
-
-            // If target is not in q -> skip it. We only care about neighbors of
-            // 'u' that are still in q.
-            if (targetIterator == q.end()) { continue; }
-
-            // Calculate the alternative distance, which is the distance to 'u'
-            // plus the edge that connects 'u' to the neighbor vertex of 'u'
-            // that we're handling.
-            const std::size_t alt{dist[u.vertex()]
-                                  + pl::invoke(lengthInvocable, *edge)};
-
-            // Get the distance to the neighbor.
-            const std::size_t distanceNeighbor{dist[target]};
-
-            // If the alternative distance is cheaper
-            if (alt < distanceNeighbor) {
-                dist[target] = alt; // It's cheaper, use the alternative
-                                    // distance reaching the neighbor over 'u'
-                                    // with the connecting edge between 'em.
-                prev[target]
-                    = u.vertex(); // Update the previous vertex to be 'u'.
-
-                q.erase(targetIterator); // Temporarily remove the neighbor from
-                                         // the queue
-                insert(
-                    q,
-                    vertex_with_priority{target,
-                                         alt}); // Add it again using the new
-                                                // distance as the new priority.
+
+    // We're done here now.
+    return shortest_paths_type{
+        std::move(source), std::move(prevMap), std::move(distMap)};
+}
+
+/*!
+ * \brief Dijkstra's algorithm operating on a snapshot of a directed graph.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the directed graph to operate on.
+ * \tparam VertexData The type of the data that is stored on a vertex.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the directed graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param snapshot The snapshot to perform Dijkstra's algorithm on, as taken
+ *                 from a ConcurrentDirectedGraph.
+ * \param source The source vertex to use.
+ * \param lengthInvocable A unary invocable that shall take an lvalue reference
+ *                        to const typename DirectedGraph<VertexIdentifier,
+ *                                                        VertexData,
+ *                                                        EdgeIdentifier,
+ *                                                        EdgeData>::edge_type
+ *                        and return the length of the given edge as an object
+ *                        of type std::size_t.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param queueKind The priority queue to use.
+ * \return The resulting ShortestPaths object.
+ * \note Sees the version of the graph of the snapshot, regardless of what is
+ *       published while the algorithm runs.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> algorithm(
+    const GraphSnapshot<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                               snapshot,
+    VertexIdentifier           source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
+{
+    return algorithm(
+        snapshot.graph(),
+        std::move(source),
+        std::move(lengthInvocable),
+        resource,
+        queueKind);
+}
+
+/*!
+ * \brief Dijkstra's algorithm operating on a CompactGraph.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the graph to operate on.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param graph The graph to perform Dijkstra's algorithm on.
+ * \param source The source vertex to use.
+ * \param lengthInvocable A unary invocable that shall take an lvalue reference
+ *                        to const typename CompactGraph<VertexIdentifier,
+ *                                                       EdgeIdentifier,
+ *                                                       EdgeData>::
+ *                        EdgeReference and return the length of the given
+ *                        edge as an object of type std::size_t.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param queueKind The priority queue to use.
+ * \return The resulting ShortestPaths object.
+ * \note Keeps the working state in flat vectors indexed by the dense vertex
+ *       indices of the graph and yields the same result as the
+ *       DirectedGraph overload, also if source is not a vertex of graph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> algorithm(
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph,
+    VertexIdentifier                                                source,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
+{
+    using graph_type = CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+    using index_type = typename graph_type::index_type;
+
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    const tl::optional<index_type> sourceIndex{graph.index(source)};
+    const std::size_t              vertexCount{graph.vertexCount()};
+
+    std::pmr::vector<std::size_t> dist(vertexCount, infinity, resource);
+    std::pmr::vector<tl::optional<index_type>> prev(
+        vertexCount, tl::nullopt, resource);
+
+    if (sourceIndex.has_value()) {
+        detail::search(
+            queueKind,
+            *sourceIndex,
+            dist,
+            prev,
+            [&graph, &lengthInvocable](index_type u, auto&& relax) {
+                for (const typename graph_type::EdgeReference edge :
+                     graph.outboundEdges(u)) {
+                    relax(
+                        edge.targetIndex(), pl::invoke(lengthInvocable, edge));
+                }
+            },
+            detail::SettleAll{},
+            resource);
+    }
+
+    // Translate the dense indices back to the vertex identifiers.
+    typename ShortestPaths<VertexIdentifier, std::size_t>::prev_map_type
+        prevMap{resource};
+    typename ShortestPaths<VertexIdentifier, std::size_t>::dist_map_type
+        distMap{resource};
+    prevMap.reserve(vertexCount);
+    distMap.reserve(vertexCount);
+
+    // The source is always reported, even if it isn't part of the graph.
+    distMap.emplace(source, 0);
+
+    for (index_type v{0}; v < vertexCount; ++v) {
+        const VertexIdentifier& identifier{graph.identifier(v)};
+        distMap[identifier] = dist[v];
+        prevMap.emplace(identifier, prev[v].map([&graph](index_type index) {
+            return graph.identifier(index);
+        }));
+    }
+
+    return ShortestPaths<VertexIdentifier, std::size_t>{
+        std::move(source), std::move(prevMap), std::move(distMap)};
+}
+
+/*!
+ * \brief Dijkstra's algorithm operating on a CompressedGraph.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the graph to operate on.
+ * \param graph The graph to perform Dijkstra's algorithm on.
+ * \param source The source vertex to use.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param queueKind The priority queue to use.
+ * \return The resulting ShortestPaths object.
+ * \throws std::logic_error if source is not a vertex of graph.
+ * \note Uses the (quantized) lengths stored in the graph, decoding the
+ *       outbound edges of every vertex settled once.
+ **/
+template<typename VertexIdentifier>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> algorithm(
+    const CompressedGraph<VertexIdentifier>& graph,
+    VertexIdentifier                         source,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
+{
+    using graph_type    = CompressedGraph<VertexIdentifier>;
+    using index_type    = typename graph_type::index_type;
+    using neighbor_type = typename graph_type::Neighbor;
+
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    const tl::optional<index_type> sourceIndex{graph.index(source)};
+
+    if (not sourceIndex.has_value()) {
+        PL_THROW_WITH_SOURCE_INFO(
+            std::logic_error, "source is not a vertex of the graph");
+    }
+
+    const std::size_t vertexCount{graph.vertexCount()};
+
+    std::pmr::vector<std::size_t> dist(vertexCount, infinity, resource);
+    std::pmr::vector<tl::optional<index_type>> prev(
+        vertexCount, tl::nullopt, resource);
+
+    detail::search(
+        queueKind,
+        *sourceIndex,
+        dist,
+        prev,
+        [&graph](index_type u, auto&& relax) {
+            for (const neighbor_type& neighbor : graph.outboundEdges(u)) {
+                relax(neighbor.target, neighbor.length);
             }
-        }
+        },
+        detail::SettleAll{},
+        resource);
+
+    // Translate the dense indices back to the vertex identifiers.
+    typename ShortestPaths<VertexIdentifier, std::size_t>::prev_map_type
+        prevMap{resource};
+    typename ShortestPaths<VertexIdentifier, std::size_t>::dist_map_type
+        distMap{resource};
+    prevMap.reserve(vertexCount);
+    distMap.reserve(vertexCount);
+
+    for (index_type v{0}; v < vertexCount; ++v) {
+        const VertexIdentifier& identifier{graph.identifier(v)};
+        distMap.emplace(identifier, dist[v]);
+        prevMap.emplace(identifier, prev[v].map([&graph](index_type index) {
+            return graph.identifier(index);
+        }));
     }
 
-    // We're done here now.
     return ShortestPaths<VertexIdentifier, std::size_t>{
-        std::move(source), std::move(prev), std::move(dist)};
+        std::move(source), std::move(prevMap), std::move(distMap)};
 }
 } // namespace dijkstra
 } // namespace gp
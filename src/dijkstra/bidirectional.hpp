@@ -0,0 +1,266 @@
+#ifndef INCG_GP_DIJKSTRA_BIDIRECTIONAL_HPP
+#define INCG_GP_DIJKSTRA_BIDIRECTIONAL_HPP
+#include "../directed_graph.hpp" // gp::DirectedGraph
+#include "../shortest_paths.hpp" // gp::ShortestPaths
+#include "indexed_heap.hpp"      // gp::dijkstra::IndexedHeap
+#include "search_statistics.hpp" // gp::dijkstra::SearchStatistics
+#include <algorithm>             // std::reverse
+#include <ciso646>               // not, or, and
+#include <cstddef>               // std::size_t
+#include <cstdint>               // SIZE_MAX
+#include <memory_resource>       // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>    // PL_NODISCARD
+#include <pl/invoke.hpp>         // pl::invoke
+#include <tl/optional.hpp>       // tl::optional, tl::nullopt
+#include <utility>               // std::move
+#include <vector>                // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Bidirectional Dijkstra's algorithm. Calculates the shortest path
+ *        from a source vertex to a target vertex.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the directed graph to operate on.
+ * \tparam VertexData The type of the data that is stored on a vertex.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the directed graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param graph The directed graph to operate on.
+ * \param source The source vertex to use.
+ * \param target The target vertex to use.
+ * \param lengthInvocable See algorithm.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param statistics Receives the amount of vertices settled by both
+ *                   searches, if not null.
+ * \return The resulting ShortestPaths object. Only holds the vertices on the
+ *         shortest path to the target, or the target at an infinite distance
+ *         if it can't be reached.
+ *
+ * Runs a forward search from the source over the outbound edges and a
+ * backward search from the target over the inbound edges, always advancing
+ * the one with the smaller queue. Every edge relaxed that connects the two
+ * searches yields a path; mu is the length of the shortest one found. Once
+ * the lowest priorities of both queues add up to at least mu no shorter path
+ * can be found, which usually happens after settling far fewer vertices
+ * than a unidirectional search does for distant targets.
+ * \note Yields the same distance as algorithm and, if the shortest path is
+ *       unique, the same path. Cycles of edges of length 0 must not occur.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> bidirectional(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                               graph,
+    VertexIdentifier           source,
+    VertexIdentifier           target,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource   = std::pmr::get_default_resource(),
+    SearchStatistics*          statistics = nullptr)
+{
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using index_type          = typename graph_type::index_type;
+    using edge_range          = typename graph_type::edge_range;
+    using shortest_paths_type = ShortestPaths<VertexIdentifier, std::size_t>;
+    using queue_type          = IndexedHeap<index_type>;
+
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    typename shortest_paths_type::prev_map_type prevMap{resource};
+    typename shortest_paths_type::dist_map_type distMap{resource};
+
+    // The source is always reported, even if it isn't part of the graph.
+    distMap.emplace(source, 0);
+    prevMap.emplace(source, tl::nullopt);
+
+    if (statistics != nullptr) { statistics->settledVertices = 0; }
+
+    const tl::optional<index_type> sourceIndex{graph.vertexIndex(source)};
+    const tl::optional<index_type> targetIndex{graph.vertexIndex(target)};
+
+    if ((not sourceIndex.has_value()) or (not targetIndex.has_value())
+        or (*sourceIndex == *targetIndex)) {
+        if (targetIndex.has_value() and (not sourceIndex.has_value())) {
+            distMap.emplace(target, infinity);
+            prevMap.emplace(target, tl::nullopt);
+        }
+
+        return shortest_paths_type{
+            std::move(source), std::move(prevMap), std::move(distMap)};
+    }
+
+    const index_type indexBound{graph.vertexIndexBound()};
+
+    // The state of the forward search: the distances from the source, the
+    // predecessors and the lengths of the edges from them.
+    std::pmr::vector<std::size_t> forwardDist(indexBound, infinity, resource);
+    std::pmr::vector<index_type>  forwardPrev(indexBound, 0, resource);
+    std::pmr::vector<std::size_t> forwardLength(indexBound, 0, resource);
+    std::pmr::vector<bool>        forwardSettled(indexBound, false, resource);
+    queue_type                    forwardQueue{indexBound, resource};
+
+    // The state of the backward search: the distances to the target, the
+    // successors and the lengths of the edges to them.
+    std::pmr::vector<std::size_t> backwardDist(indexBound, infinity, resource);
+    std::pmr::vector<index_type>  backwardNext(indexBound, 0, resource);
+    std::pmr::vector<std::size_t> backwardLength(indexBound, 0, resource);
+    std::pmr::vector<bool>        backwardSettled(indexBound, false, resource);
+    queue_type                    backwardQueue{indexBound, resource};
+
+    // The length of the shortest path found so far and the edge over which
+    // it crosses from the forward to the backward search.
+    std::size_t mu{infinity};
+    index_type  meetTail{0};
+    index_type  meetHead{0};
+    std::size_t meetLength{0};
+
+    // Considers the path over the edge from tail to head.
+    const auto connect
+        = [&](index_type tail, index_type head, std::size_t length) {
+              if ((forwardDist[tail] == infinity)
+                  or (backwardDist[head] == infinity)) {
+                  return;
+              }
+
+              const std::size_t candidate{
+                  forwardDist[tail] + length + backwardDist[head]};
+
+              if (candidate < mu) {
+                  mu         = candidate;
+                  meetTail   = tail;
+                  meetHead   = head;
+                  meetLength = length;
+              }
+          };
+
+    forwardDist[*sourceIndex] = 0;
+    forwardQueue.push(*sourceIndex, 0);
+    backwardDist[*targetIndex] = 0;
+    backwardQueue.push(*targetIndex, 0);
+
+    std::size_t settledCount{0};
+
+    while ((not forwardQueue.empty()) and (not backwardQueue.empty())) {
+        // Neither search can improve on mu anymore.
+        if (forwardQueue.top().priority() + backwardQueue.top().priority()
+            >= mu) {
+            break;
+        }
+
+        ++settledCount;
+
+        if (forwardQueue.size() <= backwardQueue.size()) {
+            const index_type u{forwardQueue.pop().vertex()};
+            forwardSettled[u] = true;
+
+            const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+            for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                const index_type  v{graph.endpointIndices(it).target};
+                const std::size_t length{pl::invoke(lengthInvocable, *it)};
+                const std::size_t alt{forwardDist[u] + length};
+
+                if ((not forwardSettled[v]) and (alt < forwardDist[v])) {
+                    forwardDist[v]   = alt;
+                    forwardPrev[v]   = u;
+                    forwardLength[v] = length;
+
+                    if (forwardQueue.contains(v)) {
+                        forwardQueue.decreaseKey(v, alt);
+                    }
+                    else {
+                        forwardQueue.push(v, alt);
+                    }
+                }
+
+                connect(u, v, length);
+            }
+        }
+        else {
+            const index_type v{backwardQueue.pop().vertex()};
+            backwardSettled[v] = true;
+
+            const edge_range inbounds{graph.inboundEdgeRangeAt(v)};
+
+            for (auto it{inbounds.begin()}; it != inbounds.end(); ++it) {
+                const index_type  u{graph.endpointIndices(it).source};
+                const std::size_t length{pl::invoke(lengthInvocable, *it)};
+                const std::size_t alt{backwardDist[v] + length};
+
+                if ((not backwardSettled[u]) and (alt < backwardDist[u])) {
+                    backwardDist[u]   = alt;
+                    backwardNext[u]   = v;
+                    backwardLength[u] = length;
+
+                    if (backwardQueue.contains(u)) {
+                        backwardQueue.decreaseKey(u, alt);
+                    }
+                    else {
+                        backwardQueue.push(u, alt);
+                    }
+                }
+
+                connect(u, v, length);
+            }
+        }
+    }
+
+    if (statistics != nullptr) { statistics->settledVertices = settledCount; }
+
+    if (mu == infinity) {
+        distMap.emplace(target, infinity);
+        prevMap.emplace(target, tl::nullopt);
+        return shortest_paths_type{
+            std::move(source), std::move(prevMap), std::move(distMap)};
+    }
+
+    // Assemble the path: the forward tree from the source to the tail of the
+    // meeting edge, then the backward tree from its head to the target. The
+    // distances are summed up along the path, as the labels of the vertices
+    // that weren't settled may be stale.
+    std::pmr::vector<index_type>  path{resource};
+    std::pmr::vector<std::size_t> lengths{resource};
+
+    for (index_type v{meetTail}; v != *sourceIndex; v = forwardPrev[v]) {
+        path.push_back(v);
+        lengths.push_back(forwardLength[v]);
+    }
+
+    path.push_back(*sourceIndex);
+    lengths.push_back(0);
+    std::reverse(path.begin(), path.end());
+    std::reverse(lengths.begin(), lengths.end());
+
+    path.push_back(meetHead);
+    lengths.push_back(meetLength);
+
+    for (index_type v{meetHead}; v != *targetIndex; v = backwardNext[v]) {
+        path.push_back(backwardNext[v]);
+        lengths.push_back(backwardLength[v]);
+    }
+
+    const auto identifierAt = [&graph](index_type index) {
+        return graph.vertexAt(index).identifier();
+    };
+
+    std::size_t distance{0};
+
+    for (std::size_t i{1}; i < path.size(); ++i) {
+        distance += lengths[i];
+        distMap[identifierAt(path[i])] = distance;
+        prevMap[identifierAt(path[i])] = identifierAt(path[i - 1]);
+    }
+
+    return shortest_paths_type{
+        std::move(source), std::move(prevMap), std::move(distMap)};
+}
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_BIDIRECTIONAL_HPP
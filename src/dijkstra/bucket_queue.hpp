@@ -0,0 +1,210 @@
+#ifndef INCG_GP_DIJKSTRA_BUCKET_QUEUE_HPP
+#define INCG_GP_DIJKSTRA_BUCKET_QUEUE_HPP
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <ciso646>                  // not, and
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <pl/assert.hpp>            // PL_ASSERT
+#include <pl/except.hpp>            // PL_THROW_WITH_SOURCE_INFO
+#include <stdexcept>                // std::length_error
+#include <vector>                   // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Dial's bucket queue of dense vertex indices, used by Dijkstra's
+ *        algorithm on graphs with small integer edge lengths.
+ * \tparam Index The type of the dense vertex indices.
+ *
+ * Dijkstra's algorithm only queues priorities in the window
+ * [d, d + maxLength], where d is the priority popped last. The queue keeps
+ * a circular array of maxLength + 1 buckets, one per priority in the
+ * window, so push and decreaseKey take constant time and pop takes time
+ * linear in the amount of empty buckets skipped. A run of Dijkstra's
+ * algorithm takes O(V + E + D), where D is the largest distance.
+ * \warning The priorities must be monotone: a priority pushed must not be
+ *          less than the one popped last nor exceed it by more than
+ *          maxLength.
+ **/
+template<typename Index>
+class BucketQueue {
+public:
+    using this_type            = BucketQueue;
+    using index_type           = Index;
+    using size_type            = std::size_t;
+    using vertex_with_priority = VertexWithPriority<index_type>;
+
+    /*!
+     * \brief Creates an empty queue.
+     * \param indexBound One past the largest dense vertex index to be pushed.
+     * \param maxLength The largest edge length of the graph.
+     * \param resource The memory resource to allocate from.
+     * \throws std::length_error if maxLength is SIZE_MAX, as the window
+     *                           would need more buckets than can be counted.
+     **/
+    BucketQueue(
+        size_type                  indexBound,
+        std::size_t                maxLength,
+        std::pmr::memory_resource* resource)
+        : m_buckets(bucketCount(maxLength), resource)
+        , m_positions(indexBound, npos, resource)
+        , m_priorities(indexBound, 0, resource)
+        , m_current{0}
+        , m_size{0}
+    {
+    }
+
+    /*!
+     * \brief Checks whether the queue is empty.
+     * \return true if no vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool empty() const noexcept { return m_size == 0; }
+
+    /*!
+     * \brief Returns the amount of vertices queued.
+     * \return The amount of vertices queued.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_size; }
+
+    /*!
+     * \brief Checks whether a vertex is queued.
+     * \param vertex The dense index of the vertex.
+     * \return true if the vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool contains(index_type vertex) const noexcept
+    {
+        return m_positions[vertex] != npos;
+    }
+
+    /*!
+     * \brief Queues a vertex.
+     * \param vertex The dense index of the vertex, must not be queued.
+     * \param priority The priority, lower priorities are popped first.
+     **/
+    void push(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(not contains(vertex));
+        PL_ASSERT(
+            (priority >= m_current)
+            and (priority - m_current < m_buckets.size()));
+        std::pmr::vector<index_type>& bucket{bucketOf(priority)};
+        m_positions[vertex]  = bucket.size();
+        m_priorities[vertex] = priority;
+        bucket.push_back(vertex);
+        ++m_size;
+    }
+
+    /*!
+     * \brief Lowers the priority of a queued vertex.
+     * \param vertex The dense index of the vertex, must be queued.
+     * \param priority The new priority, must not be greater than the current
+     *                 one.
+     **/
+    void decreaseKey(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(contains(vertex));
+        PL_ASSERT(priority <= m_priorities[vertex]);
+        remove(vertex);
+        push(vertex, priority);
+    }
+
+    /*!
+     * \brief Removes a vertex with the lowest priority.
+     * \return The vertex with its priority.
+     * \note The queue must not be empty.
+     **/
+    vertex_with_priority pop() noexcept
+    {
+        PL_ASSERT(not empty());
+
+        while (bucketOf(m_current).empty()) { ++m_current; }
+
+        const index_type vertex{bucketOf(m_current).back()};
+        remove(vertex);
+        return vertex_with_priority{vertex, m_current};
+    }
+
+    /*!
+     * \brief Removes all the vertices, so that any priority up to
+     *        maxLength() may be pushed again.
+     * \note Linear in the amount of vertices queued and the buckets between
+     *       their priorities.
+     **/
+    void clear() noexcept
+    {
+        while (not empty()) { (void)pop(); }
+
+        m_current = 0;
+    }
+
+    /*!
+     * \brief Returns the largest edge length the window covers.
+     * \return The amount of buckets minus 1.
+     **/
+    PL_NODISCARD std::size_t maxLength() const noexcept
+    {
+        return m_buckets.size() - 1;
+    }
+
+private:
+    /*!
+     * \brief Marks the vertices that aren't queued.
+     **/
+    static constexpr size_type npos{SIZE_MAX};
+
+    /*!
+     * \brief Determines the amount of buckets the window takes.
+     * \param maxLength The largest edge length of the graph.
+     * \return maxLength + 1.
+     * \throws std::length_error if maxLength is SIZE_MAX.
+     **/
+    PL_NODISCARD static size_type bucketCount(std::size_t maxLength)
+    {
+        if (maxLength == SIZE_MAX) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::length_error, "maxLength is too large for the buckets");
+        }
+
+        return maxLength + 1;
+    }
+
+    /*!
+     * \brief Fetches the bucket of a priority within the window.
+     * \param priority The priority.
+     * \return The bucket.
+     **/
+    PL_NODISCARD std::pmr::vector<index_type>& bucketOf(
+        std::size_t priority) noexcept
+    {
+        return m_buckets[priority % m_buckets.size()];
+    }
+
+    /*!
+     * \brief Removes a queued vertex from its bucket.
+     * \param vertex The dense index of the vertex.
+     **/
+    void remove(index_type vertex) noexcept
+    {
+        std::pmr::vector<index_type>& bucket{bucketOf(m_priorities[vertex])};
+        const size_type               position{m_positions[vertex]};
+
+        // Move the last vertex of the bucket into the gap.
+        bucket[position]           = bucket.back();
+        m_positions[bucket.back()] = position;
+        bucket.pop_back();
+        m_positions[vertex] = npos;
+        --m_size;
+    }
+
+    std::pmr::vector<std::pmr::vector<index_type>>
+        m_buckets; /*!< The circular array of buckets */
+    std::pmr::vector<size_type> m_positions; /*!< Vertex -> bucket position */
+    std::pmr::vector<std::size_t> m_priorities; /*!< Vertex -> priority */
+    std::size_t m_current; /*!< The lowest priority that may be queued */
+    size_type   m_size;    /*!< The amount of vertices queued */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_BUCKET_QUEUE_HPP
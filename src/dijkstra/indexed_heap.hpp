@@ -0,0 +1,224 @@
+#ifndef INCG_GP_DIJKSTRA_INDEXED_HEAP_HPP
+#define INCG_GP_DIJKSTRA_INDEXED_HEAP_HPP
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <ciso646>                  // not
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <pl/assert.hpp>            // PL_ASSERT
+#include <vector>                   // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Indexed d-ary min-heap of dense vertex indices, used by Dijkstra's
+ *        algorithm.
+ * \tparam Index The type of the dense vertex indices.
+ * \tparam Arity The amount of children of every node, must be at least 2.
+ *
+ * Keeps the position of every vertex in the heap in a vector indexed by the
+ * dense vertex index, so the priority of a queued vertex can be decreased
+ * in place. push, pop and decreaseKey take O(log n) steps. An arity of 4
+ * makes the heap shallower than a binary heap and keeps the children of a
+ * node within a cache line.
+ **/
+template<typename Index, std::size_t Arity = 4>
+class IndexedHeap {
+public:
+    static_assert(Arity >= 2, "A heap needs at least two children per node.");
+
+    using this_type            = IndexedHeap;
+    using index_type           = Index;
+    using size_type            = std::size_t;
+    using vertex_with_priority = VertexWithPriority<index_type>;
+
+    /*!
+     * \brief Creates an empty heap.
+     * \param indexBound One past the largest dense vertex index to be pushed.
+     * \param resource The memory resource to allocate from.
+     **/
+    IndexedHeap(size_type indexBound, std::pmr::memory_resource* resource)
+        : m_heap{resource}, m_positions(indexBound, npos, resource)
+    {
+    }
+
+    /*!
+     * \brief Checks whether the heap is empty.
+     * \return true if no vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool empty() const noexcept { return m_heap.empty(); }
+
+    /*!
+     * \brief Returns the amount of vertices queued.
+     * \return The amount of vertices queued.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_heap.size(); }
+
+    /*!
+     * \brief Checks whether a vertex is queued.
+     * \param vertex The dense index of the vertex.
+     * \return true if the vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool contains(index_type vertex) const noexcept
+    {
+        return m_positions[vertex] != npos;
+    }
+
+    /*!
+     * \brief Accesses the vertex with the lowest priority.
+     * \return The vertex with its priority.
+     * \note The heap must not be empty.
+     **/
+    PL_NODISCARD const vertex_with_priority& top() const noexcept
+    {
+        PL_ASSERT(not empty());
+        return m_heap.front();
+    }
+
+    /*!
+     * \brief Queues a vertex.
+     * \param vertex The dense index of the vertex, must not be queued.
+     * \param priority The priority, lower priorities are popped first.
+     **/
+    void push(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(not contains(vertex));
+        m_heap.emplace_back(vertex, priority);
+        m_positions[vertex] = m_heap.size() - 1;
+        siftUp(m_heap.size() - 1);
+    }
+
+    /*!
+     * \brief Lowers the priority of a queued vertex.
+     * \param vertex The dense index of the vertex, must be queued.
+     * \param priority The new priority, must not be greater than the current
+     *                 one.
+     **/
+    void decreaseKey(index_type vertex, std::size_t priority) noexcept
+    {
+        PL_ASSERT(contains(vertex));
+        const size_type position{m_positions[vertex]};
+        PL_ASSERT(priority <= m_heap[position].priority());
+        m_heap[position] = vertex_with_priority{vertex, priority};
+        siftUp(position);
+    }
+
+    /*!
+     * \brief Removes the vertex with the lowest priority.
+     * \return The vertex with its priority.
+     * \note The heap must not be empty.
+     **/
+    vertex_with_priority pop() noexcept
+    {
+        PL_ASSERT(not empty());
+        const vertex_with_priority top{m_heap.front()};
+        m_positions[top.vertex()] = npos;
+
+        if (m_heap.size() > 1) {
+            m_heap.front() = m_heap.back();
+            m_heap.pop_back();
+            m_positions[m_heap.front().vertex()] = 0;
+            siftDown(0);
+        }
+        else {
+            m_heap.pop_back();
+        }
+
+        return top;
+    }
+
+    /*!
+     * \brief Removes all the vertices.
+     * \note Linear in the amount of vertices queued, so the heap can be
+     *       reused for another search without refilling the positions.
+     **/
+    void clear() noexcept
+    {
+        for (const vertex_with_priority& element : m_heap) {
+            m_positions[element.vertex()] = npos;
+        }
+
+        m_heap.clear();
+    }
+
+private:
+    /*!
+     * \brief Marks the vertices that aren't queued.
+     **/
+    static constexpr size_type npos{SIZE_MAX};
+
+    /*!
+     * \brief Moves an element towards the root until its parent has a
+     *        priority not greater than its own.
+     * \param position The position of the element.
+     **/
+    void siftUp(size_type position) noexcept
+    {
+        const vertex_with_priority element{m_heap[position]};
+
+        while (position > 0) {
+            const size_type parent{(position - 1) / Arity};
+
+            if (m_heap[parent].priority() <= element.priority()) { break; }
+
+            place(position, m_heap[parent]);
+            position = parent;
+        }
+
+        place(position, element);
+    }
+
+    /*!
+     * \brief Moves an element towards the leaves until none of its children
+     *        has a lower priority.
+     * \param position The position of the element.
+     **/
+    void siftDown(size_type position) noexcept
+    {
+        const vertex_with_priority element{m_heap[position]};
+
+        for (;;) {
+            const size_type firstChild{(position * Arity) + 1};
+
+            if (firstChild >= m_heap.size()) { break; }
+
+            const size_type lastChild{
+                (firstChild + Arity < m_heap.size()) ? firstChild + Arity
+                                                     : m_heap.size()};
+            size_type best{firstChild};
+
+            for (size_type child{firstChild + 1}; child < lastChild; ++child) {
+                if (m_heap[child].priority() < m_heap[best].priority()) {
+                    best = child;
+                }
+            }
+
+            if (element.priority() <= m_heap[best].priority()) { break; }
+
+            place(position, m_heap[best]);
+            position = best;
+        }
+
+        place(position, element);
+    }
+
+    /*!
+     * \brief Stores an element at a position and records the position.
+     * \param position The position.
+     * \param element The element.
+     **/
+    void place(
+        size_type                   position,
+        const vertex_with_priority& element) noexcept
+    {
+        m_heap[position]              = element;
+        m_positions[element.vertex()] = position;
+    }
+
+    std::pmr::vector<vertex_with_priority> m_heap; /*!< The d-ary heap */
+    std::pmr::vector<size_type> m_positions; /*!< Vertex -> heap position */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_INDEXED_HEAP_HPP
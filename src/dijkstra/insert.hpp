@@ -12,15 +12,16 @@ namespace dijkstra {
  * \tparam VertexIdentifier The type of the unique identifiers
  *                          used in the directed graph for the
  *                          vertices.
+ * \tparam Allocator The allocator type of the queue.
  * \param q The queue to insert into.
  * \param toInsert The vertex with priority to insert into the queue.
  * \warning The program is ill-formed if the 'q' given is not sorted
  *          in ascending order of the priority values!
  **/
-template<typename VertexIdentifier>
+template<typename VertexIdentifier, typename Allocator>
 void insert(
-    std::vector<VertexWithPriority<VertexIdentifier>>& q,
-    VertexWithPriority<VertexIdentifier>               toInsert)
+    std::vector<VertexWithPriority<VertexIdentifier>, Allocator>& q,
+    VertexWithPriority<VertexIdentifier>                          toInsert)
 {
     // Assuming the queue is already sorted according to the criterion
     // find the insertion point for 'toInsert'.
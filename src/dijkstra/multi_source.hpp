@@ -0,0 +1,177 @@
+#ifndef INCG_GP_DIJKSTRA_MULTI_SOURCE_HPP
+#define INCG_GP_DIJKSTRA_MULTI_SOURCE_HPP
+#include "../directed_graph.hpp"    // gp::DirectedGraph
+#include "../nearest_sources.hpp"   // gp::NearestSources
+#include "queue_kind.hpp"           // gp::dijkstra::QueueKind
+#include "search.hpp"               // gp::dijkstra::detail::search
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <ciso646>                  // not
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <pl/invoke.hpp>            // pl::invoke
+#include <tl/optional.hpp>          // tl::optional, tl::nullopt
+#include <utility>                  // std::pair, std::move
+#include <vector>                   // std::pmr::vector, std::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Dijkstra's algorithm from several sources at once. Calculates the
+ *        distance from every vertex to its nearest source.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the directed graph to operate on.
+ * \tparam VertexData The type of the data that is stored on a vertex.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the directed graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param graph The directed graph to perform Dijkstra's algorithm on.
+ * \param sources The source vertices, each with the distance to start it
+ *                at. Sources that aren't part of the graph are ignored; for
+ *                a source given more than once the lowest offset is used.
+ * \param lengthInvocable See algorithm.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \param queueKind The priority queue to use.
+ * \return The resulting NearestSources object, holding every vertex of the
+ *         graph.
+ * \note Queues all the sources before the first vertex is settled, so a
+ *       single run costs about as much as a run from one source, rather
+ *       than one per source. A source reached more cheaply from another
+ *       source than its own offset belongs to the other source.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD NearestSources<VertexIdentifier, std::size_t> nearestSources(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                                              graph,
+    const std::vector<std::pair<VertexIdentifier, std::size_t>>& sources,
+    LengthInvocable                                           lengthInvocable,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
+{
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using index_type           = typename graph_type::index_type;
+    using edge_range           = typename graph_type::edge_range;
+    using nearest_sources_type = NearestSources<VertexIdentifier, std::size_t>;
+
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    const index_type indexBound{graph.vertexIndexBound()};
+
+    std::pmr::vector<tl::optional<index_type>> prev(
+        indexBound, tl::nullopt, resource);
+    std::pmr::vector<std::size_t> dist(indexBound, infinity, resource);
+
+    std::pmr::vector<VertexWithPriority<index_type>> seeds{resource};
+    seeds.reserve(sources.size());
+
+    for (const std::pair<VertexIdentifier, std::size_t>& source : sources) {
+        const tl::optional<index_type> index{graph.vertexIndex(source.first)};
+
+        if (index.has_value()) { seeds.emplace_back(*index, source.second); }
+    }
+
+    // The vertices settled, in the order they were settled in, so that every
+    // vertex comes after its predecessor.
+    std::pmr::vector<index_type> settled{resource};
+    settled.reserve(graph.vertexCount());
+
+    detail::search(
+        queueKind,
+        seeds,
+        dist,
+        prev,
+        [&graph, &lengthInvocable](index_type u, auto&& relax) {
+            const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+            for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                relax(
+                    graph.endpointIndices(it).target,
+                    pl::invoke(lengthInvocable, *it));
+            }
+        },
+        [&settled](index_type u) {
+            settled.push_back(u);
+            return false;
+        },
+        resource);
+
+    // A vertex belongs to the source its predecessor belongs to, the sources
+    // themselves have no predecessor.
+    std::pmr::vector<index_type> owner(indexBound, 0, resource);
+
+    for (index_type v : settled) {
+        owner[v] = prev[v].has_value() ? owner[*prev[v]] : v;
+    }
+
+    // Translate the dense indices back to the vertex identifiers.
+    typename nearest_sources_type::prev_map_type   prevMap{resource};
+    typename nearest_sources_type::dist_map_type   distMap{resource};
+    typename nearest_sources_type::source_map_type sourceMap{resource};
+    prevMap.reserve(graph.vertexCount());
+    distMap.reserve(graph.vertexCount());
+    sourceMap.reserve(graph.vertexCount());
+
+    const auto identifierAt = [&graph](index_type index) {
+        return graph.vertexAt(index).identifier();
+    };
+
+    for (index_type v{0}; v < indexBound; ++v) {
+        if (not graph.hasVertexAt(v)) { continue; }
+
+        const VertexIdentifier& identifier{identifierAt(v)};
+        distMap.emplace(identifier, dist[v]);
+        prevMap.emplace(identifier, prev[v].map(identifierAt));
+        sourceMap.emplace(
+            identifier,
+            (dist[v] == infinity) ? tl::optional<VertexIdentifier>{}
+                                  : tl::optional<VertexIdentifier>{
+                                      identifierAt(owner[v])});
+    }
+
+    return nearest_sources_type{
+        std::move(prevMap), std::move(distMap), std::move(sourceMap)};
+}
+
+/*!
+ * \brief Dijkstra's algorithm from several sources at once, all starting at
+ *        a distance of 0.
+ * \param sources The source vertices.
+ * \return The resulting NearestSources object.
+ * \note See the overload taking offsets for the other parameters.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD NearestSources<VertexIdentifier, std::size_t> nearestSources(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                         graph,
+    const std::vector<VertexIdentifier>& sources,
+    LengthInvocable                      lengthInvocable,
+    std::pmr::memory_resource* resource  = std::pmr::get_default_resource(),
+    QueueKind                  queueKind = QueueKind::IndexedHeap)
+{
+    std::vector<std::pair<VertexIdentifier, std::size_t>> withOffsets{};
+    withOffsets.reserve(sources.size());
+
+    for (const VertexIdentifier& source : sources) {
+        withOffsets.emplace_back(source, 0);
+    }
+
+    return nearestSources(
+        graph, withOffsets, std::move(lengthInvocable), resource, queueKind);
+}
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_MULTI_SOURCE_HPP
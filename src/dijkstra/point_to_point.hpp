@@ -0,0 +1,302 @@
+#ifndef INCG_GP_DIJKSTRA_POINT_TO_POINT_HPP
+#define INCG_GP_DIJKSTRA_POINT_TO_POINT_HPP
+#include "../directed_graph.hpp" // gp::DirectedGraph
+#include "../shortest_paths.hpp" // gp::ShortestPaths
+#include "queue_kind.hpp"        // gp::dijkstra::QueueKind
+#include "search.hpp"            // gp::dijkstra::detail::maxEdgeLength
+#include "search_statistics.hpp" // gp::dijkstra::SearchStatistics
+#include "workspace.hpp"         // gp::dijkstra::Workspace
+#include <algorithm>             // std::sort, std::unique, std::binary_search
+#include <ciso646>               // not, and, or
+#include <cstddef>               // std::size_t
+#include <cstdint>               // SIZE_MAX
+#include <memory_resource>       // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>    // PL_NODISCARD
+#include <pl/invoke.hpp>         // pl::invoke
+#include <tl/optional.hpp>       // tl::optional, tl::nullopt
+#include <utility>               // std::move
+#include <vector>                // std::pmr::vector, std::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Dijkstra's algorithm that stops as soon as the shortest paths to
+ *        all the targets given are known.
+ * \tparam VertexIdentifier The type of the unique identifiers used for the
+ *                          vertices in the directed graph to operate on.
+ * \tparam VertexData The type of the data that is stored on a vertex.
+ * \tparam EdgeIdentifier The type of the unique identifiers used for the
+ *                        edges in the directed graph to operate on.
+ * \tparam EdgeData The type of the data that is stored on an edge.
+ * \tparam LengthInvocable The type of the unary length invocable.
+ * \param graph The directed graph to perform Dijkstra's algorithm on.
+ * \param source The source vertex to use.
+ * \param targets The target vertices. Those that aren't part of the graph
+ *                are ignored.
+ * \param lengthInvocable See algorithm.
+ * \param workspace The working state, reused across the queries. The result
+ *                  is allocated from its memory resource.
+ * \param queueKind The priority queue to use.
+ * \param statistics Receives the amount of vertices settled, if not null.
+ * \return The resulting ShortestPaths object. Only holds the vertices
+ *         settled before the search stopped, which includes every vertex on
+ *         the shortest paths to the targets, and the targets that can't be
+ *         reached, at an infinite distance.
+ * \note The search settles the vertices in the order of their distance, so
+ *       the targets close to the source are found after exploring only a
+ *       small region of the graph. Apart from the first query on a graph,
+ *       the time taken is linear in the size of the regions explored by this
+ *       query and the previous one. The integer queues scan all the edges for
+ *       the largest length only once per version of the graph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> toTargets(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                         graph,
+    VertexIdentifier                     source,
+    const std::vector<VertexIdentifier>& targets,
+    LengthInvocable                      lengthInvocable,
+    Workspace<typename DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>::index_type>& workspace,
+    QueueKind                   queueKind  = QueueKind::IndexedHeap,
+    SearchStatistics*           statistics = nullptr)
+{
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using index_type          = typename graph_type::index_type;
+    using edge_range          = typename graph_type::edge_range;
+    using shortest_paths_type = ShortestPaths<VertexIdentifier, std::size_t>;
+
+    constexpr std::size_t infinity{SIZE_MAX};
+
+    std::pmr::memory_resource* const resource{workspace.resource()};
+
+    // The dense indices of the targets, each one once. Looked up by binary
+    // search, so that nothing is allocated per vertex of the graph.
+    std::pmr::vector<index_type> targetIndices{resource};
+    targetIndices.reserve(targets.size());
+
+    for (const VertexIdentifier& target : targets) {
+        const tl::optional<index_type> index{graph.vertexIndex(target)};
+
+        if (index.has_value()) { targetIndices.push_back(*index); }
+    }
+
+    std::sort(targetIndices.begin(), targetIndices.end());
+    targetIndices.erase(
+        std::unique(targetIndices.begin(), targetIndices.end()),
+        targetIndices.end());
+    std::size_t targetsLeft{targetIndices.size()};
+
+    // The vertices settled, in the order they were settled in.
+    std::pmr::vector<index_type> settled{resource};
+
+    const tl::optional<index_type> sourceIndex{graph.vertexIndex(source)};
+    const bool isSearching{sourceIndex.has_value() and (targetsLeft != 0)};
+
+    if (isSearching) {
+        const auto forEachOutbound
+            = [&graph, &lengthInvocable](index_type u, auto&& relax) {
+                  const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+                  for (auto it{outbounds.begin()}; it != outbounds.end();
+                       ++it) {
+                      relax(
+                          graph.endpointIndices(it).target,
+                          pl::invoke(lengthInvocable, *it));
+                  }
+              };
+
+        const std::pmr::vector<VertexWithPriority<index_type>> seeds{
+            {VertexWithPriority<index_type>{*sourceIndex, 0}}, resource};
+
+        workspace.search(
+            queueKind,
+            graph.vertexIndexBound(),
+            seeds,
+            forEachOutbound,
+            [&targetIndices, &targetsLeft, &settled](index_type u) {
+                settled.push_back(u);
+
+                if (std::binary_search(
+                        targetIndices.begin(), targetIndices.end(), u)) {
+                    --targetsLeft;
+                }
+
+                return targetsLeft == 0;
+            },
+            [&graph, &workspace, &forEachOutbound] {
+                auto scan{forEachOutbound};
+                return workspace.cachedWeightBound(
+                    graph.identity(), graph.version(), [&graph, &scan] {
+                        return detail::maxEdgeLength<index_type>(
+                            graph.vertexIndexBound(), scan);
+                    });
+            });
+    }
+
+    if (statistics != nullptr) {
+        statistics->settledVertices = settled.size();
+    }
+
+    // Translate the dense indices of the explored region back to the vertex
+    // identifiers.
+    typename shortest_paths_type::prev_map_type prevMap{resource};
+    typename shortest_paths_type::dist_map_type distMap{resource};
+    prevMap.reserve(settled.size() + targetsLeft + 1);
+    distMap.reserve(settled.size() + targetsLeft + 1);
+
+    // The source is always reported, even if it isn't part of the graph.
+    distMap.emplace(source, 0);
+    prevMap.emplace(source, tl::nullopt);
+
+    for (index_type v : settled) {
+        const VertexIdentifier& identifier{graph.vertexAt(v).identifier()};
+        distMap[identifier] = workspace.distance(v);
+        prevMap[identifier]
+            = workspace.predecessor(v).map([&graph](index_type index) {
+                  return graph.vertexAt(index).identifier();
+              });
+    }
+
+    // The targets that weren't settled can't be reached.
+    for (const VertexIdentifier& target : targets) {
+        const tl::optional<index_type> index{graph.vertexIndex(target)};
+
+        const bool isUnreachable{
+            index.has_value()
+            and ((not isSearching)
+                 or (workspace.distance(*index) == infinity))};
+
+        if (isUnreachable) {
+            distMap.emplace(target, infinity);
+            prevMap.emplace(target, tl::nullopt);
+        }
+    }
+
+    return shortest_paths_type{
+        std::move(source), std::move(prevMap), std::move(distMap)};
+}
+
+/*!
+ * \brief Dijkstra's algorithm that stops as soon as the shortest paths to
+ *        all the targets given are known.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \return The resulting ShortestPaths object, see the overload taking a
+ *         Workspace.
+ * \note Allocates and fills the working state for the entire graph. Use the
+ *       overload taking a Workspace to run many queries.
+ * \note See the overload taking a Workspace for the other parameters.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> toTargets(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                                         graph,
+    VertexIdentifier                     source,
+    const std::vector<VertexIdentifier>& targets,
+    LengthInvocable                      lengthInvocable,
+    std::pmr::memory_resource* resource   = std::pmr::get_default_resource(),
+    QueueKind                  queueKind  = QueueKind::IndexedHeap,
+    SearchStatistics*          statistics = nullptr)
+{
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+
+    Workspace<typename graph_type::index_type> workspace{resource};
+    return toTargets(
+        graph,
+        std::move(source),
+        targets,
+        std::move(lengthInvocable),
+        workspace,
+        queueKind,
+        statistics);
+}
+
+/*!
+ * \brief Dijkstra's algorithm that stops as soon as the shortest path to a
+ *        single target is known.
+ * \param target The target vertex.
+ * \return The resulting ShortestPaths object, see toTargets.
+ * \note See toTargets for the other parameters.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> pointToPoint(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                               graph,
+    VertexIdentifier           source,
+    VertexIdentifier           target,
+    LengthInvocable            lengthInvocable,
+    std::pmr::memory_resource* resource   = std::pmr::get_default_resource(),
+    QueueKind                  queueKind  = QueueKind::IndexedHeap,
+    SearchStatistics*          statistics = nullptr)
+{
+    return toTargets(
+        graph,
+        std::move(source),
+        std::vector<VertexIdentifier>{std::move(target)},
+        std::move(lengthInvocable),
+        resource,
+        queueKind,
+        statistics);
+}
+
+/*!
+ * \brief Dijkstra's algorithm that stops as soon as the shortest path to a
+ *        single target is known, reusing the working state of previous
+ *        queries.
+ * \param target The target vertex.
+ * \return The resulting ShortestPaths object, see toTargets.
+ * \note See toTargets for the other parameters.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename LengthInvocable>
+PL_NODISCARD ShortestPaths<VertexIdentifier, std::size_t> pointToPoint(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                     graph,
+    VertexIdentifier source,
+    VertexIdentifier target,
+    LengthInvocable  lengthInvocable,
+    Workspace<typename DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>::index_type>& workspace,
+    QueueKind                   queueKind  = QueueKind::IndexedHeap,
+    SearchStatistics*           statistics = nullptr)
+{
+    return toTargets(
+        graph,
+        std::move(source),
+        std::vector<VertexIdentifier>{std::move(target)},
+        std::move(lengthInvocable),
+        workspace,
+        queueKind,
+        statistics);
+}
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_POINT_TO_POINT_HPP
@@ -0,0 +1,28 @@
+#ifndef INCG_GP_DIJKSTRA_QUEUE_KIND_HPP
+#define INCG_GP_DIJKSTRA_QUEUE_KIND_HPP
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief The priority queues Dijkstra's algorithm can use.
+ *
+ * DialBuckets and RadixHeap need integer edge lengths, which the lengths of
+ * type std::size_t are. Both determine the largest edge length with a pass
+ * over the edges first.
+ **/
+enum class QueueKind {
+    IndexedHeap,  /*!< gp::dijkstra::IndexedHeap, O((V + E) log V) */
+    SortedVector, /*!< gp::dijkstra::SortedQueue, O(V * E) */
+    DialBuckets,  /*!< gp::dijkstra::BucketQueue, O(V + E + D) for the
+                       largest distance D, takes a bucket per possible edge
+                       length, falls back to RadixHeap if the largest edge
+                       length exceeds a multiple of the amount of
+                       vertices */
+    RadixHeap,    /*!< gp::dijkstra::RadixHeap, O(E + V log C) for the
+                       largest edge length C */
+    Automatic     /*!< DialBuckets if the largest edge length is less than
+                       the amount of vertices, RadixHeap otherwise */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_QUEUE_KIND_HPP
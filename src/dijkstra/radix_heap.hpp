@@ -0,0 +1,245 @@
+#ifndef INCG_GP_DIJKSTRA_RADIX_HEAP_HPP
+#define INCG_GP_DIJKSTRA_RADIX_HEAP_HPP
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <ciso646>                  // not, and
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // std::uint64_t, SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <pl/assert.hpp>            // PL_ASSERT
+#include <vector>                   // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+namespace detail {
+/*!
+ * \brief Returns the amount of bits needed to represent a value.
+ * \param value The value.
+ * \return 0 for 0, otherwise one plus the position of the highest bit set.
+ **/
+PL_NODISCARD inline std::size_t bitWidth(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (value == 0) ? 0U : 64U - static_cast<std::size_t>(
+                                         __builtin_clzll(value));
+#else
+    std::size_t result{0};
+
+    while (value != 0) {
+        value >>= 1U;
+        ++result;
+    }
+
+    return result;
+#endif
+}
+} // namespace detail
+
+/*!
+ * \brief Radix heap of dense vertex indices, used by Dijkstra's algorithm on
+ *        graphs with integer edge lengths.
+ * \tparam Index The type of the dense vertex indices.
+ *
+ * Exploits that the priorities popped by Dijkstra's algorithm never
+ * decrease. A vertex queued with priority p is kept in the bucket given by
+ * the highest bit in which p differs from the priority popped last, so there
+ * are only 65 buckets. Popping an empty bucket 0 redistributes the next
+ * bucket into lower ones, and every vertex moves down at most 64 times, so
+ * pop takes amortized O(log C) steps for edge lengths up to C, push and
+ * decreaseKey constant time.
+ * \warning The priorities must be monotone: a priority pushed must not be
+ *          less than the one popped last.
+ **/
+template<typename Index>
+class RadixHeap {
+public:
+    using this_type            = RadixHeap;
+    using index_type           = Index;
+    using size_type            = std::size_t;
+    using vertex_with_priority = VertexWithPriority<index_type>;
+
+    /*!
+     * \brief Creates an empty heap.
+     * \param indexBound One past the largest dense vertex index to be pushed.
+     * \param resource The memory resource to allocate from.
+     **/
+    RadixHeap(size_type indexBound, std::pmr::memory_resource* resource)
+        : m_buckets(bucketCount, resource)
+        , m_bucketIndices(indexBound, 0, resource)
+        , m_positions(indexBound, npos, resource)
+        , m_priorities(indexBound, 0, resource)
+        , m_last{0}
+        , m_size{0}
+    {
+    }
+
+    /*!
+     * \brief Checks whether the heap is empty.
+     * \return true if no vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool empty() const noexcept { return m_size == 0; }
+
+    /*!
+     * \brief Returns the amount of vertices queued.
+     * \return The amount of vertices queued.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_size; }
+
+    /*!
+     * \brief Checks whether a vertex is queued.
+     * \param vertex The dense index of the vertex.
+     * \return true if the vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool contains(index_type vertex) const noexcept
+    {
+        return m_positions[vertex] != npos;
+    }
+
+    /*!
+     * \brief Queues a vertex.
+     * \param vertex The dense index of the vertex, must not be queued.
+     * \param priority The priority, lower priorities are popped first.
+     **/
+    void push(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(not contains(vertex));
+        PL_ASSERT(priority >= m_last);
+        m_priorities[vertex] = priority;
+        place(vertex);
+        ++m_size;
+    }
+
+    /*!
+     * \brief Lowers the priority of a queued vertex.
+     * \param vertex The dense index of the vertex, must be queued.
+     * \param priority The new priority, must not be greater than the current
+     *                 one.
+     **/
+    void decreaseKey(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(contains(vertex));
+        PL_ASSERT((priority <= m_priorities[vertex]) and (priority >= m_last));
+        remove(vertex);
+        m_priorities[vertex] = priority;
+        place(vertex);
+    }
+
+    /*!
+     * \brief Removes a vertex with the lowest priority.
+     * \return The vertex with its priority.
+     * \note The heap must not be empty.
+     **/
+    vertex_with_priority pop()
+    {
+        PL_ASSERT(not empty());
+
+        if (m_buckets[0].empty()) { redistribute(); }
+
+        const index_type vertex{m_buckets[0].back()};
+        remove(vertex);
+        --m_size;
+        return vertex_with_priority{vertex, m_priorities[vertex]};
+    }
+
+    /*!
+     * \brief Removes all the vertices, so that any priority may be pushed
+     *        again.
+     * \note Linear in the amount of vertices queued.
+     **/
+    void clear() noexcept
+    {
+        for (std::pmr::vector<index_type>& bucket : m_buckets) {
+            for (index_type vertex : bucket) { m_positions[vertex] = npos; }
+
+            bucket.clear();
+        }
+
+        m_last = 0;
+        m_size = 0;
+    }
+
+private:
+    /*!
+     * \brief Marks the vertices that aren't queued.
+     **/
+    static constexpr size_type npos{SIZE_MAX};
+
+    /*!
+     * \brief One bucket for the priorities equal to the last one popped and
+     *        one for every bit in which they may differ.
+     **/
+    static constexpr size_type bucketCount{65};
+
+    /*!
+     * \brief Moves the vertices of the first non-empty bucket to lower
+     *        buckets, relative to the lowest priority among them.
+     **/
+    void redistribute()
+    {
+        size_type bucket{1};
+
+        while (m_buckets[bucket].empty()) { ++bucket; }
+
+        std::size_t lowest{SIZE_MAX};
+
+        for (index_type vertex : m_buckets[bucket]) {
+            if (m_priorities[vertex] < lowest) {
+                lowest = m_priorities[vertex];
+            }
+        }
+
+        m_last = lowest;
+
+        // All the vertices of the bucket end up in lower buckets now.
+        std::pmr::vector<index_type> vertices{
+            m_buckets[bucket].get_allocator()};
+        vertices.swap(m_buckets[bucket]);
+
+        for (index_type vertex : vertices) { place(vertex); }
+
+        // Reuse the capacity.
+        vertices.clear();
+        m_buckets[bucket].swap(vertices);
+    }
+
+    /*!
+     * \brief Adds a vertex to the bucket of its priority.
+     * \param vertex The dense index of the vertex.
+     **/
+    void place(index_type vertex)
+    {
+        const size_type bucket{
+            detail::bitWidth(m_priorities[vertex] ^ m_last)};
+        m_bucketIndices[vertex] = static_cast<unsigned char>(bucket);
+        m_positions[vertex]     = m_buckets[bucket].size();
+        m_buckets[bucket].push_back(vertex);
+    }
+
+    /*!
+     * \brief Removes a queued vertex from its bucket.
+     * \param vertex The dense index of the vertex.
+     **/
+    void remove(index_type vertex) noexcept
+    {
+        std::pmr::vector<index_type>& bucket{
+            m_buckets[m_bucketIndices[vertex]]};
+        const size_type position{m_positions[vertex]};
+
+        // Move the last vertex of the bucket into the gap.
+        bucket[position]           = bucket.back();
+        m_positions[bucket.back()] = position;
+        bucket.pop_back();
+        m_positions[vertex] = npos;
+    }
+
+    std::pmr::vector<std::pmr::vector<index_type>>
+        m_buckets; /*!< The buckets by highest differing bit */
+    std::pmr::vector<unsigned char> m_bucketIndices; /*!< Vertex -> bucket */
+    std::pmr::vector<size_type> m_positions; /*!< Vertex -> bucket position */
+    std::pmr::vector<std::size_t> m_priorities; /*!< Vertex -> priority */
+    std::size_t m_last; /*!< The priority popped last */
+    size_type   m_size; /*!< The amount of vertices queued */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_RADIX_HEAP_HPP
@@ -0,0 +1,415 @@
+#ifndef INCG_GP_DIJKSTRA_SEARCH_HPP
+#define INCG_GP_DIJKSTRA_SEARCH_HPP
+#include "bucket_queue.hpp"         // gp::dijkstra::BucketQueue
+#include "indexed_heap.hpp"         // gp::dijkstra::IndexedHeap
+#include "queue_kind.hpp"           // gp::dijkstra::QueueKind
+#include "radix_heap.hpp"           // gp::dijkstra::RadixHeap
+#include "sorted_queue.hpp"         // gp::dijkstra::SortedQueue
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <algorithm>                // std::max
+#include <ciso646>                  // not, or, and
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <tl/optional.hpp>          // tl::optional
+#include <utility>                  // std::move, std::forward
+#include <vector>                   // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+namespace detail {
+/*!
+ * \brief The main loop of Dijkstra's algorithm, shared by the overloads for
+ *        the different graph representations.
+ * \tparam Queue The type of the priority queue.
+ * \tparam Index The type of the dense vertex indices.
+ * \tparam ForEachOutbound The type of the binary invocable enumerating the
+ *                         outbound edges.
+ * \tparam OnSettle The type of the unary invocable notified of the vertices
+ *                  settled.
+ * \param q The empty queue to use, must accept every dense vertex index.
+ * \param seeds The dense indices of the source vertices with the distances
+ *              to start them at.
+ * \param dist The distances, one per dense vertex index, all infinity.
+ * \param prev The predecessors, one per dense vertex index, all nullopt.
+ * \param isSettled Whether the shortest path to a vertex is known, one per
+ *                  dense vertex index, all false.
+ * \param reached Receives the dense index of every vertex queued, which
+ *                are the only ones whose labels change, if not null.
+ * \param forEachOutbound A binary invocable that shall take the dense index
+ *                        of a vertex and a relax invocable and invoke the
+ *                        relax invocable with the dense index of the target
+ *                        and the length of every outbound edge of the vertex.
+ * \param onSettle A unary invocable that shall take the dense index of a
+ *                 vertex just settled and return true to stop the search.
+ * \note Vertices are only queued once they are reached, so the vertices
+ *       that can't be reached are never settled and keep their infinite
+ *       distance.
+ **/
+template<
+    typename Queue,
+    typename Index,
+    typename ForEachOutbound,
+    typename OnSettle>
+void search(
+    Queue&                                              q,
+    const std::pmr::vector<VertexWithPriority<Index>>& seeds,
+    std::pmr::vector<std::size_t>&                      dist,
+    std::pmr::vector<tl::optional<Index>>&             prev,
+    std::pmr::vector<bool>&                             isSettled,
+    std::pmr::vector<Index>*                            reached,
+    ForEachOutbound&                                    forEachOutbound,
+    OnSettle&                                           onSettle)
+{
+    // The distance to a source is 0 or its offset. (We're already there.)
+    for (const VertexWithPriority<Index>& seed : seeds) {
+        if (seed.priority() >= dist[seed.vertex()]) { continue; }
+
+        dist[seed.vertex()] = seed.priority();
+
+        if (q.contains(seed.vertex())) {
+            q.decreaseKey(seed.vertex(), seed.priority());
+        }
+        else {
+            q.push(seed.vertex(), seed.priority());
+
+            if (reached != nullptr) { reached->push_back(seed.vertex()); }
+        }
+    }
+
+    while (not q.empty()) {
+        // Get the best vertex.
+        const Index u{q.pop().vertex()};
+        isSettled[u] = true;
+
+        if (onSettle(u)) { return; }
+
+        // Handle all the neighbors of 'u'.
+        forEachOutbound(u, [&](Index target, std::size_t length) {
+            // We only care about neighbors of 'u' that aren't settled yet.
+            if (isSettled[target]) { return; }
+
+            // Calculate the alternative distance, which is the distance to
+            // 'u' plus the edge that connects 'u' to the neighbor.
+            const std::size_t alt{dist[u] + length};
+
+            // If the alternative distance is cheaper use it, reaching the
+            // neighbor over 'u'.
+            if (alt < dist[target]) {
+                dist[target] = alt;
+                prev[target] = u;
+
+                if (q.contains(target)) { q.decreaseKey(target, alt); }
+                else {
+                    q.push(target, alt);
+
+                    if (reached != nullptr) { reached->push_back(target); }
+                }
+            }
+        });
+    }
+}
+
+/*!
+ * \brief Settle invocable that never stops the search, used to compute the
+ *        shortest paths to all the vertices.
+ **/
+struct SettleAll {
+    template<typename Index>
+    constexpr bool operator()(Index) const noexcept
+    {
+        return false;
+    }
+};
+
+/*!
+ * \brief Determines the largest edge length.
+ * \tparam Index The type of the dense vertex indices.
+ * \param indexBound One past the largest dense vertex index.
+ * \param forEachOutbound See search.
+ * \return The largest edge length, 0 if there are no edges.
+ **/
+template<typename Index, typename ForEachOutbound>
+PL_NODISCARD std::size_t maxEdgeLength(
+    std::size_t      indexBound,
+    ForEachOutbound& forEachOutbound)
+{
+    std::size_t result{0};
+
+    for (Index vertex{0}; vertex < indexBound; ++vertex) {
+        forEachOutbound(vertex, [&result](Index, std::size_t length) {
+            result = std::max(result, length);
+        });
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Determines whether a bucket queue may be used for a weight bound.
+ * \param queueKind The kind of the queue requested.
+ * \param indexBound One past the largest dense vertex index.
+ * \param maxLength The largest edge length or seed priority.
+ * \return true if the buckets should be used; otherwise false.
+ * \note Automatic only uses the buckets if there are fewer of them than
+ *       vertices. DialBuckets allows a wider window, but still caps it, as
+ *       a bucket is allocated per possible edge length: a single huge length
+ *       would otherwise exhaust the memory.
+ **/
+PL_NODISCARD inline bool useBuckets(
+    QueueKind   queueKind,
+    std::size_t indexBound,
+    std::size_t maxLength) noexcept
+{
+    if (queueKind == QueueKind::Automatic) { return maxLength < indexBound; }
+
+    constexpr std::size_t bucketsPerVertex{16};
+    constexpr std::size_t minimumBuckets{std::size_t{1} << 16};
+    const std::size_t     limit{std::max(
+        minimumBuckets,
+        indexBound <= (SIZE_MAX / bucketsPerVertex)
+                ? indexBound * bucketsPerVertex
+                : SIZE_MAX)};
+
+    return (queueKind == QueueKind::DialBuckets) and (maxLength < limit);
+}
+
+/*!
+ * \brief Lazily created priority queues of every kind, which are cleared
+ *        instead of reallocated when they are requested again.
+ * \tparam Index The type of the dense vertex indices.
+ **/
+template<typename Index>
+class Queues {
+public:
+    /*!
+     * \brief Creates the queues, none of which allocates yet.
+     * \param indexBound One past the largest dense vertex index.
+     * \param resource The memory resource the queues allocate from.
+     **/
+    Queues(std::size_t indexBound, std::pmr::memory_resource* resource)
+        : m_indexBound{indexBound}
+        , m_resource{resource}
+        , m_indexedHeap{}
+        , m_sortedQueue{}
+        , m_bucketQueue{}
+        , m_radixHeap{}
+    {
+    }
+
+    /*!
+     * \brief Read accessor for the index bound the queues are created for.
+     * \return One past the largest dense vertex index.
+     **/
+    PL_NODISCARD std::size_t indexBound() const noexcept
+    {
+        return m_indexBound;
+    }
+
+    /*!
+     * \brief Fetches the indexed heap.
+     * \return The empty indexed heap.
+     **/
+    PL_NODISCARD IndexedHeap<Index>& indexedHeap()
+    {
+        return fetch(m_indexedHeap, m_indexBound, m_resource);
+    }
+
+    /*!
+     * \brief Fetches the sorted queue.
+     * \return The empty sorted queue.
+     **/
+    PL_NODISCARD SortedQueue<Index>& sortedQueue()
+    {
+        return fetch(m_sortedQueue, m_indexBound, m_resource);
+    }
+
+    /*!
+     * \brief Fetches the bucket queue, recreating it if its window is too
+     *        small for the given weight bound.
+     * \param maxLength The weight bound.
+     * \return The empty bucket queue.
+     **/
+    PL_NODISCARD BucketQueue<Index>& bucketQueue(std::size_t maxLength)
+    {
+        if (m_bucketQueue.has_value()
+            and (m_bucketQueue->maxLength() < maxLength)) {
+            m_bucketQueue.reset();
+        }
+
+        return fetch(m_bucketQueue, m_indexBound, maxLength, m_resource);
+    }
+
+    /*!
+     * \brief Fetches the radix heap.
+     * \return The empty radix heap.
+     **/
+    PL_NODISCARD RadixHeap<Index>& radixHeap()
+    {
+        return fetch(m_radixHeap, m_indexBound, m_resource);
+    }
+
+private:
+    /*!
+     * \brief Creates a queue or clears the existing one.
+     * \param queue The queue.
+     * \param args The arguments to create the queue with.
+     * \return The empty queue.
+     **/
+    template<typename Queue, typename... Args>
+    PL_NODISCARD static Queue& fetch(tl::optional<Queue>& queue, Args&&... args)
+    {
+        if (queue.has_value()) { queue->clear(); }
+        else {
+            queue.emplace(std::forward<Args>(args)...);
+        }
+
+        return *queue;
+    }
+
+    std::size_t                        m_indexBound;
+    std::pmr::memory_resource*         m_resource;
+    tl::optional<IndexedHeap<Index>> m_indexedHeap;
+    tl::optional<SortedQueue<Index>> m_sortedQueue;
+    tl::optional<BucketQueue<Index>> m_bucketQueue;
+    tl::optional<RadixHeap<Index>>   m_radixHeap;
+};
+
+/*!
+ * \brief Runs the main loop of Dijkstra's algorithm from several sources
+ *        using the queue requested, taken from a set of queues.
+ * \param queueKind The kind of the queue to use.
+ * \param queues The queues to take the queue from.
+ * \param weightBound A nullary invocable returning the largest edge length,
+ *                    only invoked for the integer queues.
+ * \note See search for the other parameters. The buckets have to cover the
+ *       priorities of the seeds, too. DialBuckets falls back to RadixHeap
+ *       if that would take too many buckets, see useBuckets.
+ **/
+template<
+    typename Index,
+    typename ForEachOutbound,
+    typename OnSettle,
+    typename WeightBound>
+void search(
+    QueueKind                                           queueKind,
+    Queues<Index>&                                      queues,
+    const std::pmr::vector<VertexWithPriority<Index>>& seeds,
+    std::pmr::vector<std::size_t>&                      dist,
+    std::pmr::vector<tl::optional<Index>>&             prev,
+    std::pmr::vector<bool>&                             isSettled,
+    std::pmr::vector<Index>*                            reached,
+    ForEachOutbound&                                    forEachOutbound,
+    OnSettle&                                           onSettle,
+    WeightBound&                                        weightBound)
+{
+    const auto run = [&](auto& q) {
+        search(
+            q,
+            seeds,
+            dist,
+            prev,
+            isSettled,
+            reached,
+            forEachOutbound,
+            onSettle);
+    };
+
+    if (queueKind == QueueKind::IndexedHeap) {
+        run(queues.indexedHeap());
+        return;
+    }
+
+    if (queueKind == QueueKind::SortedVector) {
+        run(queues.sortedQueue());
+        return;
+    }
+
+    std::size_t maxLength{weightBound()};
+
+    for (const VertexWithPriority<Index>& seed : seeds) {
+        maxLength = std::max(maxLength, seed.priority());
+    }
+
+    if (useBuckets(queueKind, queues.indexBound(), maxLength)) {
+        run(queues.bucketQueue(maxLength));
+        return;
+    }
+
+    run(queues.radixHeap());
+}
+
+/*!
+ * \brief Runs the main loop of Dijkstra's algorithm from several sources
+ *        using the queue requested.
+ * \param queueKind The kind of the queue to use.
+ * \param resource The memory resource to allocate the working state from.
+ * \note See search for the other parameters. DialBuckets, RadixHeap and
+ *       Automatic scan all the edges for the largest length first, even if
+ *       onSettle stops the search early. DialBuckets allocates a bucket per
+ *       possible distance between the seeds as well and falls back to
+ *       RadixHeap if that would take too many buckets, see useBuckets.
+ **/
+template<typename Index, typename ForEachOutbound, typename OnSettle>
+void search(
+    QueueKind                                           queueKind,
+    const std::pmr::vector<VertexWithPriority<Index>>& seeds,
+    std::pmr::vector<std::size_t>&                      dist,
+    std::pmr::vector<tl::optional<Index>>&             prev,
+    ForEachOutbound                                     forEachOutbound,
+    OnSettle                                            onSettle,
+    std::pmr::memory_resource*                          resource)
+{
+    const std::size_t      indexBound{dist.size()};
+    Queues<Index>          queues{indexBound, resource};
+    std::pmr::vector<bool> isSettled(indexBound, false, resource);
+    const auto             weightBound = [indexBound, &forEachOutbound] {
+        return maxEdgeLength<Index>(indexBound, forEachOutbound);
+    };
+
+    search(
+        queueKind,
+        queues,
+        seeds,
+        dist,
+        prev,
+        isSettled,
+        static_cast<std::pmr::vector<Index>*>(nullptr),
+        forEachOutbound,
+        onSettle,
+        weightBound);
+}
+
+/*!
+ * \brief Runs the main loop of Dijkstra's algorithm from a single source
+ *        using the queue requested.
+ * \param queueKind The kind of the queue to use.
+ * \param source The dense index of the source vertex.
+ * \note See search for the other parameters.
+ **/
+template<typename Index, typename ForEachOutbound, typename OnSettle>
+void search(
+    QueueKind                               queueKind,
+    Index                                   source,
+    std::pmr::vector<std::size_t>&          dist,
+    std::pmr::vector<tl::optional<Index>>& prev,
+    ForEachOutbound                         forEachOutbound,
+    OnSettle                                onSettle,
+    std::pmr::memory_resource*              resource)
+{
+    const std::pmr::vector<VertexWithPriority<Index>> seeds{
+        {VertexWithPriority<Index>{source, 0}}, resource};
+    search(
+        queueKind,
+        seeds,
+        dist,
+        prev,
+        std::move(forEachOutbound),
+        std::move(onSettle),
+        resource);
+}
+} // namespace detail
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_SEARCH_HPP
@@ -0,0 +1,16 @@
+#ifndef INCG_GP_DIJKSTRA_SEARCH_STATISTICS_HPP
+#define INCG_GP_DIJKSTRA_SEARCH_STATISTICS_HPP
+#include <cstddef> // std::size_t
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Counters describing the work done by a search, used to compare the
+ *        point-to-point variants.
+ **/
+struct SearchStatistics {
+    std::size_t settledVertices; /*!< The amount of vertices settled */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_SEARCH_STATISTICS_HPP
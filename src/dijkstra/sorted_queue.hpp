@@ -0,0 +1,129 @@
+#ifndef INCG_GP_DIJKSTRA_SORTED_QUEUE_HPP
+#define INCG_GP_DIJKSTRA_SORTED_QUEUE_HPP
+#include "insert.hpp"                    // gp::dijkstra::insert
+#include "vertex_with_priority.hpp"      // gp::dijkstra::VertexWithPriority
+#include <ciso646>                       // not
+#include <cstddef>                       // std::size_t
+#include <memory_resource>               // std::pmr::memory_resource, ...
+#include <pl/algo/ranged_algorithms.hpp> // pl::algo::find_if
+#include <pl/annotations.hpp>            // PL_NODISCARD
+#include <pl/assert.hpp>                 // PL_ASSERT
+#include <vector>                        // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief Queue of dense vertex indices kept as a vector sorted by priority,
+ *        the queue Dijkstra's algorithm originally used.
+ * \tparam Index The type of the dense vertex indices.
+ *
+ * Offers the same interface as IndexedHeap, but push and pop are linear in
+ * the amount of vertices queued and decreaseKey searches for the vertex
+ * first. Kept to compare against IndexedHeap.
+ **/
+template<typename Index>
+class SortedQueue {
+public:
+    using this_type            = SortedQueue;
+    using index_type           = Index;
+    using size_type            = std::size_t;
+    using vertex_with_priority = VertexWithPriority<index_type>;
+
+    /*!
+     * \brief Creates an empty queue.
+     * \param indexBound One past the largest dense vertex index to be pushed.
+     * \param resource The memory resource to allocate from.
+     **/
+    SortedQueue(size_type indexBound, std::pmr::memory_resource* resource)
+        : m_queue{resource}, m_isQueued(indexBound, false, resource)
+    {
+    }
+
+    /*!
+     * \brief Checks whether the queue is empty.
+     * \return true if no vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool empty() const noexcept { return m_queue.empty(); }
+
+    /*!
+     * \brief Returns the amount of vertices queued.
+     * \return The amount of vertices queued.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_queue.size(); }
+
+    /*!
+     * \brief Checks whether a vertex is queued.
+     * \param vertex The dense index of the vertex.
+     * \return true if the vertex is queued; otherwise false.
+     **/
+    PL_NODISCARD bool contains(index_type vertex) const noexcept
+    {
+        return m_isQueued[vertex];
+    }
+
+    /*!
+     * \brief Queues a vertex.
+     * \param vertex The dense index of the vertex, must not be queued.
+     * \param priority The priority, lower priorities are popped first.
+     **/
+    void push(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(not contains(vertex));
+        insert(m_queue, vertex_with_priority{vertex, priority});
+        m_isQueued[vertex] = true;
+    }
+
+    /*!
+     * \brief Lowers the priority of a queued vertex.
+     * \param vertex The dense index of the vertex, must be queued.
+     * \param priority The new priority, must not be greater than the current
+     *                 one.
+     **/
+    void decreaseKey(index_type vertex, std::size_t priority)
+    {
+        PL_ASSERT(contains(vertex));
+
+        // Temporarily remove the vertex from the queue ...
+        m_queue.erase(pl::algo::find_if(
+            m_queue, [vertex](const vertex_with_priority& element) {
+                return element.vertex() == vertex;
+            }));
+
+        // ... and add it again using the new priority.
+        insert(m_queue, vertex_with_priority{vertex, priority});
+    }
+
+    /*!
+     * \brief Removes the vertex with the lowest priority.
+     * \return The vertex with its priority.
+     * \note The queue must not be empty.
+     **/
+    vertex_with_priority pop()
+    {
+        PL_ASSERT(not empty());
+        const vertex_with_priority top{m_queue.front()};
+        m_queue.erase(m_queue.begin());
+        m_isQueued[top.vertex()] = false;
+        return top;
+    }
+
+    /*!
+     * \brief Removes all the vertices.
+     * \note Linear in the amount of vertices queued.
+     **/
+    void clear() noexcept
+    {
+        for (const vertex_with_priority& element : m_queue) {
+            m_isQueued[element.vertex()] = false;
+        }
+
+        m_queue.clear();
+    }
+
+private:
+    std::pmr::vector<vertex_with_priority> m_queue; /*!< Sorted by priority */
+    std::pmr::vector<bool> m_isQueued; /*!< Whether a vertex is queued */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_SORTED_QUEUE_HPP
@@ -0,0 +1,199 @@
+#ifndef INCG_GP_DIJKSTRA_WORKSPACE_HPP
+#define INCG_GP_DIJKSTRA_WORKSPACE_HPP
+#include "queue_kind.hpp"           // gp::dijkstra::QueueKind
+#include "search.hpp"               // gp::dijkstra::detail::search, ...
+#include "vertex_with_priority.hpp" // gp::dijkstra::VertexWithPriority
+#include <ciso646>                  // not, or
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // SIZE_MAX, std::uint64_t
+#include <memory_resource>          // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <tl/optional.hpp>          // tl::optional, tl::nullopt
+#include <vector>                   // std::pmr::vector
+
+namespace gp {
+namespace dijkstra {
+/*!
+ * \brief The working state of Dijkstra's algorithm, kept across the
+ *        queries of a point-to-point search.
+ * \tparam Index The type of the dense vertex indices.
+ *
+ * A search that stops early only touches the vertices it reaches, but
+ * filling the distances, the predecessors and the queue for all the
+ * vertices takes O(V) per query. The workspace allocates them once and
+ * resets only the vertices reached by the previous query. The largest edge
+ * length, which the integer queues need, is cached per graph identity and
+ * version.
+ * \warning The results of a query are overwritten by the next one.
+ **/
+template<typename Index>
+class Workspace {
+public:
+    using this_type     = Workspace;
+    using index_type    = Index;
+    using size_type     = std::size_t;
+    using version_type  = std::uint64_t;
+    using identity_type = std::uint64_t;
+
+    /*!
+     * \brief Creates an empty workspace.
+     * \param resource The memory resource to allocate the working state and
+     *                 the results of the queries from.
+     **/
+    explicit Workspace(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_dist{resource}
+        , m_prev{resource}
+        , m_isSettled(resource)
+        , m_reached{resource}
+        , m_queues{0, resource}
+        , m_weightBound{}
+    {
+    }
+
+    /*!
+     * \brief Read accessor for the memory resource.
+     * \return The memory resource this workspace allocates from.
+     **/
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_dist.get_allocator().resource();
+    }
+
+    /*!
+     * \brief Fetches the distance of a vertex found by the last query.
+     * \param vertex The dense index of the vertex.
+     * \return The distance, SIZE_MAX if the vertex wasn't reached.
+     **/
+    PL_NODISCARD std::size_t distance(index_type vertex) const noexcept
+    {
+        return m_dist[vertex];
+    }
+
+    /*!
+     * \brief Fetches the predecessor of a vertex found by the last query.
+     * \param vertex The dense index of the vertex.
+     * \return The dense index of the predecessor, nullopt for the sources
+     *         and the vertices that weren't reached.
+     **/
+    PL_NODISCARD const tl::optional<index_type>& predecessor(
+        index_type vertex) const noexcept
+    {
+        return m_prev[vertex];
+    }
+
+    /*!
+     * \brief Returns the largest edge length of a graph, scanning its edges
+     *        only if the graph or its version changed since the last call.
+     * \param graph The identity of the graph, which must change whenever the
+     *              graph is assigned, see DirectedGraph::identity.
+     * \param version The version of the graph.
+     * \param weightBound A nullary invocable returning the largest edge
+     *                    length.
+     * \return The largest edge length.
+     * \note A workspace should only be used with a single length invocable
+     *       per graph, as the cache doesn't know about it.
+     **/
+    template<typename WeightBound>
+    PL_NODISCARD std::size_t cachedWeightBound(
+        identity_type graph,
+        version_type  version,
+        WeightBound   weightBound)
+    {
+        if ((not m_weightBound.has_value())
+            or (m_weightBound->graph != graph)
+            or (m_weightBound->version != version)) {
+            m_weightBound = CachedWeightBound{graph, version, weightBound()};
+        }
+
+        return m_weightBound->maxLength;
+    }
+
+    /*!
+     * \brief Runs the main loop of Dijkstra's algorithm.
+     * \param queueKind The kind of the queue to use.
+     * \param indexBound One past the largest dense vertex index.
+     * \param seeds The dense indices of the source vertices with the
+     *              distances to start them at.
+     * \param forEachOutbound See detail::search.
+     * \param onSettle See detail::search.
+     * \param weightBound A nullary invocable returning the largest edge
+     *                    length, only invoked for the integer queues.
+     * \note Takes time linear in the amount of vertices reached by this and
+     *       the previous query, unless indexBound changed.
+     **/
+    template<
+        typename ForEachOutbound,
+        typename OnSettle,
+        typename WeightBound>
+    void search(
+        QueueKind                                                queueKind,
+        size_type                                                indexBound,
+        const std::pmr::vector<VertexWithPriority<index_type>>& seeds,
+        ForEachOutbound forEachOutbound,
+        OnSettle        onSettle,
+        WeightBound     weightBound)
+    {
+        reset(indexBound);
+        detail::search(
+            queueKind,
+            m_queues,
+            seeds,
+            m_dist,
+            m_prev,
+            m_isSettled,
+            &m_reached,
+            forEachOutbound,
+            onSettle,
+            weightBound);
+    }
+
+private:
+    /*!
+     * \brief The largest edge length of a version of a graph.
+     **/
+    struct CachedWeightBound {
+        identity_type graph;     /*!< The identity of the graph */
+        version_type  version;   /*!< The version of the graph */
+        std::size_t   maxLength; /*!< The largest edge length */
+    };
+
+    /*!
+     * \brief Restores the labels of the vertices reached by the previous
+     *        query, or refills them all if the index bound changed.
+     * \param indexBound One past the largest dense vertex index.
+     **/
+    void reset(size_type indexBound)
+    {
+        constexpr std::size_t infinity{SIZE_MAX};
+
+        if (indexBound != m_dist.size()) {
+            m_dist.assign(indexBound, infinity);
+            m_prev.assign(indexBound, tl::nullopt);
+            m_isSettled.assign(indexBound, false);
+            m_queues = detail::Queues<index_type>{indexBound, resource()};
+        }
+        else {
+            for (index_type vertex : m_reached) {
+                m_dist[vertex]      = infinity;
+                m_prev[vertex]      = tl::nullopt;
+                m_isSettled[vertex] = false;
+            }
+        }
+
+        m_reached.clear();
+    }
+
+    std::pmr::vector<std::size_t> m_dist; /*!< Vertex -> distance */
+    std::pmr::vector<tl::optional<index_type>>
+        m_prev; /*!< Vertex -> predecessor */
+    std::pmr::vector<bool> m_isSettled; /*!< Vertex -> shortest path known */
+    std::pmr::vector<index_type>
+        m_reached; /*!< The vertices the last query changed the labels of */
+    detail::Queues<index_type> m_queues; /*!< Cleared between the queries */
+    tl::optional<CachedWeightBound>
+        m_weightBound; /*!< The weight bound of the last graph */
+};
+} // namespace dijkstra
+} // namespace gp
+#endif // INCG_GP_DIJKSTRA_WORKSPACE_HPP
@@ -3,20 +3,35 @@
 #include "append.hpp"                      // gp::append
 #include "contains.hpp"                    // gp::contains
 #include "edge.hpp"                        // gp::Edge
+#include "edge_storage.hpp"                // gp::RowStorage, ...
 #include "graph_format/data_structure.hpp" // gp::graph_format::DataStructure
+#include "memory_usage.hpp"                // gp::MemoryUsage, gp::memory::...
+#include "mutation_journal.hpp"            // gp::MutationJournal, ...
+#include "object_identity.hpp"             // gp::detail::ObjectIdentity
 #include "vertex.hpp"                      // gp::Vertex
+#include "views.hpp"                       // gp::views::Range, ...
+#include <algorithm>                       // std::for_each, std::min
 #include <ciso646>                         // not, or, and
 #include <cstddef>                         // std::size_t
-#include <pl/algo/ranged_algorithms.hpp> // pl::algo::unique, pl::algo::sort, pl::algo::accumulate
+#include <cstdint> // SIZE_MAX, std::uint32_t, UINT32_MAX, std::uint64_t
+#include <execution>       // std::execution::par, ...
+#include <memory_resource> // std::pmr::memory_resource, ...
+#include <pl/algo/ranged_algorithms.hpp> // pl::algo::unique, pl::algo::sort, pl::algo::find
 #include <pl/annotations.hpp> // PL_NODISCARD
 #include <pl/assert.hpp>      // PL_ASSERT
 #include <pl/invoke.hpp>      // pl::invoke
 #include <pl/size_t.hpp>      // pl::literals::integer_literals::operator""_zu
+#include <set>                // std::pmr::set
 #include <tl/optional.hpp>    // tl::optional
-#include <utility>            // std::swap
-#include <vector>             // std::vector
+#include <type_traits>        // std::decay_t
+#include <unordered_map>      // std::pmr::unordered_map
+#include <utility>            // std::swap, std::pair, std::move
+#include <vector>             // std::vector, std::pmr::vector
 
 namespace gp {
+template<typename, typename, typename, typename>
+class DirectedGraphBuilder;
+
 /*!
  * \brief Represents a directed graph.
  * \tparam VertexIdentifier The type of which instances are used to uniquely
@@ -25,19 +40,44 @@ namespace gp {
  * \tparam EdgeIdentifier The type of which instances are used to uniquely
  *                        identify edges.
  * \tparam EdgeData The type of the data stored on an edge.
+ * \tparam EdgeStorage The edge storage policy, RowStorage (the default) or
+ *                     ColumnStorage.
+ * \note Vertices and edges are indexed by their identifiers using hash maps,
+ *       so std::hash must be specialized for VertexIdentifier and
+ *       EdgeIdentifier.
+ * \note Removing a vertex or an edge leaves a tombstone behind, so
+ *       references to the other vertices and edges stay valid. The
+ *       tombstones are skipped when iterating and are removed by compact(),
+ *       which may also be run automatically, see setCompactionThreshold.
+ * \note Mutations can be recorded in a MutationJournal, see enableJournal.
+ * \note Edges can be indexed by their source and target, see
+ *       enablePairIndex.
+ * \note With RowStorage every edge is stored as a gp::Edge and handed out as
+ *       a const edge_type&. With ColumnStorage the identifiers, sources,
+ *       targets and data of the edges are stored in separate columns and
+ *       the edges are handed out as proxies (see edge_reference and
+ *       edge_pointer) providing the same read accessors, so that scans
+ *       like findEdges only read the columns they need. Either way the
+ *       dense indices of the endpoints of the edges are kept in a column of
+ *       their own, see endpointIndicesAt.
  **/
 template<
     typename VertexIdentifier,
     typename VertexData,
     typename EdgeIdentifier,
-    typename EdgeData>
+    typename EdgeData,
+    typename EdgeStorage = RowStorage>
 class DirectedGraph {
+    using edge_store = detail::
+        EdgeStore<EdgeStorage, EdgeIdentifier, EdgeData, VertexIdentifier>;
+
 public:
     using this_type         = DirectedGraph;
     using vertex_identifier = VertexIdentifier;
     using vertex_data       = VertexData;
     using edge_identifier   = EdgeIdentifier;
     using edge_data         = EdgeData;
+    using edge_storage      = EdgeStorage;
 
     /*!
      * \brief The type of the vertices stored in this directed graph.
@@ -49,12 +89,72 @@ public:
      **/
     using edge_type = Edge<edge_identifier, edge_data, vertex_identifier>;
 
+    /*!
+     * \brief The type the edges are handed out as: const edge_type& with
+     *        RowStorage, a proxy with the read accessors of edge_type with
+     *        ColumnStorage.
+     **/
+    using edge_reference = typename edge_store::reference;
+
+    /*!
+     * \brief The type the edges are pointed to with in the vectors returned:
+     *        const edge_type* with RowStorage, a pointer-like proxy with
+     *        ColumnStorage.
+     **/
+    using edge_pointer = typename edge_store::pointer;
+
+    /*!
+     * \brief The type of the journal recording the mutations.
+     **/
+    using journal_type = MutationJournal<vertex_identifier, edge_identifier>;
+
+    /*!
+     * \brief The type of the version numbers counting the mutations.
+     **/
+    using version_type = typename journal_type::version_type;
+
+    /*!
+     * \brief The type of the identities of directed graphs, see identity().
+     **/
+    using identity_type = detail::ObjectIdentity::value_type;
+
     /*!
      * \brief Unsigned integer type guaranteed to be large enough to
      *        be able to represent any 'size'.
      **/
     using size_type = std::size_t;
 
+    /*!
+     * \brief The type of the dense vertex indices.
+     **/
+    using index_type = std::uint32_t;
+
+    /*!
+     * \brief The dense indices of the source and the target of an edge.
+     **/
+    struct EndpointIndices {
+        index_type source; /*!< The index of the source vertex */
+        index_type target; /*!< The index of the target vertex */
+    };
+
+    /*!
+     * \brief Non-allocating range over edges selected by an adjacency list.
+     * \note Invalidated by any modification of the directed graph.
+     **/
+    using edge_range = views::Range<typename edge_store::slot_iterator>;
+
+    /*!
+     * \brief Non-allocating range over all the vertices.
+     * \note Invalidated by adding vertices and by compaction.
+     **/
+    using vertex_list = views::Range<views::LiveIterator<vertex_type>>;
+
+    /*!
+     * \brief Non-allocating range over all the edges.
+     * \note Invalidated by adding edges and by compaction.
+     **/
+    using edge_list = views::Range<typename edge_store::live_iterator>;
+
     /*!
      * \brief A struct holding a pointer to a vertex along with its
      *        associated degree.
@@ -93,9 +193,144 @@ public:
     };
 
     /*!
-     * \brief Creates an empty directed graph.
+     * \brief Creates an empty directed graph that allocates from the default
+     *        memory resource.
+     **/
+    DirectedGraph() : DirectedGraph{std::pmr::get_default_resource()} {}
+
+    /*!
+     * \brief Creates an empty directed graph that allocates from a given
+     *        memory resource.
+     * \param resource The memory resource to allocate the vertices, edges,
+     *                 indices and adjacency lists from. Must outlive the
+     *                 directed graph.
+     * \note Memory allocated by the vertex and edge identifiers and data
+     *       themselves is not affected.
+     **/
+    explicit DirectedGraph(std::pmr::memory_resource* resource)
+        : m_vertices{resource}
+        , m_edges{resource}
+        , m_vertexIndices{resource}
+        , m_edgeIndices{resource}
+        , m_adjacencies{resource}
+        , m_endpointIndices{resource}
+        , m_adjacencyPositions{resource}
+        , m_degreeRanking{resource}
+        , m_vertexCount{0}
+        , m_edgeCount{0}
+        , m_compactionThreshold{1.0}
+        , m_version{0}
+        , m_identity{}
+        , m_journal{}
+        , m_pairIndex{}
+    {
+    }
+
+    /*!
+     * \brief Copies a directed graph into a given memory resource.
+     * \param other The directed graph to copy.
+     * \param resource The memory resource the copy allocates from.
+     * \note The copy constructor allocates from the default memory resource,
+     *       as the standard containers do.
+     **/
+    DirectedGraph(const this_type& other, std::pmr::memory_resource* resource)
+        : DirectedGraph{resource}
+    {
+        // Copy assignment keeps the memory resource of the target.
+        *this = other;
+    }
+
+    DirectedGraph(const this_type&) = default;
+    DirectedGraph(this_type&&)      = default;
+
+    /*!
+     * \brief Copies another directed graph into this one.
+     * \param other The directed graph to copy.
+     * \return A reference to this object.
+     * \note Keeps the memory resource of this directed graph, which the
+     *       journal and the pair index are copied into, too.
+     **/
+    this_type& operator=(const this_type& other)
+    {
+        if (this == &other) { return *this; }
+
+        m_vertices            = other.m_vertices;
+        m_edges               = other.m_edges;
+        m_vertexIndices       = other.m_vertexIndices;
+        m_edgeIndices         = other.m_edgeIndices;
+        m_adjacencies         = other.m_adjacencies;
+        m_endpointIndices     = other.m_endpointIndices;
+        m_adjacencyPositions  = other.m_adjacencyPositions;
+        m_degreeRanking       = other.m_degreeRanking;
+        m_vertexCount         = other.m_vertexCount;
+        m_edgeCount           = other.m_edgeCount;
+        m_compactionThreshold = other.m_compactionThreshold;
+        m_version             = other.m_version;
+        m_identity.renew();
+
+        // A disengaged optional would copy construct the journal and the
+        // index into the default memory resource.
+        m_journal.reset();
+        m_pairIndex.reset();
+
+        if (other.m_journal.has_value()) {
+            m_journal.emplace(*other.m_journal, resource());
+        }
+
+        if (other.m_pairIndex.has_value()) {
+            m_pairIndex.emplace(*other.m_pairIndex, resource());
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Moves another directed graph into this one.
+     * \param other The directed graph to move.
+     * \return A reference to this object.
+     * \note Keeps the memory resource of this directed graph. Constant
+     *       complexity if other uses the same memory resource, otherwise
+     *       the elements are moved into this one.
+     **/
+    this_type& operator=(this_type&& other)
+    {
+        if (this == &other) { return *this; }
+
+        m_vertices            = std::move(other.m_vertices);
+        m_edges               = std::move(other.m_edges);
+        m_vertexIndices       = std::move(other.m_vertexIndices);
+        m_edgeIndices         = std::move(other.m_edgeIndices);
+        m_adjacencies         = std::move(other.m_adjacencies);
+        m_endpointIndices     = std::move(other.m_endpointIndices);
+        m_adjacencyPositions  = std::move(other.m_adjacencyPositions);
+        m_degreeRanking       = std::move(other.m_degreeRanking);
+        m_vertexCount         = other.m_vertexCount;
+        m_edgeCount           = other.m_edgeCount;
+        m_compactionThreshold = other.m_compactionThreshold;
+        m_version             = other.m_version;
+        m_identity.renew();
+        m_journal.reset();
+        m_pairIndex.reset();
+
+        if (other.m_journal.has_value()) {
+            m_journal.emplace(std::move(*other.m_journal), resource());
+        }
+
+        if (other.m_pairIndex.has_value()) {
+            m_pairIndex.emplace(std::move(*other.m_pairIndex), resource());
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Read accessor for the memory resource.
+     * \return The memory resource this directed graph allocates from.
      **/
-    DirectedGraph() : m_vertices{}, m_edges{} {}
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_vertices.get_allocator().resource();
+    }
 
     /*!
      * \brief Fetches a vertex identified by the given identifier.
@@ -107,7 +342,7 @@ public:
     PL_NODISCARD tl::optional<const vertex_type&> vertex(
         vertex_identifier identifier) const noexcept
     {
-        return fetchElement(m_vertices, identifier);
+        return fetchElement(m_vertices, m_vertexIndices, identifier);
     }
 
     /*!
@@ -117,10 +352,15 @@ public:
      *         if there is an edge with the identifier given.
      *         Otherwise a nullopt.
      **/
-    PL_NODISCARD tl::optional<const edge_type&> edge(
+    PL_NODISCARD tl::optional<edge_reference> edge(
         edge_identifier identifier) const noexcept
     {
-        return fetchElement(m_edges, identifier);
+        const typename edge_index_map::const_iterator it{
+            m_edgeIndices.find(identifier)};
+
+        if (it == m_edgeIndices.end()) { return tl::nullopt; }
+
+        return tl::optional<edge_reference>(m_edges[it->second]);
     }
 
     /*!
@@ -129,14 +369,14 @@ public:
      **/
     PL_NODISCARD size_type vertexCount() const noexcept
     {
-        return m_vertices.size();
+        return m_vertexCount;
     }
 
     /*!
      * \brief Queries the amount of edges in this directed graph.
      * \return The amount of edges in this directed graph.
      **/
-    PL_NODISCARD size_type edgeCount() const noexcept { return m_edges.size(); }
+    PL_NODISCARD size_type edgeCount() const noexcept { return m_edgeCount; }
 
     /*!
      * \brief Checks whether this directed graph has any vertices.
@@ -144,14 +384,14 @@ public:
      **/
     PL_NODISCARD bool hasVertices() const noexcept
     {
-        return not m_vertices.empty();
+        return m_vertexCount != 0;
     }
 
     /*!
      * \brief Checks whether this directed graph has any edges.
      * \return true if this directed graph has any edges; otherwise false.
      **/
-    PL_NODISCARD bool hasEdges() const noexcept { return not m_edges.empty(); }
+    PL_NODISCARD bool hasEdges() const noexcept { return m_edgeCount != 0; }
 
     /*!
      * \brief Checks whether this directed graph contains a vertex with the
@@ -161,7 +401,7 @@ public:
      **/
     PL_NODISCARD bool hasVertex(vertex_identifier identifier) const noexcept
     {
-        return findVertexByIdentifier(identifier) != vertices().end();
+        return m_vertexIndices.find(identifier) != m_vertexIndices.end();
     }
 
     /*!
@@ -172,25 +412,276 @@ public:
      **/
     PL_NODISCARD bool hasEdge(edge_identifier identifier) const noexcept
     {
-        return findEdgeByIdentifier(identifier) != edges().end();
+        return m_edgeIndices.find(identifier) != m_edgeIndices.end();
     }
 
     /*!
      * \brief Read accessor for the vertices.
-     * \return The vertices.
+     * \return The vertices in the order they were added.
      **/
-    PL_NODISCARD const std::vector<vertex_type>& vertices() const noexcept
+    PL_NODISCARD vertex_list vertices() const noexcept
     {
-        return m_vertices;
+        return liveElements(m_vertices, m_vertexCount);
     }
 
     /*!
      * \brief Read accessor for the edges.
-     * \return The edges.
+     * \return The edges in the order they were added.
+     **/
+    PL_NODISCARD edge_list edges() const noexcept
+    {
+        return edge_list{m_edges.liveBegin(), m_edges.liveEnd(), m_edgeCount};
+    }
+
+    /*!
+     * \brief Fetches the dense index of a vertex.
+     * \param identifier The unique identifier of the vertex.
+     * \return The index or nullopt if there is no such vertex.
+     * \note The indices are stable until compact() runs. They are less than
+     *       vertexIndexBound(), so algorithms can keep per vertex state in
+     *       vectors of that size instead of hash maps.
+     **/
+    PL_NODISCARD tl::optional<index_type> vertexIndex(
+        vertex_identifier identifier) const noexcept
+    {
+        const typename vertex_index_map::const_iterator it{
+            m_vertexIndices.find(identifier)};
+
+        if (it == m_vertexIndices.end()) { return tl::nullopt; }
+
+        return static_cast<index_type>(it->second);
+    }
+
+    /*!
+     * \brief Returns one past the largest vertex index.
+     * \return The bound.
+     * \note Indices of removed vertices stay unused until compact() runs, so
+     *       the bound may be larger than vertexCount().
+     **/
+    PL_NODISCARD index_type vertexIndexBound() const noexcept
+    {
+        return static_cast<index_type>(m_vertices.size());
+    }
+
+    /*!
+     * \brief Checks whether a vertex index refers to a vertex.
+     * \param index The index, must be less than vertexIndexBound().
+     * \return true if there is a vertex with that index; false if the vertex
+     *         was removed.
+     **/
+    PL_NODISCARD bool hasVertexAt(index_type index) const noexcept
+    {
+        return m_vertices[index].has_value();
+    }
+
+    /*!
+     * \brief Fetches a vertex by its dense index.
+     * \param index The index, hasVertexAt(index) must be true.
+     * \return A reference to the vertex.
+     **/
+    PL_NODISCARD const vertex_type& vertexAt(index_type index) const noexcept
+    {
+        PL_ASSERT(hasVertexAt(index));
+        return *m_vertices[index];
+    }
+
+    /*!
+     * \brief Fetches the index of an edge.
+     * \param identifier The unique identifier of the edge.
+     * \return The index or nullopt if there is no such edge.
+     * \note The indices are stable until compact() runs. They are less than
+     *       edgeIndexBound() and equal to edge_range::iterator::slot().
+     **/
+    PL_NODISCARD tl::optional<size_type> edgeIndex(
+        edge_identifier identifier) const noexcept
+    {
+        const typename edge_index_map::const_iterator it{
+            m_edgeIndices.find(identifier)};
+
+        if (it == m_edgeIndices.end()) { return tl::nullopt; }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Returns one past the largest edge index.
+     * \return The bound.
+     **/
+    PL_NODISCARD size_type edgeIndexBound() const noexcept
+    {
+        return m_edges.size();
+    }
+
+    /*!
+     * \brief Fetches the dense indices of the endpoints of an edge by its
+     *        index.
+     * \param index The index of the edge, as returned by edgeIndex.
+     * \return The indices of the source and the target vertex.
+     **/
+    PL_NODISCARD EndpointIndices endpointIndicesAt(size_type index) const
+        noexcept
+    {
+        PL_ASSERT(m_edges.isLive(index));
+        return m_endpointIndices[index];
+    }
+
+    /*!
+     * \brief Returns a lazy range over the inbound edges of a vertex.
+     * \param index The dense index of the vertex, hasVertexAt(index) must be
+     *              true.
+     * \return The range.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    PL_NODISCARD edge_range inboundEdgeRangeAt(index_type index) const noexcept
+    {
+        return slotRange(m_adjacencies[index].inbound);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the outbound edges of a vertex.
+     * \param index The dense index of the vertex, hasVertexAt(index) must be
+     *              true.
+     * \return The range.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    PL_NODISCARD edge_range outboundEdgeRangeAt(index_type index) const
+        noexcept
+    {
+        return slotRange(m_adjacencies[index].outbound);
+    }
+
+    /*!
+     * \brief Fetches the dense indices of the endpoints of an edge without
+     *        hashing its source and target.
+     * \param edge Iterator to the edge, obtained from an edge_range.
+     * \return The indices of the source and the target vertex.
+     **/
+    PL_NODISCARD EndpointIndices
+    endpointIndices(typename edge_range::iterator edge) const noexcept
+    {
+        return m_endpointIndices[edge.slot()];
+    }
+
+    /*!
+     * \brief Fetches the edges leading from one vertex to another.
+     * \param source The source vertex.
+     * \param target The target vertex.
+     * \return A vector of pointers to the edges from source to target,
+     *         parallel edges included. Empty if there are no such edges or
+     *         vertices.
+     * \note Amortized constant complexity (plus the amount of edges returned)
+     *       if the pair index is enabled; otherwise linear in the outbound
+     *       degree of source.
+     * \note The edges are returned in the order they were added if the pair
+     *       index is enabled; otherwise in the order of the outbound
+     *       adjacency list of source, which removals may have permuted.
+     **/
+    PL_NODISCARD std::vector<edge_pointer> edgesBetween(
+        vertex_identifier source,
+        vertex_identifier target) const
+    {
+        const tl::optional<index_type> sourceIndex{vertexIndex(source)};
+        const tl::optional<index_type> targetIndex{vertexIndex(target)};
+
+        if (not sourceIndex.has_value() or not targetIndex.has_value()) {
+            return {};
+        }
+
+        std::vector<edge_pointer> result{};
+
+        if (hasPairIndex()) {
+            const edge_range between{
+                edgeRangeBetweenAt(*sourceIndex, *targetIndex)};
+
+            for (auto it{between.begin()}; it != between.end(); ++it) {
+                result.push_back(m_edges.pointerAt(it.slot()));
+            }
+
+            return result;
+        }
+
+        const edge_range outbounds{outboundEdgeRangeAt(*sourceIndex)};
+
+        for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+            if (endpointIndices(it).target == *targetIndex) {
+                result.push_back(m_edges.pointerAt(it.slot()));
+            }
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Checks whether there is an edge leading from one vertex to
+     *        another.
+     * \param source The source vertex.
+     * \param target The target vertex.
+     * \return true if there is at least one edge from source to target;
+     *         otherwise false.
+     * \note Amortized constant complexity if the pair index is enabled;
+     *       otherwise linear in the outbound degree of source.
      **/
-    PL_NODISCARD const std::vector<edge_type>& edges() const noexcept
+    PL_NODISCARD bool hasEdgeBetween(
+        vertex_identifier source,
+        vertex_identifier target) const
+    {
+        if (hasPairIndex()) {
+            return not edgeRangeBetween(std::move(source), std::move(target))
+                           .empty();
+        }
+
+        return not edgesBetween(std::move(source), std::move(target)).empty();
+    }
+
+    /*!
+     * \brief Returns a lazy range over the edges leading from one vertex to
+     *        another.
+     * \param source The source vertex.
+     * \param target The target vertex.
+     * \return The range, empty if there are no such edges or vertices.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     * \warning The pair index must be enabled.
+     **/
+    PL_NODISCARD edge_range
+    edgeRangeBetween(vertex_identifier source, vertex_identifier target) const
+        noexcept
+    {
+        using iterator = typename edge_range::iterator;
+
+        const tl::optional<index_type> sourceIndex{vertexIndex(source)};
+        const tl::optional<index_type> targetIndex{vertexIndex(target)};
+
+        if (not sourceIndex.has_value() or not targetIndex.has_value()) {
+            return edge_range{iterator{}, iterator{}};
+        }
+
+        return edgeRangeBetweenAt(*sourceIndex, *targetIndex);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the edges leading from one vertex to
+     *        another by the dense indices of the vertices.
+     * \param source The dense index of the source vertex.
+     * \param target The dense index of the target vertex.
+     * \return The range, empty if there are no such edges.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     * \warning The pair index must be enabled.
+     **/
+    PL_NODISCARD edge_range
+    edgeRangeBetweenAt(index_type source, index_type target) const noexcept
     {
-        return m_edges;
+        using iterator = typename edge_range::iterator;
+
+        PL_ASSERT(hasPairIndex());
+
+        const typename pair_index_map::const_iterator it{
+            m_pairIndex->find(pairKey(source, target))};
+
+        if (it == m_pairIndex->end()) {
+            return edge_range{iterator{}, iterator{}};
+        }
+
+        return slotRange(it->second);
     }
 
     /*!
@@ -206,8 +697,8 @@ public:
 
         // Fetch the pointers to the inbound and outbound edges of the vertex
         // given.
-        const std::vector<const edge_type*> inbound{inboundEdges(vertex)};
-        const std::vector<const edge_type*> outbound{outboundEdges(vertex)};
+        const std::vector<edge_pointer> inbound{inboundEdges(vertex)};
+        const std::vector<edge_pointer> outbound{outboundEdges(vertex)};
 
         // Accumulator for the return value.
         std::vector<const vertex_type*> result{};
@@ -216,12 +707,12 @@ public:
         // function of the edge type for a given vector of edges.
         const auto addVerticesOf
             = [this, &result](
-                  const std::vector<const edge_type*>& vector,
-                  const vertex_identifier& (edge_type::*memberFunction)()
+                  const std::vector<edge_pointer>& vector,
+                  const vertex_identifier& (edge_value::*memberFunction)()
                       const noexcept) {
-                  for (const edge_type* edge : vector) {
+                  for (const edge_pointer& edge : vector) {
                       const vertex_identifier& identifier{
-                          (edge->*memberFunction)()};
+                          ((*edge).*memberFunction)()};
                       const tl::optional<const vertex_type&> theVertex{
                           this->vertex(identifier)};
 
@@ -233,10 +724,10 @@ public:
               };
 
         // Add all of the source vertices of the inbound edges.
-        addVerticesOf(inbound, &edge_type::source);
+        addVerticesOf(inbound, &edge_value::source);
 
         // Add all of the target vertices of the outbound edges.
-        addVerticesOf(outbound, &edge_type::target);
+        addVerticesOf(outbound, &edge_value::target);
 
         return result;
     }
@@ -246,14 +737,14 @@ public:
      * \param vertex The vertex.
      * \return A vector of pointers to the edges incident to the vertex given.
      **/
-    PL_NODISCARD std::vector<const edge_type*> incidentEdges(
+    PL_NODISCARD std::vector<edge_pointer> incidentEdges(
         vertex_identifier vertex) const
     {
         // If we don't have the vertex -> return an empty vector.
         if (not hasVertex(vertex)) { return {}; }
 
         // Get both the inbound and outbound edges.
-        std::vector<const edge_type*> result{
+        std::vector<edge_pointer> result{
             append(inboundEdges(vertex), outboundEdges(vertex))};
 
         // Sort the result so that it can be uniquified.
@@ -275,7 +766,7 @@ public:
     PL_NODISCARD std::vector<const vertex_type*> incidentVertices(
         edge_identifier edgeToGetTheIncidentVerticesOf) const
     {
-        const tl::optional<const edge_type&> theEdge{
+        const tl::optional<edge_reference> theEdge{
             edge(edgeToGetTheIncidentVerticesOf)};
 
         // If the edge doesn't exist -> return an empty vector.
@@ -299,7 +790,7 @@ public:
         edge_identifier edge) const noexcept
     {
         return mapWith(
-            this->edge(edge), [](const edge_type& e) { return e.source(); });
+            this->edge(edge), [](edge_reference e) { return e.source(); });
     }
 
     /*!
@@ -312,33 +803,98 @@ public:
         edge_identifier edge) const noexcept
     {
         return mapWith(
-            this->edge(edge), [](const edge_type& e) { return e.target(); });
+            this->edge(edge), [](edge_reference e) { return e.target(); });
     }
 
     /*!
      * \brief Fetches the inbound edges of a vertex.
      * \param vertex The vertex.
      * \return A vector of pointers to the inbound edges of vertex.
+     * \note Complexity is linear in the inbound degree of vertex.
      **/
-    PL_NODISCARD std::vector<const edge_type*> inboundEdges(
+    PL_NODISCARD std::vector<edge_pointer> inboundEdges(
         vertex_identifier vertex) const
     {
-        return findEdges([vertex](const edge_type& currentEdge) {
-            return currentEdge.target() == vertex;
-        });
+        return edgesOf(vertex, &Adjacency::inbound);
     }
 
     /*!
      * \brief Fetches the outbound edges of a vertex.
      * \param vertex The vertex.
      * \return A vector of pointers to the outbound edges of vertex.
+     * \note Complexity is linear in the outbound degree of vertex.
      **/
-    PL_NODISCARD std::vector<const edge_type*> outboundEdges(
+    PL_NODISCARD std::vector<edge_pointer> outboundEdges(
         vertex_identifier vertex) const
     {
-        return findEdges([vertex](const edge_type& currentEdge) {
-            return currentEdge.source() == vertex;
-        });
+        return edgesOf(vertex, &Adjacency::outbound);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the inbound edges of a vertex.
+     * \param vertex The vertex.
+     * \return The range, empty if there is no such vertex.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    PL_NODISCARD edge_range inboundEdgeRange(vertex_identifier vertex) const
+        noexcept
+    {
+        return rangeOf(vertex, &Adjacency::inbound);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the outbound edges of a vertex.
+     * \param vertex The vertex.
+     * \return The range, empty if there is no such vertex.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    PL_NODISCARD edge_range outboundEdgeRange(vertex_identifier vertex) const
+        noexcept
+    {
+        return rangeOf(vertex, &Adjacency::outbound);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the edges incident to a vertex.
+     * \param vertex The vertex.
+     * \return The range, yielding edge_reference objects. The inbound edges
+     *         come first, followed by the outbound edges that aren't loops.
+     *         Empty if there is no such vertex.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    PL_NODISCARD auto incidentEdgeRange(vertex_identifier vertex) const
+        noexcept
+    {
+        // Loops are in both adjacency lists, only visit them once.
+        return views::concat(
+            inboundEdgeRange(vertex),
+            views::filter(outboundEdgeRange(vertex), IsNotLoop{}));
+    }
+
+    /*!
+     * \brief Returns a lazy range over the vertices adjacent to a vertex.
+     * \param vertex The vertex.
+     * \return The range, yielding const vertex_type& objects. Empty if there
+     *         is no such vertex.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     * \warning Unlike adjacentVertices a vertex that is connected to vertex
+     *          by multiple edges is yielded once per edge.
+     **/
+    PL_NODISCARD auto adjacentVertexRange(vertex_identifier vertex) const
+        noexcept
+    {
+        const tl::optional<const vertex_type&> theVertex{this->vertex(vertex)};
+        const vertex_identifier* const identifier{
+            theVertex.has_value() ? &theVertex->identifier() : nullptr};
+
+        return views::transform(
+            incidentEdgeRange(vertex),
+            [this, identifier](edge_reference edge) -> const vertex_type& {
+                const vertex_identifier& other{
+                    edge.source() == *identifier ? edge.target()
+                                                 : edge.source()};
+                return *m_vertices[m_vertexIndices.find(other)->second];
+            });
     }
 
     /*!
@@ -359,40 +915,142 @@ public:
      * \brief Finds edges that satisfy a given predicate.
      * \tparam UnaryPredicate The type of the predicate.
      * \param unaryPredicate The predicate to use. Must accept a single argument
-     *                       as a const edge_type&.
+     *                       as an edge_reference.
      * \return A vector of pointers to the edges that satisfy the predicate.
+     * \note With ColumnStorage only the columns read by the predicate and the
+     *       liveness of the edges are scanned.
      **/
     template<typename UnaryPredicate>
-    PL_NODISCARD std::vector<const edge_type*> findEdges(
+    PL_NODISCARD std::vector<edge_pointer> findEdges(
         UnaryPredicate unaryPredicate) const
     {
-        return findByUnaryPredicate(edges(), std::move(unaryPredicate));
+        std::vector<edge_pointer> result{};
+
+        for (size_type slot{0}; slot < m_edges.size(); ++slot) {
+            if (m_edges.isLive(slot)
+                and pl::invoke(unaryPredicate, m_edges[slot])) {
+                result.push_back(m_edges.pointerAt(slot));
+            }
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Finds vertices that satisfy a given predicate, running the
+     *        predicate using the execution policy given.
+     * \tparam ExecutionPolicy The type of the execution policy, for instance
+     *                         the type of std::execution::par.
+     * \tparam UnaryPredicate The type of the predicate.
+     * \param policy The execution policy to use.
+     * \param unaryPredicate The predicate to use. Must accept a single argument
+     *                       as a const vertex_type&. Must be safe to invoke
+     *                       concurrently if the policy allows it.
+     * \return A vector of pointers to the vertices that satisfy the predicate
+     *         in the same order as findVertices(unaryPredicate) returns them.
+     * \note The vertices are scanned in chunks, which are merged in order.
+     **/
+    template<typename ExecutionPolicy, typename UnaryPredicate>
+    PL_NODISCARD std::vector<const vertex_type*> findVertices(
+        ExecutionPolicy&& policy,
+        UnaryPredicate    unaryPredicate) const
+    {
+        return findInSlots(
+            policy,
+            m_vertices.size(),
+            [this, &unaryPredicate](size_type slot) {
+                return m_vertices[slot].has_value()
+                       and pl::invoke(unaryPredicate, *m_vertices[slot]);
+            },
+            [this](size_type slot) { return &*m_vertices[slot]; });
+    }
+
+    /*!
+     * \brief Finds edges that satisfy a given predicate, running the
+     *        predicate using the execution policy given.
+     * \tparam ExecutionPolicy The type of the execution policy, for instance
+     *                         the type of std::execution::par.
+     * \tparam UnaryPredicate The type of the predicate.
+     * \param policy The execution policy to use.
+     * \param unaryPredicate The predicate to use. Must accept a single argument
+     *                       as an edge_reference. Must be safe to invoke
+     *                       concurrently if the policy allows it.
+     * \return A vector of pointers to the edges that satisfy the predicate in
+     *         the same order as findEdges(unaryPredicate) returns them.
+     * \note The edges are scanned in chunks, which are merged in order.
+     **/
+    template<typename ExecutionPolicy, typename UnaryPredicate>
+    PL_NODISCARD std::vector<edge_pointer> findEdges(
+        ExecutionPolicy&& policy,
+        UnaryPredicate    unaryPredicate) const
+    {
+        return findInSlots(
+            policy,
+            m_edges.size(),
+            [this, &unaryPredicate](size_type slot) {
+                return m_edges.isLive(slot)
+                       and pl::invoke(unaryPredicate, m_edges[slot]);
+            },
+            [this](size_type slot) { return m_edges.pointerAt(slot); });
+    }
+
+    /*!
+     * \brief Returns a lazy range over the vertices that satisfy a given
+     *        predicate.
+     * \tparam UnaryPredicate The type of the predicate.
+     * \param unaryPredicate The predicate to use. Must accept a single argument
+     *                       as a const vertex_type&.
+     * \return The range, yielding const vertex_type& objects.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    template<typename UnaryPredicate>
+    PL_NODISCARD auto findVertexRange(UnaryPredicate unaryPredicate) const
+    {
+        return views::filter(vertices(), std::move(unaryPredicate));
+    }
+
+    /*!
+     * \brief Returns a lazy range over the edges that satisfy a given
+     *        predicate.
+     * \tparam UnaryPredicate The type of the predicate.
+     * \param unaryPredicate The predicate to use. Must accept a single argument
+     *                       as an edge_reference.
+     * \return The range, yielding edge_reference objects.
+     * \note Doesn't allocate. Invalidated by any modification of the graph.
+     **/
+    template<typename UnaryPredicate>
+    PL_NODISCARD auto findEdgeRange(UnaryPredicate unaryPredicate) const
+    {
+        return views::filter(edges(), std::move(unaryPredicate));
     }
 
     /*!
      * \brief Returns the inbound degree of a given vertex.
      * \param vertex The vertex.
      * \return The inbound degree of vertex.
+     * \note Amortized constant complexity.
      **/
     PL_NODISCARD size_type inboundDegree(vertex_identifier vertex) const
     {
-        return inboundEdges(vertex).size();
+        return inboundEdgeRange(vertex).size();
     }
 
     /*!
      * \brief Returns the outbound degree of a given vertex.
      * \param vertex The vertex.
      * \return The outbound degree of vertex.
+     * \note Amortized constant complexity.
      **/
     PL_NODISCARD size_type outboundDegree(vertex_identifier vertex) const
     {
-        return outboundEdges(vertex).size();
+        return outboundEdgeRange(vertex).size();
     }
 
     /*!
      * \brief Returns the degree of a given vertex.
      * \param vertex The vertex.
      * \return The degree of vertex.
+     * \note Amortized constant complexity.
      **/
     PL_NODISCARD size_type degree(vertex_identifier vertex) const
     {
@@ -402,23 +1060,44 @@ public:
     /*!
      * \brief Determines the vertex with the maximum degree.
      * \return The vertex with the maximum degree along with its degree.
+     *         If multiple vertices have the maximum degree the one that was
+     *         added first is returned.
      * \warning The pointer in the struct returned may be nullptr!
+     * \note Logarithmic complexity in the amount of vertices.
      **/
     PL_NODISCARD VertexWithDegree maximumDegree() const
     {
         using namespace pl::literals::integer_literals;
 
-        return degreeByComparator<0_zu>(std::greater{});
+        if (m_degreeRanking.empty()) { return VertexWithDegree{nullptr, 0_zu}; }
+
+        // The ranking is ordered by degree first and by vertex position
+        // second, so this is the first vertex with the maximum degree.
+        const size_type maximum{m_degreeRanking.rbegin()->first};
+        const typename degree_ranking::const_iterator it{
+            m_degreeRanking.lower_bound(std::pair{maximum, 0_zu})};
+
+        return VertexWithDegree{&*m_vertices[it->second], maximum};
     }
 
     /*!
      * \brief Determines the vertex with the minimum degree.
      * \return The vertex with the minimum degree along with its degree.
+     *         If multiple vertices have the minimum degree the one that was
+     *         added first is returned.
      * \warning The pointer in the struct returned may be nullptr!
+     * \note Constant complexity.
      **/
     PL_NODISCARD VertexWithDegree minimumDegree() const
     {
-        return degreeByComparator<SIZE_MAX>(std::less{});
+        if (m_degreeRanking.empty()) {
+            return VertexWithDegree{nullptr, SIZE_MAX};
+        }
+
+        const typename degree_ranking::const_iterator it{
+            m_degreeRanking.begin()};
+
+        return VertexWithDegree{&*m_vertices[it->second], it->first};
     }
 
     /*!
@@ -432,7 +1111,15 @@ public:
         // You can't add the same vertex more than once.
         if (hasVertex(identifier)) { return false; }
 
-        m_vertices.emplace_back(std::move(identifier), std::move(data));
+        const size_type slot{m_vertices.size()};
+        PL_ASSERT(slot < UINT32_MAX);
+        m_vertexIndices.emplace(identifier, slot);
+        m_vertices.emplace_back(
+            vertex_type{std::move(identifier), std::move(data)});
+        m_adjacencies.emplace_back();
+        rankVertex(slot);
+        ++m_vertexCount;
+        journalVertex(MutationKind::AddVertex, m_vertices.back()->identifier());
         return true;
     }
 
@@ -458,11 +1145,27 @@ public:
             return false;
         }
 
-        m_edges.emplace_back(
-            std::move(identifier),
-            std::move(source),
-            std::move(target),
-            std::move(data));
+        const size_type slot{m_edges.size()};
+        const size_type sourceSlot{m_vertexIndices.at(source)};
+        const size_type targetSlot{m_vertexIndices.at(target)};
+
+        unrankVertex(sourceSlot);
+        unrankVertex(targetSlot);
+        linkEdge(sourceSlot, targetSlot, slot);
+        rankVertex(sourceSlot);
+        rankVertex(targetSlot);
+        indexPair(sourceSlot, targetSlot, slot);
+
+        m_edgeIndices.emplace(identifier, slot);
+        m_endpointIndices.push_back(
+            EndpointIndices{static_cast<index_type>(sourceSlot),
+                            static_cast<index_type>(targetSlot)});
+        m_edges.append(std::move(identifier),
+                       std::move(source),
+                       std::move(target),
+                       std::move(data));
+        ++m_edgeCount;
+        journalEdge(MutationKind::AddEdge, m_edges.identifier(slot));
 
         return true;
     }
@@ -472,40 +1175,41 @@ public:
      * \param vertex The vertex to remove.
      * \return true if the vertex was successfully removed; otherwise false.
      * \note Also removes the incident edges of the vertex.
+     * \note Complexity is linear in the degree of the vertex (unless
+     *       automatic compaction runs), times the logarithm of the amount of
+     *       vertices for the degree ranking.
+     *       References to the other vertices and edges stay valid (unless
+     *       automatic compaction runs).
      **/
     PL_NODISCARD bool removeVertex(vertex_identifier vertex)
     {
-        const typename std::vector<vertex_type>::const_iterator
-            vertexToRemoveIterator{findVertexByIdentifier(vertex)};
+        const typename vertex_index_map::const_iterator it{
+            m_vertexIndices.find(vertex)};
 
         // If the vertex doesn't exist -> error.
-        if (vertexToRemoveIterator == vertices().end()) { return false; }
+        if (it == m_vertexIndices.end()) { return false; }
 
-        // Get the incident edges.
-        const std::vector<const edge_type*> incidents{incidentEdges(vertex)};
+        const size_type slot{it->second};
+        Adjacency&      adjacency{m_adjacencies[slot]};
 
-        // Allocate memory for the identifiers of the incident edges.
-        std::vector<edge_identifier> identifiers(incidents.size());
+        // Remove the incident edges, the adjacency lists shrink as we go.
+        while (not adjacency.outbound.empty()) {
+            eraseEdge(adjacency.outbound.back());
+        }
 
-        // 'Map' the edge identifiers of the incident edges into the vector.
-        pl::algo::transform(
-            incidents, identifiers.begin(), [](const edge_type* const curEdge) {
-                return curEdge->identifier();
-            });
+        while (not adjacency.inbound.empty()) {
+            eraseEdge(adjacency.inbound.back());
+        }
 
-        for (const edge_identifier& currentEdgeIdentifier : identifiers) {
-            // Remove the curent edge from the graph.
-            if (not removeEdge(currentEdgeIdentifier)) {
-                // This should never fail, because it can only fail if the edge
-                // to remove doesn't exist in the graph at all.
-                PL_ASSERT(false);
-                return false;
-            }
-        }
-        // We're done erasing the incident edges now.
+        // Leave a tombstone behind.
+        journalVertex(MutationKind::RemoveVertex, vertex);
+        unrankVertex(slot);
+        adjacency = Adjacency{m_adjacencies.get_allocator()};
+        m_vertices[slot].reset();
+        m_vertexIndices.erase(it);
+        --m_vertexCount;
 
-        // Remove the vertex.
-        m_vertices.erase(vertexToRemoveIterator);
+        compactIfNeeded();
 
         return true;
     }
@@ -514,30 +1218,426 @@ public:
      * \brief Removes a given edge from the graph.
      * \param edge The edge to remove.
      * \return true if the edge was successfully removed; otherwise false.
+     * \note Complexity is logarithmic in the amount of vertices, for the
+     *       degree ranking (unless automatic compaction runs). Moves the last
+     *       edge of each adjacency list of the endpoints into the place of
+     *       the edge removed. References to the other
+     *       vertices and edges stay valid (unless automatic compaction runs).
      **/
     PL_NODISCARD bool removeEdge(edge_identifier edge)
     {
-        const typename std::vector<edge_type>::const_iterator it{
-            findEdgeByIdentifier(edge)};
+        const typename edge_index_map::const_iterator it{
+            m_edgeIndices.find(edge)};
 
         // If the edge doesn't exist -> Error.
-        if (it == edges().end()) { return false; }
+        if (it == m_edgeIndices.end()) { return false; }
 
-        // Remove the edge.
-        m_edges.erase(it);
+        eraseEdge(it->second);
+        compactIfNeeded();
 
         return true;
     }
 
+    /*!
+     * \brief Removes the tombstones left behind by removing vertices and
+     *        edges.
+     * \return A reference to this object.
+     * \note Preserves the order of the vertices and edges.
+     * \warning Invalidates all references, pointers and ranges into this
+     *          directed graph.
+     **/
+    this_type& compact()
+    {
+        const std::pmr::vector<size_type> vertexSlots{compactElements(
+            m_vertices, m_vertexIndices, m_vertexCount)};
+        const std::pmr::vector<size_type> edgeSlots{compactEdges()};
+
+        // Move the adjacency lists of the remaining vertices to their new
+        // positions and renumber the edges in them.
+        std::pmr::vector<Adjacency> adjacencies(
+            m_vertexCount, m_adjacencies.get_allocator());
+
+        for (size_type slot{0}; slot < vertexSlots.size(); ++slot) {
+            if (vertexSlots[slot] == npos) { continue; }
+
+            Adjacency& adjacency{adjacencies[vertexSlots[slot]]};
+            adjacency = std::move(m_adjacencies[slot]);
+
+            for (size_type& edgeSlot : adjacency.outbound) {
+                edgeSlot = edgeSlots[edgeSlot];
+            }
+
+            for (size_type& edgeSlot : adjacency.inbound) {
+                edgeSlot = edgeSlots[edgeSlot];
+            }
+        }
+
+        m_adjacencies = std::move(adjacencies);
+
+        // Move the endpoint indices of the remaining edges and renumber them.
+        std::pmr::vector<EndpointIndices> endpointIndices(
+            m_edgeCount, m_endpointIndices.get_allocator());
+
+        for (size_type slot{0}; slot < edgeSlots.size(); ++slot) {
+            if (edgeSlots[slot] == npos) { continue; }
+
+            const EndpointIndices& old{m_endpointIndices[slot]};
+            endpointIndices[edgeSlots[slot]] = EndpointIndices{
+                static_cast<index_type>(vertexSlots[old.source]),
+                static_cast<index_type>(vertexSlots[old.target])};
+        }
+
+        m_endpointIndices = std::move(endpointIndices);
+
+        // The adjacency lists kept their order, so the positions of the
+        // edges in them only move along with the edges.
+        std::pmr::vector<AdjacencyPositions> adjacencyPositions(
+            m_edgeCount, m_adjacencyPositions.get_allocator());
+
+        for (size_type slot{0}; slot < edgeSlots.size(); ++slot) {
+            if (edgeSlots[slot] == npos) { continue; }
+
+            adjacencyPositions[edgeSlots[slot]] = m_adjacencyPositions[slot];
+        }
+
+        m_adjacencyPositions = std::move(adjacencyPositions);
+
+        // The positions only moved to the front while keeping their order, so
+        // the ranking can be rebuilt in order.
+        degree_ranking ranking{m_degreeRanking.get_allocator()};
+
+        for (const std::pair<size_type, size_type>& entry : m_degreeRanking) {
+            ranking.emplace_hint(
+                ranking.end(), entry.first, vertexSlots[entry.second]);
+        }
+
+        m_degreeRanking = std::move(ranking);
+
+        // The vertex and edge indices changed, so the pair index is rebuilt.
+        if (hasPairIndex()) { rebuildPairIndex(); }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Permutes the storage of the vertices and edges.
+     * \param order The dense indices of all the vertices in the order they
+     *              are to be stored in. The vertex order[i] gets the index i.
+     * \return A reference to this object.
+     * \note The edges are stored grouped by their source vertex in the new
+     *       order of the vertices. The outbound edges of a vertex keep their
+     *       order. Removes the tombstones.
+     * \note Complexity is linear in the amount of vertices and edges.
+     * \warning Invalidates all references, pointers and ranges into this
+     *          directed graph.
+     **/
+    this_type& reorderVertices(const std::vector<index_type>& order)
+    {
+        PL_ASSERT(order.size() == m_vertexCount);
+
+        std::pmr::vector<size_type> position(
+            m_vertices.size(), npos, m_vertices.get_allocator());
+
+        for (size_type i{0}; i < order.size(); ++i) {
+            PL_ASSERT(hasVertexAt(order[i]) and (position[order[i]] == npos));
+            position[order[i]] = i;
+        }
+
+        std::pmr::vector<tl::optional<vertex_type>> vertices{
+            m_vertices.get_allocator()};
+        edge_store                  edges{m_edges.resource()};
+        std::pmr::vector<Adjacency> adjacencies(
+            m_vertexCount, m_adjacencies.get_allocator());
+        std::pmr::vector<EndpointIndices> endpointIndices{
+            m_endpointIndices.get_allocator()};
+        std::pmr::vector<AdjacencyPositions> adjacencyPositions{
+            m_adjacencyPositions.get_allocator()};
+        vertices.reserve(m_vertexCount);
+        edges.reserve(m_edgeCount);
+        endpointIndices.reserve(m_edgeCount);
+        adjacencyPositions.reserve(m_edgeCount);
+
+        // Move the vertices to their new positions, each followed by its
+        // outbound edges.
+        for (size_type i{0}; i < order.size(); ++i) {
+            const size_type oldSlot{order[i]};
+            vertices.push_back(std::move(m_vertices[oldSlot]));
+            m_vertexIndices[vertices.back()->identifier()] = i;
+
+            for (size_type edgeSlot : m_adjacencies[oldSlot].outbound) {
+                const size_type slot{edges.size()};
+                const size_type target{
+                    position[m_endpointIndices[edgeSlot].target]};
+
+                adjacencyPositions.push_back(AdjacencyPositions{
+                    static_cast<index_type>(adjacencies[i].outbound.size()),
+                    static_cast<index_type>(
+                        adjacencies[target].inbound.size())});
+                adjacencies[i].outbound.push_back(slot);
+                adjacencies[target].inbound.push_back(slot);
+                endpointIndices.push_back(
+                    EndpointIndices{static_cast<index_type>(i),
+                                    static_cast<index_type>(target)});
+                edges.appendFrom(m_edges, edgeSlot);
+                m_edgeIndices[edges.identifier(slot)] = slot;
+            }
+        }
+
+        m_vertices           = std::move(vertices);
+        m_edges              = std::move(edges);
+        m_adjacencies        = std::move(adjacencies);
+        m_endpointIndices    = std::move(endpointIndices);
+        m_adjacencyPositions = std::move(adjacencyPositions);
+        rankVertices();
+
+        if (hasPairIndex()) { rebuildPairIndex(); }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Returns the amount of tombstones currently stored.
+     * \return The amount of removed vertices and edges that have not been
+     *         compacted away yet.
+     **/
+    PL_NODISCARD size_type tombstoneCount() const noexcept
+    {
+        return (m_vertices.size() - m_vertexCount)
+               + (m_edges.size() - m_edgeCount);
+    }
+
+    /*!
+     * \brief Sets the threshold for automatic compaction.
+     * \param threshold The fraction of the stored vertices or edges that
+     *                  must be tombstones for a removal to compact the
+     *                  directed graph. 1.0, the default, disables automatic
+     *                  compaction.
+     * \warning With automatic compaction enabled removals may invalidate
+     *          all references, pointers and ranges into this directed graph.
+     **/
+    void setCompactionThreshold(double threshold) noexcept
+    {
+        PL_ASSERT((threshold >= 0.0) and (threshold <= 1.0));
+        m_compactionThreshold = threshold;
+    }
+
+    /*!
+     * \brief Read accessor for the automatic compaction threshold.
+     * \return The threshold.
+     **/
+    PL_NODISCARD double compactionThreshold() const noexcept
+    {
+        return m_compactionThreshold;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes held by this directed graph.
+     * \return The bytes. The vertex and edge vectors count as vertices and
+     *         edges, including their tombstones. The hash indices, the
+     *         adjacency lists, the endpoint indices, the positions of the
+     *         edges in the adjacency lists, the degree ranking, the pair
+     *         index and the journal count as indices.
+     * \note Complexity is linear in the amount of vertices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        MemoryUsage result{sizeof(this_type),
+                           memory::usedBytes(m_vertices),
+                           m_edges.usedBytes(),
+                           memory::nodeBytes(m_vertexIndices)
+                               + memory::nodeBytes(m_edgeIndices)
+                               + memory::usedBytes(m_adjacencies)
+                               + memory::usedBytes(m_endpointIndices)
+                               + memory::usedBytes(m_adjacencyPositions)
+                               + memory::treeNodeBytes(m_degreeRanking),
+                           memory::bucketBytes(m_vertexIndices)
+                               + memory::bucketBytes(m_edgeIndices),
+                           memory::slackBytes(m_vertices)
+                               + m_edges.slackBytes()
+                               + memory::slackBytes(m_adjacencies)
+                               + memory::slackBytes(m_endpointIndices)
+                               + memory::slackBytes(m_adjacencyPositions)};
+
+        for (const Adjacency& adjacency : m_adjacencies) {
+            result.indices += memory::usedBytes(adjacency.outbound)
+                              + memory::usedBytes(adjacency.inbound);
+            result.slack += memory::slackBytes(adjacency.outbound)
+                            + memory::slackBytes(adjacency.inbound);
+        }
+
+        if (hasPairIndex()) {
+            result.indices += memory::nodeBytes(*m_pairIndex);
+            result.buckets += memory::bucketBytes(*m_pairIndex);
+
+            for (const auto& entry : *m_pairIndex) {
+                result.indices += memory::usedBytes(entry.second);
+                result.slack += memory::slackBytes(entry.second);
+            }
+        }
+
+        if (m_journal.has_value()) {
+            MemoryUsage journal{m_journal->memoryUsage()};
+            journal.object = 0; // Stored inside of this object.
+            result += journal;
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Releases the capacity that is not in use, for instance after
+     *        adding many vertices and edges.
+     * \return A reference to this object.
+     * \note Doesn't remove tombstones, see compact().
+     * \warning Invalidates all references, pointers and ranges into this
+     *          directed graph.
+     **/
+    this_type& shrinkToFit()
+    {
+        m_vertices.shrink_to_fit();
+        m_edges.shrinkToFit();
+        m_adjacencies.shrink_to_fit();
+        m_endpointIndices.shrink_to_fit();
+        m_adjacencyPositions.shrink_to_fit();
+
+        for (Adjacency& adjacency : m_adjacencies) {
+            adjacency.outbound.shrink_to_fit();
+            adjacency.inbound.shrink_to_fit();
+        }
+
+        // Let the hash indices pick the least bucket count for their size.
+        m_vertexIndices.rehash(0);
+        m_edgeIndices.rehash(0);
+
+        if (hasPairIndex()) {
+            for (auto& entry : *m_pairIndex) { entry.second.shrink_to_fit(); }
+
+            m_pairIndex->rehash(0);
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Starts recording the mutations of this directed graph.
+     * \param capacity The amount of mutations to keep records of, must not
+     *                 be 0.
+     * \note The journal starts at the version of this directed graph,
+     *       which counts the mutations while the journal is disabled, too.
+     *       If the journal is already enabled its records are discarded.
+     *       Either way consumers that are behind notice that they have to
+     *       rescan.
+     * \note The records are allocated from the memory resource of this
+     *       directed graph.
+     **/
+    void enableJournal(size_type capacity)
+    {
+        m_journal.emplace(capacity, m_version, resource());
+    }
+
+    /*!
+     * \brief Read accessor for the version number.
+     * \return The amount of mutations this directed graph has seen, whether
+     *         the journal was enabled or not. Equals the version of the
+     *         journal while it is enabled.
+     **/
+    PL_NODISCARD version_type version() const noexcept { return m_version; }
+
+    /*!
+     * \brief Read accessor for the identity.
+     * \return A number unique to this directed graph, renewed whenever its
+     *         contents are replaced by assignment or swap. Together with
+     *         version() it identifies the contents, e.g. for caches.
+     * \note The version alone doesn't, as it is copied by assignment.
+     **/
+    PL_NODISCARD identity_type identity() const noexcept
+    {
+        return m_identity.value();
+    }
+
+    /*!
+     * \brief Stops recording the mutations of this directed graph and
+     *        discards the journal.
+     **/
+    void disableJournal() noexcept { m_journal.reset(); }
+
+    /*!
+     * \brief Read accessor for the journal.
+     * \return The journal or nullopt if it is disabled.
+     * \note The journal is disabled by default. While it is disabled a
+     *       mutation costs a single branch.
+     **/
+    PL_NODISCARD tl::optional<const journal_type&> journal() const noexcept
+    {
+        if (not m_journal.has_value()) { return tl::nullopt; }
+
+        return tl::optional<const journal_type&>(*m_journal);
+    }
+
+    /*!
+     * \brief Indexes the edges by their source and target, so that
+     *        edgesBetween and hasEdgeBetween take constant time.
+     * \note Complexity is linear in the amount of edges. Does nothing if the
+     *       pair index is already enabled.
+     * \note The pair index is disabled by default. While it is disabled it
+     *       allocates nothing and a mutation costs a single branch.
+     **/
+    void enablePairIndex()
+    {
+        if (hasPairIndex()) { return; }
+
+        m_pairIndex.emplace(resource());
+        rebuildPairIndex();
+    }
+
+    /*!
+     * \brief Discards the pair index.
+     **/
+    void disablePairIndex() noexcept { m_pairIndex.reset(); }
+
+    /*!
+     * \brief Checks whether the pair index is enabled.
+     * \return true if the pair index is enabled; otherwise false.
+     **/
+    PL_NODISCARD bool hasPairIndex() const noexcept
+    {
+        return m_pairIndex.has_value();
+    }
+
     /*!
      * \brief Clears this directed graph so that it is empty,
      *        that is it contains no edges and no vertices.
      * \return A reference to this object.
+     * \note If the journal is enabled the removal of every edge and vertex
+     *       is recorded.
      **/
     this_type& clear()
     {
+        if (m_journal.has_value()) {
+            for (edge_reference edge : edges()) {
+                journalEdge(MutationKind::RemoveEdge, edge.identifier());
+            }
+
+            for (const vertex_type& vertex : vertices()) {
+                journalVertex(MutationKind::RemoveVertex, vertex.identifier());
+            }
+        }
+        else {
+            m_version += m_edgeCount + m_vertexCount;
+        }
+
         m_edges.clear();
         m_vertices.clear();
+        m_edgeIndices.clear();
+        m_vertexIndices.clear();
+        m_adjacencies.clear();
+        m_endpointIndices.clear();
+        m_adjacencyPositions.clear();
+        m_degreeRanking.clear();
+        m_vertexCount = 0;
+        m_edgeCount   = 0;
+
+        if (hasPairIndex()) { m_pairIndex->clear(); }
 
         return *this;
     }
@@ -545,13 +1645,37 @@ public:
     /*!
      * \brief Swaps this directed graph with another one.
      * \param other The other directed graph to swap with.
+     * \note Constant complexity if both directed graphs use the same memory
+     *       resource. Otherwise the elements are moved into the memory
+     *       resource of the other directed graph.
      **/
-    void swap(this_type& other) noexcept
+    void swap(this_type& other)
     {
         using std::swap;
 
+        if (resource() != other.resource()) {
+            this_type temporary{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(temporary);
+            return;
+        }
+
         swap(m_vertices, other.m_vertices);
         swap(m_edges, other.m_edges);
+        swap(m_vertexIndices, other.m_vertexIndices);
+        swap(m_edgeIndices, other.m_edgeIndices);
+        swap(m_adjacencies, other.m_adjacencies);
+        swap(m_endpointIndices, other.m_endpointIndices);
+        swap(m_adjacencyPositions, other.m_adjacencyPositions);
+        swap(m_degreeRanking, other.m_degreeRanking);
+        swap(m_vertexCount, other.m_vertexCount);
+        swap(m_edgeCount, other.m_edgeCount);
+        swap(m_compactionThreshold, other.m_compactionThreshold);
+        swap(m_version, other.m_version);
+        swap(m_journal, other.m_journal);
+        swap(m_pairIndex, other.m_pairIndex);
+        m_identity.renew();
+        other.m_identity.renew();
     }
 
     template<typename VertexIdentifierMapper, typename LabelExtractor>
@@ -561,7 +1685,7 @@ public:
     {
         graph_format::DataStructure result{};
 
-        for (const edge_type& edge : edges()) {
+        for (edge_reference edge : edges()) {
             result.append(
                 pl::invoke(vertexIdentifierMapper, edge.source()),
                 pl::invoke(vertexIdentifierMapper, edge.target()),
@@ -572,6 +1696,583 @@ public:
     }
 
 private:
+    template<typename, typename, typename, typename>
+    friend class DirectedGraphBuilder;
+
+    /*!
+     * \brief Hash index mapping vertex identifiers to positions in
+     *        m_vertices.
+     **/
+    using vertex_index_map
+        = std::pmr::unordered_map<vertex_identifier, size_type>;
+
+    /*!
+     * \brief Hash index mapping edge identifiers to positions in m_edges.
+     **/
+    using edge_index_map = std::pmr::unordered_map<edge_identifier, size_type>;
+
+    /*!
+     * \brief Positions of edges in m_edges.
+     **/
+    using slot_list = std::pmr::vector<size_type>;
+
+    /*!
+     * \brief The class type of the edges handed out, edge_type or the proxy.
+     **/
+    using edge_value = std::decay_t<edge_reference>;
+
+    /*!
+     * \brief Hash index mapping pairs of source and target vertex indices,
+     *        combined by pairKey, to the positions of the edges between
+     *        them in the order they were added.
+     **/
+    using pair_index_map = std::pmr::unordered_map<std::uint64_t, slot_list>;
+
+    /*!
+     * \brief Combines the dense indices of a source and a target vertex into
+     *        a key of the pair index.
+     * \param source The position of the source vertex in m_vertices.
+     * \param target The position of the target vertex in m_vertices.
+     * \return The key.
+     **/
+    PL_NODISCARD static std::uint64_t pairKey(
+        size_type source,
+        size_type target) noexcept
+    {
+        return (static_cast<std::uint64_t>(source) << 32U)
+               | static_cast<std::uint64_t>(target);
+    }
+
+    /*!
+     * \brief Enters an edge into the pair index if it is enabled.
+     * \param source The position of the source vertex in m_vertices.
+     * \param target The position of the target vertex in m_vertices.
+     * \param slot The position of the edge in m_edges.
+     **/
+    void indexPair(size_type source, size_type target, size_type slot)
+    {
+        if (not hasPairIndex()) { return; }
+
+        (*m_pairIndex)[pairKey(source, target)].push_back(slot);
+    }
+
+    /*!
+     * \brief Removes an edge from the pair index if it is enabled.
+     * \param source The position of the source vertex in m_vertices.
+     * \param target The position of the target vertex in m_vertices.
+     * \param slot The position of the edge in m_edges.
+     **/
+    void unindexPair(size_type source, size_type target, size_type slot)
+    {
+        if (not hasPairIndex()) { return; }
+
+        const typename pair_index_map::iterator it{
+            m_pairIndex->find(pairKey(source, target))};
+        eraseSlot(it->second, slot);
+
+        if (it->second.empty()) { m_pairIndex->erase(it); }
+    }
+
+    /*!
+     * \brief Rebuilds the pair index from the edges.
+     **/
+    void rebuildPairIndex()
+    {
+        m_pairIndex->clear();
+
+        for (size_type slot{0}; slot < m_edges.size(); ++slot) {
+            if (not m_edges.isLive(slot)) { continue; }
+
+            const EndpointIndices& endpoints{m_endpointIndices[slot]};
+            indexPair(endpoints.source, endpoints.target, slot);
+        }
+    }
+
+    /*!
+     * \brief The adjacency lists of a vertex.
+     *
+     * Stores the positions (in m_edges) of the edges leaving and
+     * entering a vertex in the order they were added, until edges are
+     * removed: removing an edge moves the last edge of a list into its place.
+     * Never refers to tombstones. Allocates from the memory resource of
+     * the directed graph it belongs to.
+     **/
+    struct Adjacency {
+        using allocator_type = std::pmr::polymorphic_allocator<size_type>;
+
+        explicit Adjacency(const allocator_type& allocator)
+            : outbound{allocator}, inbound{allocator}
+        {
+        }
+
+        Adjacency(const Adjacency& other, const allocator_type& allocator)
+            : outbound{other.outbound, allocator}
+            , inbound{other.inbound, allocator}
+        {
+        }
+
+        Adjacency(Adjacency&& other, const allocator_type& allocator)
+            : outbound{std::move(other.outbound), allocator}
+            , inbound{std::move(other.inbound), allocator}
+        {
+        }
+
+        Adjacency(const Adjacency&) = default;
+        Adjacency(Adjacency&&)      = default;
+        Adjacency& operator=(const Adjacency&) = default;
+        Adjacency& operator=(Adjacency&&) = default;
+
+        slot_list outbound; /*!< Edges leaving the vertex */
+        slot_list inbound;  /*!< Edges entering the vertex */
+    };
+
+    /*!
+     * \brief The positions of an edge in the adjacency lists of its
+     *        endpoints, so that it can be removed from them in constant
+     *        time.
+     **/
+    struct AdjacencyPositions {
+        index_type outbound; /*!< Position in the list of the source */
+        index_type inbound;  /*!< Position in the list of the target */
+    };
+
+    /*!
+     * \brief Fetches the edges referred to by one of the adjacency lists of a
+     *        vertex.
+     * \param vertex The vertex.
+     * \param list The adjacency list to use.
+     * \return A vector of pointers to the edges in the adjacency list of
+     *         vertex or an empty vector if there is no such vertex.
+     **/
+    PL_NODISCARD std::vector<edge_pointer> edgesOf(
+        vertex_identifier vertex,
+        slot_list Adjacency::*list) const
+    {
+        const edge_range          range{rangeOf(vertex, list)};
+        std::vector<edge_pointer> result{};
+        result.reserve(range.size());
+
+        for (auto it{range.begin()}; it != range.end(); ++it) {
+            result.push_back(m_edges.pointerAt(it.slot()));
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Creates a range over the edges referred to by one of the
+     *        adjacency lists of a vertex.
+     * \param vertex The vertex.
+     * \param list The adjacency list to use.
+     * \return The range or an empty range if there is no such vertex.
+     **/
+    PL_NODISCARD edge_range rangeOf(
+        vertex_identifier vertex,
+        slot_list Adjacency::*list) const noexcept
+    {
+        using iterator = typename edge_range::iterator;
+
+        const typename vertex_index_map::const_iterator it{
+            m_vertexIndices.find(vertex)};
+
+        // If we don't have the vertex -> return an empty range.
+        if (it == m_vertexIndices.end()) {
+            return edge_range{iterator{}, iterator{}};
+        }
+
+        return slotRange(m_adjacencies[it->second].*list);
+    }
+
+    /*!
+     * \brief Creates a range over the edges referred to by an adjacency list.
+     * \param slots The adjacency list.
+     * \return The range.
+     **/
+    PL_NODISCARD edge_range slotRange(const slot_list& slots) const
+        noexcept
+    {
+        return edge_range{m_edges.slotIterator(slots.data()),
+                          m_edges.slotIterator(slots.data() + slots.size()),
+                          slots.size()};
+    }
+
+    /*!
+     * \brief Predicate that is satisfied by edges that aren't loops.
+     **/
+    struct IsNotLoop {
+        bool operator()(edge_reference edge) const
+        {
+            return edge.source() != edge.target();
+        }
+    };
+
+    /*!
+     * \brief Pairs of (degree, position in m_vertices), one for each vertex.
+     **/
+    using degree_ranking = std::pmr::set<std::pair<size_type, size_type>>;
+
+    /*!
+     * \brief Returns the degree of the vertex at a given position.
+     * \param slot The position of the vertex in m_vertices.
+     * \return The degree.
+     **/
+    PL_NODISCARD size_type degreeOf(size_type slot) const noexcept
+    {
+        const Adjacency& adjacency{m_adjacencies[slot]};
+        return adjacency.outbound.size() + adjacency.inbound.size();
+    }
+
+    /*!
+     * \brief Enters the vertex at a given position into the degree ranking
+     *        using its current degree.
+     * \param slot The position of the vertex in m_vertices.
+     * \note Does nothing if the vertex is already ranked.
+     **/
+    void rankVertex(size_type slot)
+    {
+        m_degreeRanking.emplace(degreeOf(slot), slot);
+    }
+
+    /*!
+     * \brief Removes the vertex at a given position from the degree ranking.
+     *        Must be called before the degree of the vertex changes.
+     * \param slot The position of the vertex in m_vertices.
+     * \note Does nothing if the vertex is not ranked.
+     **/
+    void unrankVertex(size_type slot)
+    {
+        m_degreeRanking.erase(std::pair{degreeOf(slot), slot});
+    }
+
+    /*!
+     * \brief Removes an edge position from an adjacency list.
+     * \param slots The adjacency list.
+     * \param slot The edge position to remove.
+     **/
+    static void eraseSlot(slot_list& slots, size_type slot)
+    {
+        slots.erase(pl::algo::find(slots, slot));
+    }
+
+    /*!
+     * \brief Appends an edge to the adjacency lists of its endpoints and
+     *        remembers its positions in them.
+     * \param source The position of the source vertex in m_vertices.
+     * \param target The position of the target vertex in m_vertices.
+     * \param slot The position of the edge in m_edges, must be the next
+     *             one.
+     **/
+    void linkEdge(size_type source, size_type target, size_type slot)
+    {
+        slot_list& outbound{m_adjacencies[source].outbound};
+        slot_list& inbound{m_adjacencies[target].inbound};
+        PL_ASSERT((outbound.size() < UINT32_MAX)
+                  and (inbound.size() < UINT32_MAX));
+        PL_ASSERT(slot == m_adjacencyPositions.size());
+
+        m_adjacencyPositions.push_back(
+            AdjacencyPositions{static_cast<index_type>(outbound.size()),
+                               static_cast<index_type>(inbound.size())});
+        outbound.push_back(slot);
+        inbound.push_back(slot);
+    }
+
+    /*!
+     * \brief Removes an edge from the adjacency lists of its endpoints in
+     *        constant time by moving the last edge of each list into its
+     *        place.
+     * \param source The position of the source vertex in m_vertices.
+     * \param target The position of the target vertex in m_vertices.
+     * \param slot The position of the edge in m_edges.
+     **/
+    void unlinkEdge(size_type source, size_type target, size_type slot)
+    {
+        const AdjacencyPositions positions{m_adjacencyPositions[slot]};
+        swapAndPop(
+            m_adjacencies[source].outbound,
+            positions.outbound,
+            &AdjacencyPositions::outbound);
+        swapAndPop(
+            m_adjacencies[target].inbound,
+            positions.inbound,
+            &AdjacencyPositions::inbound);
+    }
+
+    /*!
+     * \brief Removes an entry from an adjacency list by moving the last
+     *        entry into its place.
+     * \param slots The adjacency list.
+     * \param position The position of the entry to remove.
+     * \param member The position of the edges moved to update.
+     **/
+    void swapAndPop(
+        slot_list&                      slots,
+        index_type                      position,
+        index_type AdjacencyPositions::*member) noexcept
+    {
+        const size_type moved{slots.back()};
+        slots[position]                     = moved;
+        m_adjacencyPositions[moved].*member = position;
+        slots.pop_back();
+    }
+
+    /*!
+     * \brief Replaces an edge with a tombstone.
+     * \param slot The position of the edge in m_edges.
+     **/
+    void eraseEdge(size_type slot)
+    {
+        const edge_identifier& identifier{m_edges.identifier(slot)};
+        const EndpointIndices& endpoints{m_endpointIndices[slot]};
+        const size_type        sourceSlot{endpoints.source};
+        const size_type        targetSlot{endpoints.target};
+
+        // Unlink the edge from the adjacency lists of its endpoints.
+        unrankVertex(sourceSlot);
+        unrankVertex(targetSlot);
+        unlinkEdge(sourceSlot, targetSlot, slot);
+        rankVertex(sourceSlot);
+        rankVertex(targetSlot);
+        unindexPair(sourceSlot, targetSlot, slot);
+
+        journalEdge(MutationKind::RemoveEdge, identifier);
+        m_edgeIndices.erase(identifier);
+        m_edges.erase(slot);
+        --m_edgeCount;
+    }
+
+    /*!
+     * \brief Counts a mutation of a vertex and records it if the journal is
+     *        enabled.
+     * \param kind The kind of the mutation.
+     * \param identifier The identifier of the vertex.
+     **/
+    void journalVertex(MutationKind kind, const vertex_identifier& identifier)
+    {
+        ++m_version;
+
+        if (m_journal.has_value()) {
+            m_journal->recordVertex(kind, identifier);
+        }
+    }
+
+    /*!
+     * \brief Counts a mutation of an edge and records it if the journal is
+     *        enabled.
+     * \param kind The kind of the mutation.
+     * \param identifier The identifier of the edge.
+     **/
+    void journalEdge(MutationKind kind, const edge_identifier& identifier)
+    {
+        ++m_version;
+
+        if (m_journal.has_value()) { m_journal->recordEdge(kind, identifier); }
+    }
+
+    /*!
+     * \brief Runs compact() if the share of tombstones exceeds the
+     *        compaction threshold.
+     **/
+    void compactIfNeeded()
+    {
+        const auto exceeds = [this](size_type live, size_type stored) {
+            return static_cast<double>(stored - live)
+                   > (m_compactionThreshold * static_cast<double>(stored));
+        };
+
+        if (exceeds(m_vertexCount, m_vertices.size())
+            or exceeds(m_edgeCount, m_edges.size())) {
+            compact();
+        }
+    }
+
+    /*!
+     * \brief The outcome of appendEdge.
+     **/
+    enum class AppendResult {
+        Appended,  /*!< The edge was added */
+        Duplicate, /*!< There already is an edge with that identifier */
+        Dangling   /*!< The source or the target vertex doesn't exist */
+    };
+
+    /*!
+     * \brief Reserves memory for the vertices and edges to be appended.
+     * \param vertexCount The amount of vertices to be appended.
+     * \param edgeCount The amount of edges to be appended.
+     **/
+    void reserveStorage(size_type vertexCount, size_type edgeCount)
+    {
+        m_vertexIndices.reserve(m_vertexIndices.size() + vertexCount);
+        m_vertices.reserve(m_vertices.size() + vertexCount);
+        m_adjacencies.reserve(m_adjacencies.size() + vertexCount);
+        m_edgeIndices.reserve(m_edgeIndices.size() + edgeCount);
+        m_endpointIndices.reserve(m_endpointIndices.size() + edgeCount);
+        m_adjacencyPositions.reserve(m_adjacencyPositions.size() + edgeCount);
+        m_edges.reserve(m_edges.size() + edgeCount);
+    }
+
+    /*!
+     * \brief Adds a vertex without entering it into the degree ranking.
+     * \param vertex The vertex. Only moved from if it was added.
+     * \return true if the vertex was added; false if there already is a
+     *         vertex with that identifier.
+     * \note rankVertices must be called once appending is done.
+     **/
+    PL_NODISCARD bool appendVertex(vertex_type&& vertex)
+    {
+        PL_ASSERT(m_vertices.size() < UINT32_MAX);
+
+        if (not m_vertexIndices.emplace(vertex.identifier(), m_vertices.size())
+                    .second) {
+            return false;
+        }
+
+        m_vertices.emplace_back(std::move(vertex));
+        m_adjacencies.emplace_back();
+        ++m_vertexCount;
+        return true;
+    }
+
+    /*!
+     * \brief Adds an edge without updating the degree ranking.
+     * \param edge The edge. Only moved from if it was added.
+     * \return The outcome.
+     * \note rankVertices must be called once appending is done.
+     **/
+    PL_NODISCARD AppendResult appendEdge(edge_type&& edge)
+    {
+        using iterator = typename vertex_index_map::const_iterator;
+
+        const iterator source{m_vertexIndices.find(edge.source())};
+        const iterator target{m_vertexIndices.find(edge.target())};
+
+        if ((source == m_vertexIndices.end())
+            or (target == m_vertexIndices.end())) {
+            return AppendResult::Dangling;
+        }
+
+        const size_type slot{m_edges.size()};
+
+        if (not m_edgeIndices.emplace(edge.identifier(), slot).second) {
+            return AppendResult::Duplicate;
+        }
+
+        linkEdge(source->second, target->second, slot);
+        indexPair(source->second, target->second, slot);
+        m_endpointIndices.push_back(
+            EndpointIndices{static_cast<index_type>(source->second),
+                            static_cast<index_type>(target->second)});
+        m_edges.append(std::move(edge));
+        ++m_edgeCount;
+        return AppendResult::Appended;
+    }
+
+    /*!
+     * \brief Rebuilds the degree ranking from scratch.
+     **/
+    void rankVertices()
+    {
+        m_degreeRanking.clear();
+
+        for (size_type slot{0}; slot < m_vertices.size(); ++slot) {
+            if (m_vertices[slot].has_value()) { rankVertex(slot); }
+        }
+    }
+
+    /*!
+     * \brief Marks positions that no longer refer to an element.
+     **/
+    static constexpr size_type npos{SIZE_MAX};
+
+    /*!
+     * \brief The amount of elements scanned by one task of the find functions
+     *        that take an execution policy.
+     **/
+    static constexpr size_type findChunkSize{4096};
+
+    /*!
+     * \brief Removes the tombstones from a vector and updates its hash index.
+     * \tparam ElementType The type of the elements in the vector.
+     * \tparam Index The type of the hash index.
+     * \param container The vector to compact.
+     * \param index The hash index of container.
+     * \param count The amount of elements in container that aren't
+     *              tombstones.
+     * \return Mapping from the old positions to the new positions, npos for
+     *         the tombstones.
+     **/
+    template<typename ElementType, typename Index>
+    static std::pmr::vector<size_type> compactElements(
+        std::pmr::vector<tl::optional<ElementType>>& container,
+        Index&                                       index,
+        size_type                                    count)
+    {
+        std::pmr::vector<size_type> mapping(
+            container.size(), npos, container.get_allocator());
+        std::pmr::vector<tl::optional<ElementType>> result{
+            container.get_allocator()};
+        result.reserve(count);
+
+        for (size_type slot{0}; slot < container.size(); ++slot) {
+            if (not container[slot].has_value()) { continue; }
+
+            mapping[slot] = result.size();
+            index[container[slot]->identifier()] = result.size();
+            result.push_back(std::move(container[slot]));
+        }
+
+        container = std::move(result);
+        return mapping;
+    }
+
+    /*!
+     * \brief Removes the tombstones from the edges and updates their hash
+     *        index.
+     * \return Mapping from the old positions to the new positions, npos for
+     *         the tombstones.
+     **/
+    std::pmr::vector<size_type> compactEdges()
+    {
+        std::pmr::vector<size_type> mapping(
+            m_edges.size(), npos, m_edges.resource());
+        edge_store result{m_edges.resource()};
+        result.reserve(m_edgeCount);
+
+        for (size_type slot{0}; slot < m_edges.size(); ++slot) {
+            if (not m_edges.isLive(slot)) { continue; }
+
+            mapping[slot]                          = result.size();
+            m_edgeIndices[m_edges.identifier(slot)] = result.size();
+            result.appendFrom(m_edges, slot);
+        }
+
+        m_edges = std::move(result);
+        return mapping;
+    }
+
+    /*!
+     * \brief Creates a range over the elements of a vector of optionals that
+     *        skips the tombstones.
+     * \tparam ElementType The type of the elements.
+     * \param container The vector.
+     * \param count The amount of elements that aren't tombstones.
+     * \return The range.
+     **/
+    template<typename ElementType>
+    PL_NODISCARD static views::Range<views::LiveIterator<ElementType>>
+    liveElements(
+        const std::pmr::vector<tl::optional<ElementType>>& container,
+        size_type                                          count) noexcept
+    {
+        using iterator = views::LiveIterator<ElementType>;
+
+        const tl::optional<ElementType>* const first{container.data()};
+        const tl::optional<ElementType>* const last{first + container.size()};
+
+        return views::Range<iterator>{
+            iterator{first, last}, iterator{last, last}, count};
+    }
+
     /*!
      * \brief Maps an optional with a given unary invocable.
      * \tparam Ty The type of the element possibly stored in the optional.
@@ -592,75 +2293,55 @@ private:
                 const Ty& element) { return pl::invoke(invocable, element); });
     }
 
-    /*!
-     * \brief Finds an element of a vector by a given identifier.
-     * \tparam ElementType The type of the elements in the vector.
-     * \param haystack The vector to search in.
-     * \param needle The identifier to search with.
-     * \return An iterator to the element in the vector with the
-     *         identifier needle or the vector's end iterator
-     *         if there's no such element.
-     **/
-    template<typename ElementType>
-    PL_NODISCARD static typename std::vector<ElementType>::const_iterator
-    findElementByIdentifier(
-        const std::vector<ElementType>&       haystack,
-        typename ElementType::identifier_type needle) noexcept
-    {
-        return pl::algo::find_if(
-            haystack, [&needle](const ElementType& element) {
-                return element.identifier() == needle;
-            });
-    }
-
     /*!
      * \brief Fetches an element from a vector.
      * \tparam ElementType The type of the elements in the vector.
+     * \tparam Index The type of the hash index.
      * \param container The vector to fetch an element from.
+     * \param index The hash index of container.
      * \param identifier The identifier of the element to fetch.
      * \return An optional containing a reference to the element
      *         if the vector given contains an element with the
      *         identifier given; otherwise a nullopt.
+     * \note Amortized constant complexity.
      **/
-    template<typename ElementType>
+    template<typename ElementType, typename Index>
     PL_NODISCARD static tl::optional<const ElementType&> fetchElement(
-        const std::vector<ElementType>&       container,
+        const std::pmr::vector<tl::optional<ElementType>>& container,
+        const Index&                                       index,
         typename ElementType::identifier_type identifier) noexcept
     {
-        const typename std::vector<ElementType>::const_iterator it{
-            findElementByIdentifier(container, identifier)};
+        const typename Index::const_iterator it{index.find(identifier)};
 
-        // If the element couldn't be found -> return a nullopt.
-        if (it == container.end()) { return tl::nullopt; }
+        // If the identifier isn't indexed -> there's no such element.
+        if (it == index.end()) { return tl::nullopt; }
 
-        return tl::optional<const ElementType&>(*it);
+        return tl::optional<const ElementType&>(*container[it->second]);
     }
 
     /*!
      * \brief Find elements that satisfy a given unary predicate.
-     * \tparam ElementType The type of the elements in the vector to search in.
+     * \tparam ElementType The type of the elements in the range to search in.
      * \tparam UnaryPredicate The type of the unary predicate.
-     * \param haystack The vector to search in.
+     * \param haystack The range to search in.
      * \param unaryPredicate The unary predicate to use.
      * \return A vector containing pointers to the elements that satisfy
      *         the predicate.
      **/
     template<typename ElementType, typename UnaryPredicate>
     PL_NODISCARD static std::vector<const ElementType*> findByUnaryPredicate(
-        const std::vector<ElementType>& haystack,
-        UnaryPredicate                  unaryPredicate)
+        const views::Range<views::LiveIterator<ElementType>>& haystack,
+        UnaryPredicate                                        unaryPredicate)
     {
         // There's no such thing as transform_if in the standard library.
 
         std::vector<const ElementType*> result{};
 
-        // Add all the elements which satisfy the predicate.
+        // Add all the elements which satisfy the predicate. They're unique,
+        // as every element is visited once.
         for (const ElementType& element : haystack) {
             if (pl::invoke(unaryPredicate, element)) {
-                // No duplicates!
-                if (not contains(result, &element)) {
-                    result.push_back(&element);
-                }
+                result.push_back(&element);
             }
         }
 
@@ -668,64 +2349,102 @@ private:
     }
 
     /*!
-     * \brief Returns an iterator to the vertex with the identifier given.
-     * \param vertexToFind The identifier.
-     * \return The iterator to the vertex with the given identifier or
-     *         the vertices vector's end iterator if no such vertex exists.
-     **/
-    PL_NODISCARD typename std::vector<vertex_type>::const_iterator
-    findVertexByIdentifier(vertex_identifier vertexToFind) const noexcept
-    {
-        return findElementByIdentifier(m_vertices, vertexToFind);
-    }
-
-    /*!
-     * \brief Returns an iterator to the edge with the identifier given.
-     * \param edgeToFind The identifier.
-     * \return The iterator to the edge with the given identifier or
-     *         the edges vector's end iterator if no such edge exists.
+     * \brief Find elements that satisfy a given unary predicate using an
+     *        execution policy.
+     * \tparam ExecutionPolicy The type of the execution policy.
+     * \tparam SlotPredicate The type of the predicate on the positions.
+     * \tparam SlotPointer The type of the invocable pointing to elements.
+     * \param policy The execution policy to use.
+     * \param slotCount The amount of positions to search, tombstones
+     *                  included.
+     * \param isMatch Returns whether there is an element satisfying the
+     *                unary predicate at the position given, false for
+     *                tombstones.
+     * \param pointerAt Returns a pointer to the element at the position
+     *                  given.
+     * \return A vector containing pointers to the elements that satisfy
+     *         the predicate in the order of their positions.
      **/
-    PL_NODISCARD typename std::vector<edge_type>::const_iterator
-    findEdgeByIdentifier(edge_identifier edgeToFind) const noexcept
+    template<
+        typename ExecutionPolicy,
+        typename SlotPredicate,
+        typename SlotPointer>
+    PL_NODISCARD static auto findInSlots(
+        ExecutionPolicy&     policy,
+        size_type            slotCount,
+        const SlotPredicate& isMatch,
+        const SlotPointer&   pointerAt)
     {
-        return findElementByIdentifier(m_edges, edgeToFind);
-    }
+        using namespace pl::literals::integer_literals;
 
-    /*!
-     * \brief Finds the vertex with the 'maximum' degree according to
-     *        a given comparator.
-     * \tparam InitialDegree The initial degree value to use for the
-     *                       accumulator.
-     * \tparam BinaryComparator The type of the binary comparator.
-     * \param binaryComparator The binary comparator.
-     * \return The resulting VertexWithDegree struct.
-     * \warning The pointer in the struct returned may be nullptr!
-     **/
-    template<std::size_t InitialDegree, typename BinaryComparator>
-    PL_NODISCARD VertexWithDegree
-    degreeByComparator(BinaryComparator binaryComparator) const
-    {
-        return pl::algo::accumulate(
-            m_vertices,
-            VertexWithDegree{nullptr, InitialDegree},
-            [this, &binaryComparator](
-                VertexWithDegree accumulator, const vertex_type& rhs) {
-                const size_type rhsDegree{degree(rhs.identifier())};
-
-                // If rhs is 'greater' according to the comparator -> update the
-                // accumulator to be rhs.
-                if (pl::invoke(
-                        binaryComparator, rhsDegree, accumulator.degree)) {
-                    return VertexWithDegree{&rhs, rhsDegree};
+        using pointer = decltype(pointerAt(size_type{}));
+
+        const size_type chunkCount{
+            (slotCount + findChunkSize - 1_zu) / findChunkSize};
+
+        // Every chunk collects its matches on its own, so the chunks don't
+        // have to synchronize.
+        std::vector<std::vector<pointer>> chunks(chunkCount);
+
+        std::for_each(
+            policy,
+            chunks.begin(),
+            chunks.end(),
+            [slotCount, &isMatch, &pointerAt, &chunks](
+                std::vector<pointer>& chunk) {
+                const size_type first{
+                    static_cast<size_type>(&chunk - chunks.data())
+                    * findChunkSize};
+                const size_type last{
+                    std::min(first + findChunkSize, slotCount)};
+
+                for (size_type i{first}; i < last; ++i) {
+                    if (isMatch(i)) { chunk.push_back(pointerAt(i)); }
                 }
-
-                // Otherwise keep the same accumulator as before.
-                return accumulator;
             });
+
+        size_type matchCount{0};
+
+        for (const std::vector<pointer>& chunk : chunks) {
+            matchCount += chunk.size();
+        }
+
+        std::vector<pointer> result{};
+        result.reserve(matchCount);
+
+        for (const std::vector<pointer>& chunk : chunks) {
+            result.insert(result.end(), chunk.begin(), chunk.end());
+        }
+
+        return result;
     }
 
-    std::vector<vertex_type> m_vertices; /*!< The vertices */
-    std::vector<edge_type>   m_edges;    /*!< The edges */
+    std::pmr::vector<tl::optional<vertex_type>>
+        m_vertices; /*!< The vertices, nullopt for tombstones */
+    edge_store m_edges; /*!< The edges, with tombstones */
+
+    vertex_index_map
+        m_vertexIndices; /*!< Vertex identifier -> position in m_vertices */
+    edge_index_map
+        m_edgeIndices; /*!< Edge identifier -> position in m_edges */
+    std::pmr::vector<Adjacency>
+        m_adjacencies; /*!< Adjacency lists, parallel to m_vertices */
+    std::pmr::vector<EndpointIndices>
+        m_endpointIndices; /*!< Endpoints of the edges, parallel to m_edges */
+    std::pmr::vector<AdjacencyPositions>
+        m_adjacencyPositions; /*!< Positions in m_adjacencies, per edge */
+    degree_ranking
+        m_degreeRanking; /*!< The vertices ordered by degree and position */
+    size_type    m_vertexCount; /*!< Vertices that aren't tombstones */
+    size_type    m_edgeCount;   /*!< Edges that aren't tombstones */
+    double       m_compactionThreshold; /*!< Share of tombstones to compact */
+    version_type m_version; /*!< Mutations, whether journaled or not */
+    detail::ObjectIdentity
+        m_identity; /*!< Renewed whenever the contents are replaced */
+    tl::optional<journal_type>
+        m_journal; /*!< Records the mutations, nullopt if disabled */
+    tl::optional<pair_index_map>
+        m_pairIndex; /*!< Edges by source and target, nullopt if disabled */
 };
 
 /*!
@@ -736,6 +2455,7 @@ private:
  * \tparam EdgeIdentifier The type of which instances are used to uniquely
  *                        identify edges.
  * \tparam EdgeData The type of the data stored on an edge.
+ * \tparam EdgeStorage The edge storage policy.
  * \param lhs The first operand.
  * \param rhs The second operand.
  * \note Can be found by argument dependent lookup (ADL).
@@ -744,11 +2464,21 @@ template<
     typename VertexIdentifier,
     typename VertexData,
     typename EdgeIdentifier,
-    typename EdgeData>
+    typename EdgeData,
+    typename EdgeStorage>
 void swap(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>& lhs,
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-        rhs) noexcept
+    DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData,
+        EdgeStorage>& lhs,
+    DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData,
+        EdgeStorage>& rhs)
 {
     lhs.swap(rhs);
 }
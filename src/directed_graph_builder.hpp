@@ -0,0 +1,481 @@
+/*!
+ * \file directed_graph_builder.hpp
+ * \brief Exports the DirectedGraphBuilder class template used to construct
+ *        large directed graphs in bulk.
+ **/
+#ifndef INCG_GP_DIRECTED_GRAPH_BUILDER_HPP
+#define INCG_GP_DIRECTED_GRAPH_BUILDER_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include <algorithm> // std::sort, std::binary_search, std::transform, ...
+#include <ciso646>   // not, and, or
+#include <execution> // std::execution::par, ...
+#include <iterator>  // std::make_move_iterator
+#include <numeric>   // std::iota
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <utility>            // std::move
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief Collects vertices and edges and creates a DirectedGraph from them
+ *        in a single pass.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam VertexData The type of the data stored on a vertex.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ *
+ * Unlike DirectedGraph::addVertex and DirectedGraph::addEdge nothing is
+ * validated when appending. The identifiers and the endpoints are validated
+ * once when build is called. Elements that DirectedGraph::addVertex or
+ * DirectedGraph::addEdge would have rejected if they were added in the
+ * same order are reported in the Result.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+class DirectedGraphBuilder {
+public:
+    using this_type = DirectedGraphBuilder;
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using vertex_identifier = typename graph_type::vertex_identifier;
+    using vertex_data       = typename graph_type::vertex_data;
+    using edge_identifier   = typename graph_type::edge_identifier;
+    using edge_data         = typename graph_type::edge_data;
+    using vertex_type       = typename graph_type::vertex_type;
+    using edge_type         = typename graph_type::edge_type;
+    using size_type         = typename graph_type::size_type;
+
+    /*!
+     * \brief The outcome of building a directed graph.
+     **/
+    struct Result {
+        graph_type graph; /*!< The graph built from the accepted elements */
+        std::vector<vertex_type>
+            duplicateVertices; /*!< Vertices with an identifier in use */
+        std::vector<edge_type>
+            duplicateEdges; /*!< Edges with an identifier in use */
+        std::vector<edge_type>
+            danglingEdges; /*!< Edges with a source or target that isn't a
+                                vertex of the graph */
+
+        /*!
+         * \brief Checks whether every element appended was accepted.
+         * \return true if nothing was rejected; otherwise false.
+         **/
+        PL_NODISCARD bool isComplete() const noexcept
+        {
+            return duplicateVertices.empty() and duplicateEdges.empty()
+                   and danglingEdges.empty();
+        }
+    };
+
+    /*!
+     * \brief Creates an empty builder.
+     **/
+    DirectedGraphBuilder() : m_vertices{}, m_edges{} {}
+
+    /*!
+     * \brief Reserves memory for the elements to append.
+     * \param vertexCount The amount of vertices expected.
+     * \param edgeCount The amount of edges expected.
+     * \return A reference to this object.
+     **/
+    this_type& reserve(size_type vertexCount, size_type edgeCount)
+    {
+        m_vertices.reserve(vertexCount);
+        m_edges.reserve(edgeCount);
+        return *this;
+    }
+
+    /*!
+     * \brief Appends a vertex.
+     * \param identifier The unique identifier for the vertex.
+     * \param data The data to store on the vertex.
+     * \return A reference to this object.
+     **/
+    this_type& addVertex(vertex_identifier identifier, vertex_data data)
+    {
+        m_vertices.emplace_back(std::move(identifier), std::move(data));
+        return *this;
+    }
+
+    /*!
+     * \brief Appends the vertices of an iterator range.
+     * \tparam InputIterator The type of the iterators. Must yield objects
+     *                       convertible to vertex_type. Use
+     *                       std::make_move_iterator to move the vertices.
+     * \param first Iterator to the first vertex.
+     * \param last Iterator one past the last vertex.
+     * \return A reference to this object.
+     **/
+    template<typename InputIterator>
+    this_type& addVertices(InputIterator first, InputIterator last)
+    {
+        m_vertices.insert(m_vertices.end(), first, last);
+        return *this;
+    }
+
+    /*!
+     * \brief Appends a batch of vertices by moving them.
+     * \param vertices The vertices.
+     * \return A reference to this object.
+     **/
+    this_type& addVertices(std::vector<vertex_type>&& vertices)
+    {
+        return appendBatch(m_vertices, std::move(vertices));
+    }
+
+    /*!
+     * \brief Appends an edge.
+     * \param identifier The unique identifier to use for the edge.
+     * \param source The source vertex.
+     * \param target The target vertex.
+     * \param data The data to store on the edge.
+     * \return A reference to this object.
+     **/
+    this_type& addEdge(
+        edge_identifier   identifier,
+        vertex_identifier source,
+        vertex_identifier target,
+        edge_data         data)
+    {
+        m_edges.emplace_back(
+            std::move(identifier),
+            std::move(source),
+            std::move(target),
+            std::move(data));
+        return *this;
+    }
+
+    /*!
+     * \brief Appends the edges of an iterator range.
+     * \tparam InputIterator The type of the iterators. Must yield objects
+     *                       convertible to edge_type. Use
+     *                       std::make_move_iterator to move the edges.
+     * \param first Iterator to the first edge.
+     * \param last Iterator one past the last edge.
+     * \return A reference to this object.
+     **/
+    template<typename InputIterator>
+    this_type& addEdges(InputIterator first, InputIterator last)
+    {
+        m_edges.insert(m_edges.end(), first, last);
+        return *this;
+    }
+
+    /*!
+     * \brief Appends a batch of edges by moving them.
+     * \param edges The edges.
+     * \return A reference to this object.
+     **/
+    this_type& addEdges(std::vector<edge_type>&& edges)
+    {
+        return appendBatch(m_edges, std::move(edges));
+    }
+
+    /*!
+     * \brief Queries the amount of vertices appended so far.
+     * \return The amount of vertices appended.
+     **/
+    PL_NODISCARD size_type vertexCount() const noexcept
+    {
+        return m_vertices.size();
+    }
+
+    /*!
+     * \brief Queries the amount of edges appended so far.
+     * \return The amount of edges appended.
+     **/
+    PL_NODISCARD size_type edgeCount() const noexcept { return m_edges.size(); }
+
+    /*!
+     * \brief Builds the directed graph, validating the elements appended
+     *        using hash lookups.
+     * \return The result.
+     * \note Leaves this builder empty.
+     * \note Complexity is linear in the amount of elements appended.
+     **/
+    PL_NODISCARD Result build()
+    {
+        Result result{};
+        result.graph.reserveStorage(m_vertices.size(), m_edges.size());
+
+        for (vertex_type& vertex : m_vertices) {
+            if (not result.graph.appendVertex(std::move(vertex))) {
+                result.duplicateVertices.push_back(std::move(vertex));
+            }
+        }
+
+        for (edge_type& edge : m_edges) {
+            appendEdge(result, std::move(edge));
+        }
+
+        return finish(std::move(result));
+    }
+
+    /*!
+     * \brief Builds the directed graph, sorting and validating the elements
+     *        appended using the execution policy given.
+     * \tparam ExecutionPolicy The type of the execution policy, for instance
+     *                         the type of std::execution::par.
+     * \param policy The execution policy to use for the sorting and the
+     *               validation.
+     * \return The result, identical to the one build() would return.
+     * \note Requires vertex_identifier and edge_identifier to be ordered
+     *       by operator<.
+     * \note Leaves this builder empty.
+     * \note Complexity is O(n * log(n)) in the amount of elements appended.
+     *       Inserting the accepted elements into the graph is sequential.
+     **/
+    template<typename ExecutionPolicy>
+    PL_NODISCARD Result build(ExecutionPolicy&& policy)
+    {
+        // Positions into m_vertices ordered by identifier, the first
+        // occurrence of every identifier first.
+        const std::vector<size_type> vertexOrder{sortedPositions(
+            policy, m_vertices, [](size_type) { return true; })};
+        const std::vector<char> isVertexAccepted{
+            markFirstOccurrences(policy, m_vertices, vertexOrder)};
+
+        std::vector<size_type> acceptedVertices(vertexOrder.size());
+        acceptedVertices.erase(
+            std::copy_if(
+                policy,
+                vertexOrder.begin(),
+                vertexOrder.end(),
+                acceptedVertices.begin(),
+                [&isVertexAccepted](size_type position) {
+                    return isVertexAccepted[position] != 0;
+                }),
+            acceptedVertices.end());
+
+        // Determine the edges of which both endpoints are accepted vertices.
+        const auto isVertex = [this, &acceptedVertices](
+                                  const vertex_identifier& identifier) {
+            return std::binary_search(
+                acceptedVertices.begin(),
+                acceptedVertices.end(),
+                identifier,
+                IdentifierLess<vertex_type>{m_vertices});
+        };
+
+        std::vector<char> isEdgeConnected(m_edges.size());
+        std::transform(
+            policy,
+            m_edges.begin(),
+            m_edges.end(),
+            isEdgeConnected.begin(),
+            [&isVertex](const edge_type& edge) -> char {
+                return isVertex(edge.source()) and isVertex(edge.target());
+            });
+
+        // Of those the first occurrence of every identifier is accepted.
+        const std::vector<size_type> edgeOrder{sortedPositions(
+            policy, m_edges, [&isEdgeConnected](size_type position) {
+                return isEdgeConnected[position] != 0;
+            })};
+        const std::vector<char> isEdgeAccepted{
+            markFirstOccurrences(policy, m_edges, edgeOrder)};
+
+        // Put the graph together.
+        Result result{};
+        result.graph.reserveStorage(acceptedVertices.size(), edgeOrder.size());
+
+        for (size_type i{0}; i < m_vertices.size(); ++i) {
+            if (isVertexAccepted[i] != 0) {
+                (void)result.graph.appendVertex(std::move(m_vertices[i]));
+            }
+            else {
+                result.duplicateVertices.push_back(std::move(m_vertices[i]));
+            }
+        }
+
+        for (size_type i{0}; i < m_edges.size(); ++i) {
+            if (isEdgeAccepted[i] != 0) {
+                appendEdge(result, std::move(m_edges[i]));
+            }
+            else if (isEdgeConnected[i] != 0) {
+                result.duplicateEdges.push_back(std::move(m_edges[i]));
+            }
+            else {
+                result.danglingEdges.push_back(std::move(m_edges[i]));
+            }
+        }
+
+        return finish(std::move(result));
+    }
+
+private:
+    /*!
+     * \brief Orders positions into a vector by the identifiers of the
+     *        elements at those positions.
+     * \tparam ElementType The type of the elements.
+     **/
+    template<typename ElementType>
+    struct IdentifierLess {
+        using identifier_type = typename ElementType::identifier_type;
+
+        bool operator()(size_type lhs, size_type rhs) const
+        {
+            const identifier_type& lhsIdentifier{elements[lhs].identifier()};
+            const identifier_type& rhsIdentifier{elements[rhs].identifier()};
+
+            if (lhsIdentifier < rhsIdentifier) { return true; }
+
+            if (rhsIdentifier < lhsIdentifier) { return false; }
+
+            return lhs < rhs;
+        }
+
+        bool operator()(size_type lhs, const identifier_type& rhs) const
+        {
+            return elements[lhs].identifier() < rhs;
+        }
+
+        bool operator()(const identifier_type& lhs, size_type rhs) const
+        {
+            return lhs < elements[rhs].identifier();
+        }
+
+        const std::vector<ElementType>& elements;
+    };
+
+    /*!
+     * \brief Appends a batch to a vector by moving.
+     * \param destination The vector to append to.
+     * \param batch The elements to append.
+     * \return A reference to this object.
+     **/
+    template<typename ElementType>
+    this_type& appendBatch(
+        std::vector<ElementType>&   destination,
+        std::vector<ElementType>&& batch)
+    {
+        // Adopt the buffer if there's nothing to append to.
+        if (destination.empty()) {
+            destination = std::move(batch);
+            return *this;
+        }
+
+        destination.insert(
+            destination.end(),
+            std::make_move_iterator(batch.begin()),
+            std::make_move_iterator(batch.end()));
+        return *this;
+    }
+
+    /*!
+     * \brief Creates the positions of the elements of a vector that satisfy
+     *        a predicate ordered by identifier and then by position.
+     * \param policy The execution policy to use.
+     * \param elements The elements.
+     * \param unaryPredicate The predicate, called with positions.
+     * \return The positions.
+     **/
+    template<
+        typename ExecutionPolicy,
+        typename ElementType,
+        typename UnaryPredicate>
+    PL_NODISCARD static std::vector<size_type> sortedPositions(
+        ExecutionPolicy&                policy,
+        const std::vector<ElementType>& elements,
+        UnaryPredicate                  unaryPredicate)
+    {
+        std::vector<size_type> positions(elements.size());
+        std::iota(positions.begin(), positions.end(), size_type{0});
+
+        positions.erase(
+            std::remove_if(
+                policy,
+                positions.begin(),
+                positions.end(),
+                [&unaryPredicate](size_type position) {
+                    return not unaryPredicate(position);
+                }),
+            positions.end());
+
+        std::sort(
+            policy,
+            positions.begin(),
+            positions.end(),
+            IdentifierLess<ElementType>{elements});
+
+        return positions;
+    }
+
+    /*!
+     * \brief Marks the first occurrence of every identifier.
+     * \param policy The execution policy to use.
+     * \param elements The elements.
+     * \param order Positions into elements as returned by sortedPositions.
+     * \return A flag for every element that is non-zero if the element is
+     *         the first one with its identifier among the elements in order.
+     **/
+    template<typename ExecutionPolicy, typename ElementType>
+    PL_NODISCARD static std::vector<char> markFirstOccurrences(
+        ExecutionPolicy&                policy,
+        const std::vector<ElementType>& elements,
+        const std::vector<size_type>&   order)
+    {
+        std::vector<char> result(elements.size(), 0);
+
+        std::vector<size_type> ranks(order.size());
+        std::iota(ranks.begin(), ranks.end(), size_type{0});
+
+        // Every rank writes a different element of result.
+        std::for_each(
+            policy,
+            ranks.begin(),
+            ranks.end(),
+            [&elements, &order, &result](size_type rank) {
+                const size_type position{order[rank]};
+                result[position]
+                    = (rank == 0)
+                      or (elements[order[rank - 1]].identifier()
+                          != elements[position].identifier());
+            });
+
+        return result;
+    }
+
+    /*!
+     * \brief Appends an edge to the graph of a result or rejects it.
+     * \param result The result.
+     * \param edge The edge.
+     **/
+    static void appendEdge(Result& result, edge_type&& edge)
+    {
+        switch (result.graph.appendEdge(std::move(edge))) {
+        case graph_type::AppendResult::Appended: return;
+        case graph_type::AppendResult::Duplicate:
+            result.duplicateEdges.push_back(std::move(edge));
+            return;
+        case graph_type::AppendResult::Dangling:
+            result.danglingEdges.push_back(std::move(edge));
+            return;
+        }
+    }
+
+    /*!
+     * \brief Finishes building.
+     * \param result The result to finish.
+     * \return The finished result.
+     **/
+    Result finish(Result&& result)
+    {
+        result.graph.rankVertices();
+        m_vertices.clear();
+        m_edges.clear();
+        return std::move(result);
+    }
+
+    std::vector<vertex_type> m_vertices; /*!< The vertices appended */
+    std::vector<edge_type>   m_edges;    /*!< The edges appended */
+};
+} // namespace gp
+#endif // INCG_GP_DIRECTED_GRAPH_BUILDER_HPP
@@ -1,5 +1,6 @@
 #ifndef INCG_GP_EDGE_HPP
 #define INCG_GP_EDGE_HPP
+#include "data_storage.hpp"   // gp::detail::DataStorage
 #include "vertex.hpp"         // gp::Vertex
 #include <ciso646>            // not
 #include <pl/annotations.hpp> // PL_NODISCARD
@@ -13,9 +14,13 @@ namespace gp {
  * \tparam EdgeData The type of the data stored on the edge.
  * \tparam VertexIdentifier The type of which instances are used to uniquely
  *                          identify vertices.
+ * \note Tag types, like std::nullptr_t or empty classes, used as EdgeData
+ *       take no space.
  **/
 template<typename EdgeIdentifier, typename EdgeData, typename VertexIdentifier>
-class Edge {
+class Edge : private detail::DataStorage<EdgeData> {
+    using data_storage = detail::DataStorage<EdgeData>;
+
 public:
     using this_type        = Edge;
     using vertex_identifer = VertexIdentifier;
@@ -34,10 +39,10 @@ public:
         vertex_identifer source,
         vertex_identifer target,
         data_type        data)
-        : m_identifier{std::move(identifier)}
+        : data_storage{std::move(data)}
+        , m_identifier{std::move(identifier)}
         , m_source{std::move(source)}
         , m_target{std::move(target)}
-        , m_data{std::move(data)}
     {
     }
 
@@ -72,7 +77,10 @@ public:
      * \brief Read accessor for the edge data.
      * \return The edge data.
      **/
-    PL_NODISCARD const data_type& data() const noexcept { return m_data; }
+    PL_NODISCARD const data_type& data() const noexcept
+    {
+        return data_storage::get();
+    }
 
     /*!
      * \brief Compares two edges for equality.
@@ -109,14 +117,13 @@ public:
         swap(m_identifier, other.m_identifier);
         swap(m_source, other.m_source);
         swap(m_target, other.m_target);
-        swap(m_data, other.m_data);
+        data_storage::swap(other);
     }
 
 private:
     identifier_type  m_identifier;
     vertex_identifer m_source;
     vertex_identifer m_target;
-    data_type        m_data;
 };
 
 /*!
@@ -0,0 +1,811 @@
+/*!
+ * \file edge_storage.hpp
+ * \brief Exports the edge storage policies of DirectedGraph.
+ **/
+#ifndef INCG_GP_EDGE_STORAGE_HPP
+#define INCG_GP_EDGE_STORAGE_HPP
+#include "edge.hpp"           // gp::Edge
+#include "memory_usage.hpp"   // gp::memory::usedBytes, ...
+#include "views.hpp"          // gp::views::LiveIterator, ...
+#include <ciso646>            // and, not, or
+#include <climits>            // CHAR_BIT
+#include <cstddef>            // std::size_t, std::ptrdiff_t, std::nullptr_t
+#include <iterator>           // std::forward_iterator_tag, ...
+#include <memory_resource>    // std::pmr::memory_resource
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <tl/optional.hpp>    // tl::optional
+#include <type_traits>        // std::enable_if_t, std::is_empty, ...
+#include <utility>            // std::move
+#include <vector>             // std::pmr::vector
+
+namespace gp {
+/*!
+ * \brief Edge storage policy of DirectedGraph that stores every edge as a
+ *        gp::Edge, so that edges are handed out as const references. The
+ *        default.
+ **/
+struct RowStorage {
+};
+
+/*!
+ * \brief Edge storage policy of DirectedGraph that stores the identifiers,
+ *        the sources, the targets and the data of the edges in separate
+ *        columns.
+ *
+ * Edges are handed out as proxies providing the read accessors of gp::Edge,
+ * so that a scan over the edges, like findEdges or bellman_ford::algorithm,
+ * only reads the columns it needs.
+ **/
+struct ColumnStorage {
+};
+
+namespace detail {
+/*!
+ * \brief Stores the data of many edges as a column, one element per edge.
+ * \tparam Data The type of the data.
+ * \note The specialization for tag types takes no space per element.
+ **/
+template<typename Data, typename = void>
+class DataColumn {
+public:
+    explicit DataColumn(std::pmr::memory_resource* resource) : m_data(resource)
+    {
+    }
+
+    PL_NODISCARD const Data& operator[](std::size_t index) const noexcept
+    {
+        return m_data[index].value;
+    }
+
+    void append(Data data) { m_data.push_back(Element{std::move(data)}); }
+
+    /*!
+     * \brief Moves an element of another column to the end of this one.
+     * \param other The other column.
+     * \param index The position of the element in other.
+     **/
+    void appendFrom(DataColumn& other, std::size_t index)
+    {
+        m_data.push_back(Element{std::move(other.m_data[index].value)});
+    }
+
+    void reserve(std::size_t capacity) { m_data.reserve(capacity); }
+
+    void shrinkToFit() { m_data.shrink_to_fit(); }
+
+    void clear() noexcept { m_data.clear(); }
+
+    PL_NODISCARD std::size_t usedBytes() const noexcept
+    {
+        return memory::usedBytes(m_data);
+    }
+
+    PL_NODISCARD std::size_t slackBytes() const noexcept
+    {
+        return memory::slackBytes(m_data);
+    }
+
+private:
+    /*!
+     * \brief Wraps an element, so that a column of bool isn't a
+     *        std::vector<bool>, which can't hand out references.
+     **/
+    struct Element {
+        Data value;
+    };
+
+    std::pmr::vector<Element> m_data;
+};
+
+/*!
+ * \brief Keeps a single instance of a tag type for the whole column, as its
+ *        values are all alike.
+ **/
+template<typename Data>
+class DataColumn<
+    Data,
+    std::enable_if_t<
+        std::is_empty<Data>::value
+        or std::is_same<Data, std::nullptr_t>::value>> {
+public:
+    explicit DataColumn(std::pmr::memory_resource*) noexcept : m_data{} {}
+
+    PL_NODISCARD const Data& operator[](std::size_t) const noexcept
+    {
+        return *m_data;
+    }
+
+    void append(Data data)
+    {
+        if (not m_data.has_value()) { m_data.emplace(std::move(data)); }
+    }
+
+    void appendFrom(DataColumn& other, std::size_t)
+    {
+        if (not m_data.has_value()) { m_data = other.m_data; }
+    }
+
+    void reserve(std::size_t) noexcept {}
+
+    void shrinkToFit() noexcept {}
+
+    void clear() noexcept {}
+
+    PL_NODISCARD std::size_t usedBytes() const noexcept { return 0; }
+
+    PL_NODISCARD std::size_t slackBytes() const noexcept { return 0; }
+
+private:
+    tl::optional<Data> m_data;
+};
+
+/*!
+ * \brief The edges of a DirectedGraph, stored according to a storage
+ *        policy.
+ * \tparam Storage The storage policy, RowStorage or ColumnStorage.
+ * \tparam EdgeIdentifier The type of the unique identifiers of the edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ * \tparam VertexIdentifier The type of the unique identifiers of the
+ *                          vertices.
+ *
+ * Every edge has a position (slot). Removing an edge leaves a tombstone in
+ * its slot, so that the slots of the other edges stay the same.
+ **/
+template<
+    typename Storage,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename VertexIdentifier>
+class EdgeStore;
+
+/*!
+ * \brief Stores the edges as rows of gp::Edge.
+ **/
+template<typename EdgeIdentifier, typename EdgeData, typename VertexIdentifier>
+class EdgeStore<RowStorage, EdgeIdentifier, EdgeData, VertexIdentifier> {
+public:
+    using edge_type     = Edge<EdgeIdentifier, EdgeData, VertexIdentifier>;
+    using size_type     = std::size_t;
+    using reference     = const edge_type&;
+    using pointer       = const edge_type*;
+    using live_iterator = views::LiveIterator<edge_type>;
+    using slot_iterator
+        = views::SlotIterator<edge_type, tl::optional<edge_type>>;
+
+    explicit EdgeStore(std::pmr::memory_resource* resource) : m_rows{resource}
+    {
+    }
+
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_rows.get_allocator().resource();
+    }
+
+    /*!
+     * \brief Returns the amount of slots, tombstones included.
+     * \return The amount of slots.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_rows.size(); }
+
+    PL_NODISCARD bool isLive(size_type slot) const noexcept
+    {
+        return m_rows[slot].has_value();
+    }
+
+    PL_NODISCARD reference operator[](size_type slot) const noexcept
+    {
+        return *m_rows[slot];
+    }
+
+    PL_NODISCARD pointer pointerAt(size_type slot) const noexcept
+    {
+        return &*m_rows[slot];
+    }
+
+    PL_NODISCARD const EdgeIdentifier& identifier(size_type slot) const
+        noexcept
+    {
+        return m_rows[slot]->identifier();
+    }
+
+    PL_NODISCARD live_iterator liveBegin() const noexcept
+    {
+        return live_iterator{m_rows.data(), m_rows.data() + m_rows.size()};
+    }
+
+    PL_NODISCARD live_iterator liveEnd() const noexcept
+    {
+        const tl::optional<edge_type>* const last{
+            m_rows.data() + m_rows.size()};
+        return live_iterator{last, last};
+    }
+
+    PL_NODISCARD slot_iterator slotIterator(const size_type* slot) const
+        noexcept
+    {
+        return slot_iterator{m_rows.data(), slot};
+    }
+
+    void append(
+        EdgeIdentifier   identifier,
+        VertexIdentifier source,
+        VertexIdentifier target,
+        EdgeData         data)
+    {
+        m_rows.emplace_back(edge_type{std::move(identifier),
+                                      std::move(source),
+                                      std::move(target),
+                                      std::move(data)});
+    }
+
+    void append(edge_type&& edge) { m_rows.emplace_back(std::move(edge)); }
+
+    /*!
+     * \brief Moves an edge of another store to the end of this one.
+     * \param other The other store.
+     * \param slot The slot of the edge in other, must not be a tombstone.
+     **/
+    void appendFrom(EdgeStore& other, size_type slot)
+    {
+        m_rows.push_back(std::move(other.m_rows[slot]));
+    }
+
+    /*!
+     * \brief Replaces an edge with a tombstone.
+     * \param slot The slot of the edge.
+     **/
+    void erase(size_type slot) noexcept { m_rows[slot].reset(); }
+
+    void reserve(size_type capacity) { m_rows.reserve(capacity); }
+
+    void shrinkToFit() { m_rows.shrink_to_fit(); }
+
+    void clear() noexcept { m_rows.clear(); }
+
+    PL_NODISCARD std::size_t usedBytes() const noexcept
+    {
+        return memory::usedBytes(m_rows);
+    }
+
+    PL_NODISCARD std::size_t slackBytes() const noexcept
+    {
+        return memory::slackBytes(m_rows);
+    }
+
+private:
+    std::pmr::vector<tl::optional<edge_type>>
+        m_rows; /*!< The edges, nullopt for tombstones */
+};
+
+/*!
+ * \brief Stores the edges as columns.
+ * \note The identifiers and the data of removed edges are only released by
+ *       compaction, as the columns keep their slots.
+ **/
+template<typename EdgeIdentifier, typename EdgeData, typename VertexIdentifier>
+class EdgeStore<ColumnStorage, EdgeIdentifier, EdgeData, VertexIdentifier> {
+public:
+    using edge_type = Edge<EdgeIdentifier, EdgeData, VertexIdentifier>;
+    using size_type = std::size_t;
+
+    /*!
+     * \brief Lightweight handle to an edge stored as columns.
+     *
+     * Provides the same read accessors as gp::Edge, so that invocables
+     * written against gp::Edge (e.g. predicates and length invocables) can
+     * be reused. Each accessor only reads its own column.
+     **/
+    class EdgeReference {
+    public:
+        using vertex_identifer = VertexIdentifier;
+        using identifier_type  = EdgeIdentifier;
+        using data_type        = EdgeData;
+
+        /*!
+         * \brief Creates an EdgeReference.
+         * \param store The store the edge belongs to.
+         * \param slot The slot of the edge.
+         **/
+        EdgeReference(const EdgeStore& store, size_type slot) noexcept
+            : m_store{&store}, m_slot{slot}
+        {
+        }
+
+        /*!
+         * \brief Read accessor for the unique identifier.
+         * \return The unique identifier.
+         **/
+        PL_NODISCARD const identifier_type& identifier() const noexcept
+        {
+            return m_store->m_identifiers[m_slot];
+        }
+
+        /*!
+         * \brief Read accessor for the source vertex.
+         * \return The source vertex.
+         **/
+        PL_NODISCARD const vertex_identifer& source() const noexcept
+        {
+            return m_store->m_sources[m_slot];
+        }
+
+        /*!
+         * \brief Read accessor for the target vertex.
+         * \return The target vertex.
+         **/
+        PL_NODISCARD const vertex_identifer& target() const noexcept
+        {
+            return m_store->m_targets[m_slot];
+        }
+
+        /*!
+         * \brief Read accessor for the edge data.
+         * \return The edge data.
+         **/
+        PL_NODISCARD const data_type& data() const noexcept
+        {
+            return m_store->m_data[m_slot];
+        }
+
+        /*!
+         * \brief Read accessor for the index of this edge.
+         * \return The index, as returned by DirectedGraph::edgeIndex.
+         **/
+        PL_NODISCARD size_type index() const noexcept { return m_slot; }
+
+        /*!
+         * \brief Compares two edges for equality.
+         * \param lhs The first operand.
+         * \param rhs The second operand.
+         * \return true if the two edges have the same unique identifier;
+         *         otherwise false.
+         **/
+        friend bool operator==(EdgeReference lhs, EdgeReference rhs) noexcept
+        {
+            return lhs.identifier() == rhs.identifier();
+        }
+
+        /*!
+         * \brief Compares two edges for inequality.
+         * \param lhs The first operand.
+         * \param rhs The second operand.
+         * \return true if the two edges don't have the same unique
+         *         identifier; otherwise false.
+         **/
+        friend bool operator!=(EdgeReference lhs, EdgeReference rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+    private:
+        const EdgeStore* m_store;
+        size_type        m_slot;
+    };
+
+    /*!
+     * \brief Pointer-like handle to an edge stored as columns, takes the
+     *        place of const edge_type* in the results of DirectedGraph.
+     **/
+    class EdgePointer {
+    public:
+        /*!
+         * \brief Creates an EdgePointer.
+         * \param store The store the edge belongs to.
+         * \param slot The slot of the edge.
+         **/
+        EdgePointer(const EdgeStore& store, size_type slot) noexcept
+            : m_reference{store, slot}
+        {
+        }
+
+        PL_NODISCARD EdgeReference operator*() const noexcept
+        {
+            return m_reference;
+        }
+
+        PL_NODISCARD const EdgeReference* operator->() const noexcept
+        {
+            return &m_reference;
+        }
+
+        friend bool operator==(EdgePointer lhs, EdgePointer rhs) noexcept
+        {
+            return lhs.m_reference.index() == rhs.m_reference.index();
+        }
+
+        friend bool operator!=(EdgePointer lhs, EdgePointer rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+        /*!
+         * \brief Orders EdgePointers by the slots of their edges, like
+         *        pointers into a vector.
+         **/
+        friend bool operator<(EdgePointer lhs, EdgePointer rhs) noexcept
+        {
+            return lhs.m_reference.index() < rhs.m_reference.index();
+        }
+
+    private:
+        EdgeReference m_reference;
+    };
+
+    /*!
+     * \brief Forward iterator over the edges that skips the tombstones.
+     **/
+    class LiveIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = EdgeReference;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = EdgePointer;
+        using reference         = EdgeReference;
+
+        LiveIterator() noexcept : m_store{nullptr}, m_slot{0} {}
+
+        /*!
+         * \brief Creates a LiveIterator.
+         * \param store The store to iterate over.
+         * \param slot The slot to start at.
+         **/
+        LiveIterator(const EdgeStore& store, size_type slot) noexcept
+            : m_store{&store}, m_slot{slot}
+        {
+            skip();
+        }
+
+        PL_NODISCARD reference operator*() const noexcept
+        {
+            return EdgeReference{*m_store, m_slot};
+        }
+
+        PL_NODISCARD pointer operator->() const noexcept
+        {
+            return EdgePointer{*m_store, m_slot};
+        }
+
+        LiveIterator& operator++() noexcept
+        {
+            ++m_slot;
+            skip();
+            return *this;
+        }
+
+        LiveIterator operator++(int) noexcept
+        {
+            LiveIterator copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(LiveIterator lhs, LiveIterator rhs) noexcept
+        {
+            return lhs.m_slot == rhs.m_slot;
+        }
+
+        friend bool operator!=(LiveIterator lhs, LiveIterator rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+    private:
+        /*!
+         * \brief Advances to the next slot that isn't a tombstone, only
+         *        reading the liveness column.
+         **/
+        void skip() noexcept
+        {
+            while ((m_slot != m_store->size()) and not m_store->isLive(m_slot)) {
+                ++m_slot;
+            }
+        }
+
+        const EdgeStore* m_store;
+        size_type        m_slot;
+    };
+
+    /*!
+     * \brief Random access iterator over the edges selected by a list of
+     *        slots, like views::SlotIterator.
+     **/
+    class SlotIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = EdgeReference;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = EdgePointer;
+        using reference         = EdgeReference;
+
+        SlotIterator() noexcept : m_store{nullptr}, m_slot{nullptr} {}
+
+        /*!
+         * \brief Creates a SlotIterator.
+         * \param store The store the edges belong to.
+         * \param slot Pointer to the current position in the slot list.
+         **/
+        SlotIterator(const EdgeStore& store, const size_type* slot) noexcept
+            : m_store{&store}, m_slot{slot}
+        {
+        }
+
+        PL_NODISCARD reference operator*() const noexcept
+        {
+            return EdgeReference{*m_store, *m_slot};
+        }
+
+        PL_NODISCARD pointer operator->() const noexcept
+        {
+            return EdgePointer{*m_store, *m_slot};
+        }
+
+        PL_NODISCARD reference operator[](difference_type offset) const
+            noexcept
+        {
+            return EdgeReference{*m_store, m_slot[offset]};
+        }
+
+        /*!
+         * \brief Returns the slot of the current edge.
+         * \return The slot.
+         **/
+        PL_NODISCARD size_type slot() const noexcept { return *m_slot; }
+
+        SlotIterator& operator++() noexcept
+        {
+            ++m_slot;
+            return *this;
+        }
+
+        SlotIterator operator++(int) noexcept
+        {
+            SlotIterator copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        SlotIterator& operator--() noexcept
+        {
+            --m_slot;
+            return *this;
+        }
+
+        SlotIterator operator--(int) noexcept
+        {
+            SlotIterator copy{*this};
+            --*this;
+            return copy;
+        }
+
+        SlotIterator& operator+=(difference_type offset) noexcept
+        {
+            m_slot += offset;
+            return *this;
+        }
+
+        SlotIterator& operator-=(difference_type offset) noexcept
+        {
+            m_slot -= offset;
+            return *this;
+        }
+
+        friend SlotIterator operator+(
+            SlotIterator    iterator,
+            difference_type offset) noexcept
+        {
+            return iterator += offset;
+        }
+
+        friend SlotIterator operator+(
+            difference_type offset,
+            SlotIterator    iterator) noexcept
+        {
+            return iterator += offset;
+        }
+
+        friend SlotIterator operator-(
+            SlotIterator    iterator,
+            difference_type offset) noexcept
+        {
+            return iterator -= offset;
+        }
+
+        friend difference_type operator-(
+            SlotIterator lhs,
+            SlotIterator rhs) noexcept
+        {
+            return lhs.m_slot - rhs.m_slot;
+        }
+
+        friend bool operator==(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return lhs.m_slot == rhs.m_slot;
+        }
+
+        friend bool operator!=(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+        friend bool operator<(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return lhs.m_slot < rhs.m_slot;
+        }
+
+        friend bool operator>(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return not(rhs < lhs);
+        }
+
+        friend bool operator>=(SlotIterator lhs, SlotIterator rhs) noexcept
+        {
+            return not(lhs < rhs);
+        }
+
+    private:
+        const EdgeStore* m_store;
+        const size_type* m_slot;
+    };
+
+    using reference     = EdgeReference;
+    using pointer       = EdgePointer;
+    using live_iterator = LiveIterator;
+    using slot_iterator = SlotIterator;
+
+    explicit EdgeStore(std::pmr::memory_resource* resource)
+        : m_live(resource)
+        , m_identifiers(resource)
+        , m_sources(resource)
+        , m_targets(resource)
+        , m_data(resource)
+    {
+    }
+
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_identifiers.get_allocator().resource();
+    }
+
+    /*!
+     * \brief Returns the amount of slots, tombstones included.
+     * \return The amount of slots.
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_live.size(); }
+
+    PL_NODISCARD bool isLive(size_type slot) const noexcept
+    {
+        return m_live[slot];
+    }
+
+    PL_NODISCARD reference operator[](size_type slot) const noexcept
+    {
+        return EdgeReference{*this, slot};
+    }
+
+    PL_NODISCARD pointer pointerAt(size_type slot) const noexcept
+    {
+        return EdgePointer{*this, slot};
+    }
+
+    PL_NODISCARD const EdgeIdentifier& identifier(size_type slot) const
+        noexcept
+    {
+        return m_identifiers[slot];
+    }
+
+    PL_NODISCARD live_iterator liveBegin() const noexcept
+    {
+        return live_iterator{*this, 0};
+    }
+
+    PL_NODISCARD live_iterator liveEnd() const noexcept
+    {
+        return live_iterator{*this, size()};
+    }
+
+    PL_NODISCARD slot_iterator slotIterator(const size_type* slot) const
+        noexcept
+    {
+        return slot_iterator{*this, slot};
+    }
+
+    void append(
+        EdgeIdentifier   identifier,
+        VertexIdentifier source,
+        VertexIdentifier target,
+        EdgeData         data)
+    {
+        m_live.push_back(true);
+        m_identifiers.push_back(std::move(identifier));
+        m_sources.push_back(std::move(source));
+        m_targets.push_back(std::move(target));
+        m_data.append(std::move(data));
+    }
+
+    void append(edge_type&& edge)
+    {
+        m_live.push_back(true);
+        m_identifiers.push_back(edge.identifier());
+        m_sources.push_back(edge.source());
+        m_targets.push_back(edge.target());
+        m_data.append(edge.data());
+    }
+
+    /*!
+     * \brief Moves an edge of another store to the end of this one.
+     * \param other The other store.
+     * \param slot The slot of the edge in other, must not be a tombstone.
+     **/
+    void appendFrom(EdgeStore& other, size_type slot)
+    {
+        m_live.push_back(true);
+        m_identifiers.push_back(std::move(other.m_identifiers[slot]));
+        m_sources.push_back(std::move(other.m_sources[slot]));
+        m_targets.push_back(std::move(other.m_targets[slot]));
+        m_data.appendFrom(other.m_data, slot);
+    }
+
+    /*!
+     * \brief Replaces an edge with a tombstone.
+     * \param slot The slot of the edge.
+     **/
+    void erase(size_type slot) noexcept { m_live[slot] = false; }
+
+    void reserve(size_type capacity)
+    {
+        m_live.reserve(capacity);
+        m_identifiers.reserve(capacity);
+        m_sources.reserve(capacity);
+        m_targets.reserve(capacity);
+        m_data.reserve(capacity);
+    }
+
+    void shrinkToFit()
+    {
+        m_live.shrink_to_fit();
+        m_identifiers.shrink_to_fit();
+        m_sources.shrink_to_fit();
+        m_targets.shrink_to_fit();
+        m_data.shrinkToFit();
+    }
+
+    void clear() noexcept
+    {
+        m_live.clear();
+        m_identifiers.clear();
+        m_sources.clear();
+        m_targets.clear();
+        m_data.clear();
+    }
+
+    PL_NODISCARD std::size_t usedBytes() const noexcept
+    {
+        return ((m_live.size() + CHAR_BIT - 1) / CHAR_BIT)
+               + memory::usedBytes(m_identifiers)
+               + memory::usedBytes(m_sources) + memory::usedBytes(m_targets)
+               + m_data.usedBytes();
+    }
+
+    PL_NODISCARD std::size_t slackBytes() const noexcept
+    {
+        return ((m_live.capacity() - m_live.size()) / CHAR_BIT)
+               + memory::slackBytes(m_identifiers)
+               + memory::slackBytes(m_sources)
+               + memory::slackBytes(m_targets) + m_data.slackBytes();
+    }
+
+private:
+    std::pmr::vector<bool> m_live; /*!< false for tombstones */
+    std::pmr::vector<EdgeIdentifier>   m_identifiers;
+    std::pmr::vector<VertexIdentifier> m_sources;
+    std::pmr::vector<VertexIdentifier> m_targets;
+    DataColumn<EdgeData>               m_data;
+};
+} // namespace detail
+} // namespace gp
+#endif // INCG_GP_EDGE_STORAGE_HPP
@@ -0,0 +1,130 @@
+#ifndef INCG_GP_FIND_EQUAL_HPP
+#define INCG_GP_FIND_EQUAL_HPP
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <vector>             // std::vector
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h> // _mm256_cmpeq_epi32, _mm_cmpeq_epi32, ...
+#endif
+
+namespace gp {
+namespace detail {
+/*!
+ * \brief Compares a block of blockSize 32 bit integers to a value.
+ * \param values Pointer to the first integer of the block.
+ * \param value The value to compare to.
+ * \return A mask with bit i set if values[i] == value.
+ * \note Uses AVX2 or SSE2 if the compiler targets them.
+ **/
+#if defined(__AVX2__)
+constexpr std::size_t blockSize{8};
+
+inline unsigned compareBlock(
+    const std::uint32_t* values,
+    std::uint32_t        value) noexcept
+{
+    const __m256i block{
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values))};
+    const __m256i equal{
+        _mm256_cmpeq_epi32(block, _mm256_set1_epi32(static_cast<int>(value)))};
+    return static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+}
+#elif defined(__SSE2__)
+constexpr std::size_t blockSize{4};
+
+inline unsigned compareBlock(
+    const std::uint32_t* values,
+    std::uint32_t        value) noexcept
+{
+    const __m128i block{
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(values))};
+    const __m128i equal{
+        _mm_cmpeq_epi32(block, _mm_set1_epi32(static_cast<int>(value)))};
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+}
+#else
+constexpr std::size_t blockSize{1};
+
+inline unsigned compareBlock(
+    const std::uint32_t* values,
+    std::uint32_t        value) noexcept
+{
+    return (*values == value) ? 1U : 0U;
+}
+#endif
+} // namespace detail
+
+/*!
+ * \brief Finds the positions of the elements equal to a value.
+ * \param values The 32 bit integers to search.
+ * \param value The value to search for.
+ * \return The positions of the elements of values that are equal to value,
+ *         in ascending order.
+ * \note Compares several elements per instruction if the compiler targets
+ *       AVX2 or SSE2, falls back to scalar comparisons otherwise.
+ **/
+PL_NODISCARD inline std::vector<std::uint32_t> findEqual(
+    const std::vector<std::uint32_t>& values,
+    std::uint32_t                     value)
+{
+    std::vector<std::uint32_t> result{};
+    const std::size_t          size{values.size()};
+    std::size_t                i{0};
+
+    for (; (i + detail::blockSize) <= size; i += detail::blockSize) {
+        const unsigned mask{detail::compareBlock(values.data() + i, value)};
+
+        // Most blocks don't contain any matches.
+        if (mask == 0U) { continue; }
+
+        for (std::size_t bit{0}; bit < detail::blockSize; ++bit) {
+            if ((mask & (1U << bit)) != 0U) {
+                result.push_back(static_cast<std::uint32_t>(i + bit));
+            }
+        }
+    }
+
+    // The remaining elements that don't fill a whole block.
+    for (; i < size; ++i) {
+        if (values[i] == value) {
+            result.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Counts the elements equal to a value.
+ * \param values The 32 bit integers to search.
+ * \param value The value to count.
+ * \return The amount of elements of values that are equal to value.
+ * \note Compares several elements per instruction if the compiler targets
+ *       AVX2 or SSE2, falls back to scalar comparisons otherwise.
+ **/
+PL_NODISCARD inline std::size_t countEqual(
+    const std::vector<std::uint32_t>& values,
+    std::uint32_t                     value) noexcept
+{
+    std::size_t       result{0};
+    const std::size_t size{values.size()};
+    std::size_t       i{0};
+
+    for (; (i + detail::blockSize) <= size; i += detail::blockSize) {
+        unsigned mask{detail::compareBlock(values.data() + i, value)};
+
+        // Clear the lowest set bit until none are left.
+        for (; mask != 0U; mask &= mask - 1U) { ++result; }
+    }
+
+    for (; i < size; ++i) {
+        if (values[i] == value) { ++result; }
+    }
+
+    return result;
+}
+} // namespace gp
+#endif // INCG_GP_FIND_EQUAL_HPP
@@ -1,6 +1,7 @@
 #ifndef INCG_GP_FLEURY_ALGORITHM_HPP
 #define INCG_GP_FLEURY_ALGORITHM_HPP
 #include "../directed_graph.hpp"         // gp::DirectedGraph
+#include "../masked_graph.hpp"           // gp::MaskedGraph
 #include "is_bridge.hpp"                 // gp::fleury::isBridge
 #include <cassert>                       // assert
 #include <ciso646>                       // not, and
@@ -39,25 +40,28 @@ template<
     typename EdgeIdentifier,
     typename EdgeData>
 PL_NODISCARD const Edge<EdgeIdentifier, EdgeData, VertexIdentifier>* pickEdge(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-        graph,
-    const std::vector<const Edge<EdgeIdentifier, EdgeData, VertexIdentifier>*>&
-        outbounds)
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>& graph,
+    const typename MaskedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>::edge_range& outbounds)
 {
     // Type aliases
     using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
+        = MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using edge_type  = typename graph_type::edge_type;
+    using edge_range = typename graph_type::edge_range;
 
     using namespace pl::literals::integer_literals;
 
     // If there's only one -> we have to pick that.
-    if (outbounds.size() == 1_zu) { return outbounds.front(); }
+    if (outbounds.size() == 1_zu) { return &outbounds.front(); }
 
     // Otherwise take the first outbound edge that isn't a bridge.
-    const typename std::vector<const edge_type*>::const_iterator it{
-        pl::algo::find_if(outbounds, [&graph](const edge_type* currentEdge) {
-            return not isBridge(graph, currentEdge->identifier());
+    const typename edge_range::iterator it{
+        pl::algo::find_if(outbounds, [&graph](const edge_type& currentEdge) {
+            return not isBridge(graph, currentEdge.identifier());
         })};
 
     assert(
@@ -65,7 +69,7 @@ PL_NODISCARD const Edge<EdgeIdentifier, EdgeData, VertexIdentifier>* pickEdge(
         and "outbounds contained more than one edge that is a bridge!");
 
     // Return the non-bridge edge found.
-    return *it;
+    return &*it;
 }
 
 /*!
@@ -75,16 +79,16 @@ PL_NODISCARD const Edge<EdgeIdentifier, EdgeData, VertexIdentifier>* pickEdge(
  * \tparam EdgeIdentifier The type of which instances are used to uniquely
  *                        identify edges in the graph.
  * \tparam EdgeData The type of the data stored on an edge in the graph.
- * \param graph In-out parameter. The graph to delete the reverse edge from.
+ * \param graph In-out parameter. The graph to hide the reverse edge in.
  * \param edgeIdentifier The identifier of the edge of which the reverse
  *                       edge shall be deleted from the graph given.
  *
  * Implementation function template for Fleury's algorithm.
- * Deletes the reverse edge of a given edge identifier.
+ * Hides the reverse edge of a given edge identifier.
  * This is used because we only have implemented directed graphs
  * in this C++ project.
- * Hence we have reverse edges for every edge and need to delete
- * them as well when having deleted the forward edge.
+ * Hence we have reverse edges for every edge and need to hide
+ * them as well when having hidden the forward edge.
  * It's like that because Fleury's algorithm can only work
  * on undirected graphs (I think).
  * This function template assumes that the reverse edge can be
@@ -98,8 +102,7 @@ template<
     typename EdgeIdentifier,
     typename EdgeData>
 void deleteReverseEdge(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                          graph,
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>& graph,
     const EdgeIdentifier& edgeIdentifier)
 {
     // Statically assert for sanity.
@@ -109,12 +112,12 @@ void deleteReverseEdge(
     // Create the reverse edge identifier
     const EdgeIdentifier reverseEdgeIdentifer{-edgeIdentifier};
 
-    // If the graph actually has that reverse edge -> remove it.
+    // If the graph actually has that reverse edge -> hide it.
     if (graph.hasEdge(reverseEdgeIdentifer)) {
-        if (not graph.removeEdge(reverseEdgeIdentifer)) {
+        if (not graph.hideEdge(reverseEdgeIdentifer)) {
             PL_THROW_WITH_SOURCE_INFO(
                 std::logic_error,
-                "Couldn't remove reverse edge even though the graph has it!");
+                "Couldn't hide reverse edge even though the graph has it!");
         }
     }
 }
@@ -132,6 +135,8 @@ void deleteReverseEdge(
  *         traversed (to be read from the front).
  * \throw std::logic_error on error.
  * \note Complexity is quadratic in the amount of edges in the graph.
+ *       The graph isn't copied, the edges traversed are hidden in a
+ *       MaskedGraph instead.
  * \warning Fleury's algorithm requires that the graph given is connected!
  *          Fleury's algorithm requires that every vertex in the graph has an
  *          even degree!
@@ -146,13 +151,15 @@ template<
     typename EdgeIdentifier,
     typename EdgeData>
 PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData> graph)
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+        graph)
 {
     // Type aliases
     using graph_type
         = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using vertex_type = typename graph_type::vertex_type;
-    using edge_type   = typename graph_type::edge_type;
+    using view_type
+        = MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using edge_type = typename graph_type::edge_type;
 
     // Sanity check
     if (not graph.hasVertices()) {
@@ -163,7 +170,7 @@ PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
     std::vector<EdgeIdentifier> result{};
 
     // Get the vertices of the graph.
-    const std::vector<vertex_type>& vertices{graph.vertices()};
+    const typename graph_type::vertex_list vertices{graph.vertices()};
 
     // The start vertex. (Chosen arbitrarily)
     const VertexIdentifier s{vertices.front().identifier()};
@@ -171,13 +178,17 @@ PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
     // The current vertex. (Starts out as s)
     VertexIdentifier v{s};
 
+    // The edges traversed are hidden in here.
+    view_type view{graph};
+
     // Get the remaining outbound edges of the current vertex.
     // If there are no more -> We're done.
-    for (std::vector<const edge_type*> outbounds{};
-         not(outbounds = graph.outboundEdges(v)).empty();) {
+    for (typename view_type::edge_range outbounds{view.outboundEdgeRange(v)};
+         not outbounds.empty();
+         outbounds = view.outboundEdgeRange(v)) {
         // Otherwise (there are still outbound edges)
         // Pick the next edge (e).
-        const edge_type* e{detail::pickEdge(graph, outbounds)};
+        const edge_type* e{detail::pickEdge(view, outbounds)};
 
         // Move along the edge picked.
         // Our current vertex is now the target vertex of the edge.
@@ -186,21 +197,17 @@ PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
         // Put the edge identifier into the result (We've just traversed it)
         result.push_back(e->identifier());
 
-        // Copy the edge identifier on out.
-        // We'll delete edges shortly invalidating the pointers.
         const EdgeIdentifier edgeIdentifier{e->identifier()};
 
-        // Delete the edge. (We can no longer touch the pointers now until the
-        // end of the iteration)
-        if (not graph.removeEdge(edgeIdentifier)) {
-            PL_THROW_WITH_SOURCE_INFO(
-                std::logic_error, "Could not remove edge!");
+        // Hide the edge, so that it won't be traversed again.
+        if (not view.hideEdge(edgeIdentifier)) {
+            PL_THROW_WITH_SOURCE_INFO(std::logic_error, "Could not hide edge!");
         }
 
         // Since this codebase technically only works with
         // directed graphs the reverse edge also has to be
-        // removed.
-        detail::deleteReverseEdge(graph, edgeIdentifier);
+        // hidden.
+        detail::deleteReverseEdge(view, edgeIdentifier);
 
         // Go back up.
     }
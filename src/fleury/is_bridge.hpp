@@ -1,6 +1,7 @@
 #ifndef INCG_GP_FLEURY_IS_BRIDGE_HPP
 #define INCG_GP_FLEURY_IS_BRIDGE_HPP
 #include "../directed_graph.hpp"       // gp::DirectedGraph
+#include "../masked_graph.hpp"         // gp::MaskedGraph
 #include "reachable_vertices_from.hpp" // gp::fleury::reachableVerticesFrom
 #include <cassert>                     // assert
 #include <ciso646>                     // and
@@ -16,11 +17,12 @@ namespace fleury {
  * \tparam EdgeIdentifier The type of which instances are used to uniquely
  *                        identify edges in the graph.
  * \tparam EdgeData The type of the data stored on an edge in the graph.
- * \param graph The graph that contains the edge given.
+ * \param graph The masked graph that contains the edge given. The edges
+ *              hidden during the call are unhidden before returning.
  * \param edge The edge for which it shall be determined whether it is a bridge.
- * \return true if the edge given is a bridge in the graph given; otherwise
- *         false.
- * \warning The edge given must be an edge of the graph given!
+ * \return true if the edge given is a bridge in the visible part of the graph
+ *         given; otherwise false.
+ * \warning The edge given must be a visible edge of the graph given!
  *
  * Determines if the edge given is a bridge.
  * A bridge is an edge within a graph that if that edge were to be removed
@@ -36,33 +38,30 @@ template<
     typename EdgeIdentifier,
     typename EdgeData>
 PL_NODISCARD bool isBridge(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                          graph,
-    const EdgeIdentifier& edge)
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>& graph,
+    const EdgeIdentifier&                                                 edge)
 {
-    using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-
-    const VertexIdentifier source{graph.source(edge).value()};
+    const VertexIdentifier source{graph.graph().source(edge).value()};
 
     // How many vertices can be reached from the source of our edge?
     const std::uint64_t count1{reachableVerticesFrom(graph, source)};
 
-    // Create a copy of the graph. We don't want to modify the actual graph.
-    graph_type graphCopy{graph};
-
-    // Delete our edge from the copy.
-    bool errC{graphCopy.removeEdge(edge)};
+    // Hide our edge. We don't want to modify the actual graph.
+    bool errC{graph.hideEdge(edge)};
     (void)errC;
-    assert(errC and "Edge couldn't be removed!");
+    assert(errC and "Edge couldn't be hidden!");
 
-    // Delete reverse as well (SPECIAL FOR C++)
-    errC = graphCopy.removeEdge(-edge);
+    // Hide reverse as well (SPECIAL FOR C++)
+    errC = graph.hideEdge(-edge);
     (void)errC;
-    assert(errC and "Edge couldn't be removed (the 2nd one)!");
+    assert(errC and "Edge couldn't be hidden (the 2nd one)!");
 
     // Check how many vertices we can reach from source without our edge.
-    const std::uint64_t count2{reachableVerticesFrom(graphCopy, source)};
+    const std::uint64_t count2{reachableVerticesFrom(graph, source)};
+
+    // Leave the mask the way we found it.
+    (void)graph.unhideEdge(edge);
+    (void)graph.unhideEdge(-edge);
 
     // If we can now reach fewer vertices
     // -> then that's because we've created a new strongly connected component.
@@ -70,6 +69,35 @@ PL_NODISCARD bool isBridge(
     // Otherwise our edge isn't a bridge.
     return count2 < count1;
 }
+
+/*!
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices in the graph.
+ * \tparam VertexData The type of the data stored on a vertex in the graph.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges in the graph.
+ * \tparam EdgeData The type of the data stored on an edge in the graph.
+ * \param graph The graph that contains the edge given.
+ * \param edge The edge for which it shall be determined whether it is a bridge.
+ * \return true if the edge given is a bridge in the graph given; otherwise
+ *         false.
+ * \warning The edge given must be an edge of the graph given!
+ * \note Prefer the MaskedGraph overload when testing multiple edges, as this
+ *       one has to allocate a mask for every call.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+PL_NODISCARD bool isBridge(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                          graph,
+    const EdgeIdentifier& edge)
+{
+    MaskedGraph view{graph};
+    return isBridge(view, edge);
+}
 } // namespace fleury
 } // namespace gp
 #endif // INCG_GP_FLEURY_IS_BRIDGE_HPP
@@ -1,65 +1,49 @@
 #ifndef INCG_GP_FLEURY_REACHABLE_VERTICES_FROM_HPP
 #define INCG_GP_FLEURY_REACHABLE_VERTICES_FROM_HPP
 #include "../directed_graph.hpp"         // gp::DirectedGraph
+#include "../masked_graph.hpp"           // gp::MaskedGraph
 #include "../vertex.hpp"                 // gp::Vertex
 #include <cinttypes>                     // UINT64_C
 #include <ciso646>                       // not
 #include <cstdint>                       // std::uint64_t
-#include <pl/algo/ranged_algorithms.hpp> // pl::algo::transform
 #include <pl/annotations.hpp>            // PL_NODISCARD
-#include <unordered_map>                 // std::unordered_map
+#include <vector>                        // std::vector
 
 namespace gp {
 namespace fleury {
 namespace detail {
 /*!
- * \tparam VertexIdentifier The type of which instances are used to uniquely
- *                          identify vertices in the graph.
- * \tparam VertexData The type of the data stored on a vertex in the graph.
- * \tparam EdgeIdentifier The type of which instances are used to uniquely
- *                        identify edges in the graph.
- * \tparam EdgeData The type of the data stored on an edge in the graph.
+ * \tparam Graph The type of the graph, either a DirectedGraph or a
+ *               MaskedGraph.
  * \param graph The graph to operate on.
- * \param vertex The vertex for which to determine the amount of reachable
- *               vertices.
+ * \param vertex The dense index of the vertex for which to determine the
+ *               amount of reachable vertices.
  * \param isVisited In-out parameter to keep track of which vertices are
- *                  already visited and which aren't.
+ *                  already visited and which aren't. Indexed by the dense
+ *                  vertex indices of the graph.
  * \return The amount of vertices reachable from vertex.
  * \note This is an implementation function. It is not to be called directly
  *       from client code.
  **/
-template<
-    typename VertexIdentifier,
-    typename VertexData,
-    typename EdgeIdentifier,
-    typename EdgeData>
+template<typename Graph>
 PL_NODISCARD std::uint64_t reachableVerticesFromImpl(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                                                graph,
-    const VertexIdentifier&                     vertex,
-    std::unordered_map<VertexIdentifier, bool>& isVisited)
+    const Graph&               graph,
+    typename Graph::index_type vertex,
+    std::vector<bool>&         isVisited)
 {
     // Type aliases
-    using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
+    using index_type = typename Graph::index_type;
+    using edge_range = typename Graph::edge_range;
 
     isVisited[vertex] = true;         // We're visiting it right now.
     std::uint64_t count{UINT64_C(1)}; // Every vertex can at least reach itself.
 
     // For all the reachables
-    const std::vector<const edge_type*> outbounds{graph.outboundEdges(vertex)};
-    const std::vector<VertexIdentifier> reachables{[&outbounds] {
-        std::vector<VertexIdentifier> result(
-            outbounds.size(), VertexIdentifier{});
-        pl::algo::transform(
-            outbounds, result.begin(), [](const edge_type* currentEdge) {
-                return currentEdge->target();
-            });
-        return result;
-    }()};
+    const edge_range outbounds{graph.outboundEdgeRangeAt(vertex)};
+
+    for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+        const index_type reachable{graph.endpointIndices(it).target};
 
-    for (const VertexIdentifier& reachable : reachables) {
         // If we haven't already visited it -> recurse (Depth First Search).
         if (not isVisited[reachable]) {
             count += reachableVerticesFromImpl(graph, reachable, isVisited);
@@ -69,6 +53,32 @@ PL_NODISCARD std::uint64_t reachableVerticesFromImpl(
     // Done.
     return count;
 }
+
+/*!
+ * \tparam Graph The type of the graph, either a DirectedGraph or a
+ *               MaskedGraph.
+ * \param graph The graph to operate on.
+ * \param vertex The vertex to start at.
+ * \return The amount of vertices reachable from vertex.
+ * \note This is an implementation function. It is not to be called directly
+ *       from client code.
+ **/
+template<typename Graph>
+PL_NODISCARD std::uint64_t reachableVerticesFromVertex(
+    const Graph&                             graph,
+    const typename Graph::vertex_identifier& vertex)
+{
+    const auto index{graph.vertexIndex(vertex)};
+
+    // A vertex can always at least reach itself.
+    if (not index.has_value()) { return UINT64_C(1); }
+
+    // By default all vertices in the graph must be considered non-visited.
+    std::vector<bool> isVisited(graph.vertexIndexBound(), false);
+
+    // Branch into the recursive algorithm.
+    return reachableVerticesFromImpl(graph, *index, isVisited);
+}
 } // namespace detail
 
 /*!
@@ -101,17 +111,34 @@ PL_NODISCARD std::uint64_t reachableVerticesFrom(
                             graph,
     const VertexIdentifier& vertex)
 {
-    // Set up isVisited map
-    std::unordered_map<VertexIdentifier, bool> isVisited{};
-
-    // By default all vertices in the graph must be considered non-visited.
-    for (const auto& v : graph.vertices()) {
-        isVisited.emplace(v.identifier(), false);
-    }
+    return detail::reachableVerticesFromVertex(graph, vertex);
+}
 
-    // Branch into the recursive algorithm.
-    return ::gp::fleury::detail::reachableVerticesFromImpl(
-        graph, vertex, isVisited);
+/*!
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices in the graph.
+ * \tparam VertexData The type of the data stored on a vertex in the graph.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges in the graph.
+ * \tparam EdgeData The type of the data stored on an edge in the graph.
+ * \param graph The masked graph to operate on.
+ * \param vertex The vertex in the graph given for which to determine
+ *               the amount of reachable vertices.
+ * \return The amount of visible vertices reachable from the vertex given
+ *         using only visible edges.
+ * \note Complexity is linear in the amount of edges in the graph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+PL_NODISCARD std::uint64_t reachableVerticesFrom(
+    const MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                            graph,
+    const VertexIdentifier& vertex)
+{
+    return detail::reachableVerticesFromVertex(graph, vertex);
 }
 } // namespace fleury
 } // namespace gp
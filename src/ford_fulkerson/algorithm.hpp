@@ -1,13 +1,25 @@
 #ifndef INCG_GP_FORD_FULKERSON_ALGORITHM_HPP
 #define INCG_GP_FORD_FULKERSON_ALGORITHM_HPP
+#include "../compact_graph.hpp"     // gp::CompactGraph
 #include "../directed_graph.hpp"    // gp::DirectedGraph
+#include "../memory_usage.hpp"      // gp::MemoryUsage, ...
 #include "breadth_first_search.hpp" // gp::ford_fulkerson::breadthFirstSearch, ...
 #include <algorithm>                // std::min
-#include <cstdint>                  // std::int32_t
-#include <utility>                  // std::move
+#include <ciso646>                  // and, not
+#include <cstddef>                  // std::size_t
+#include <cstdint>                  // std::int32_t, SIZE_MAX
+#include <memory_resource>          // std::pmr::memory_resource
+#include <pl/annotations.hpp>       // PL_NODISCARD
+#include <unordered_map> // std::unordered_map, std::pmr::unordered_map
+#include <utility>       // std::move, std::pair
+#include <vector>        // std::pmr::vector
 
 namespace gp {
 namespace ford_fulkerson {
+/*!
+ * \brief The outcome of the Ford Fulkerson algorithm.
+ * \tparam VertexIdentifier The type of the vertex identifiers.
+ **/
 template<typename VertexIdentifier>
 struct Result {
     Result(
@@ -18,10 +30,166 @@ struct Result {
     {
     }
 
-    std::int32_t                                                   maxFlow;
-    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t> flow;
+    /*!
+     * \brief Returns the flow from one vertex to another.
+     * \param u The vertex the flow leaves.
+     * \param v The vertex the flow enters.
+     * \return The flow, negative if it goes from v to u. 0 if u and v aren't
+     *         connected by an edge.
+     **/
+    PL_NODISCARD std::int32_t flowBetween(
+        const VertexIdentifier& u,
+        const VertexIdentifier& v) const
+    {
+        const auto it{flow.find(VertexPair<VertexIdentifier>{u, v})};
+
+        if (it == flow.end()) { return INT32_C(0); }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes held by this object.
+     * \return The bytes. The entries of the flow hash map count as edges.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{sizeof(Result),
+                           0,
+                           memory::nodeBytes(flow),
+                           0,
+                           memory::bucketBytes(flow),
+                           0};
+    }
+
+    std::int32_t maxFlow; /*!< The maximum flow */
+    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t>
+        flow; /*!< The flow between every pair of vertices connected by an
+                   edge, in both directions */
+};
+
+namespace detail {
+/*!
+ * \brief The edges of a flow network grouped by their pair of endpoints.
+ *
+ * Every pair of vertices connected by an edge in either direction shares one
+ * flow value. It is stored at the position of the first edge between them
+ * in either direction, the representative of the pair, and is the flow in
+ * the direction of the representative.
+ **/
+struct EdgePairs {
+    std::pmr::vector<std::size_t>
+        representative; /*!< Edge index -> the representative of its pair */
+    std::pmr::vector<std::int32_t>
+        capacity; /*!< Edge index -> the capacity of its parallel edges */
 };
 
+/*!
+ * \brief Groups the edges of a graph by their pair of endpoints.
+ * \param indexBound One past the largest dense vertex index.
+ * \param edgeBound One past the largest edge index.
+ * \param forEachOutbound Invocable taking a dense vertex index and an
+ *                        invocable, which it invokes with the index, the
+ *                        target and the capacity of every outbound edge of
+ *                        the vertex in order.
+ * \param forEachInbound Invocable taking a dense vertex index and an
+ *                       invocable, which it invokes with the index and the
+ *                       source of every inbound edge of the vertex.
+ * \param resource The memory resource to allocate the result from.
+ * \return The representatives and the capacities. Parallel edges add up
+ *         their capacities.
+ * \note Takes time and space linear in indexBound + edgeBound.
+ **/
+template<typename ForEachOutbound, typename ForEachInbound>
+EdgePairs pairEdges(
+    std::size_t                indexBound,
+    std::size_t                edgeBound,
+    ForEachOutbound            forEachOutbound,
+    ForEachInbound             forEachInbound,
+    std::pmr::memory_resource* resource)
+{
+    constexpr std::size_t none{SIZE_MAX};
+
+    EdgePairs result{
+        std::pmr::vector<std::size_t>(edgeBound, none, resource),
+        std::pmr::vector<std::int32_t>(edgeBound, INT32_C(0), resource)};
+
+    // Edge index -> the first of the edges parallel to it.
+    std::pmr::vector<std::size_t> first(edgeBound, none, resource);
+
+    // Vertex -> the first edge from the current vertex to it, none between
+    // the vertices.
+    std::pmr::vector<std::size_t> firstTo(indexBound, none, resource);
+
+    // Parallel edges add up their capacities at the first of them.
+    for (std::size_t u{0}; u < indexBound; ++u) {
+        forEachOutbound(
+            u,
+            [&result, &first, &firstTo](
+                std::size_t edge, std::size_t target, std::int32_t capacity) {
+                if (firstTo[target] == none) { firstTo[target] = edge; }
+
+                first[edge] = firstTo[target];
+                result.capacity[first[edge]] += capacity;
+            });
+        forEachOutbound(
+            u,
+            [&result, &first, &firstTo](
+                std::size_t edge, std::size_t target, std::int32_t) {
+                result.capacity[edge] = result.capacity[first[edge]];
+                firstTo[target]       = none;
+            });
+    }
+
+    // The edges leading back to u tell the first edge in the opposite
+    // direction.
+    for (std::size_t u{0}; u < indexBound; ++u) {
+        forEachOutbound(
+            u,
+            [&first, &firstTo](
+                std::size_t edge, std::size_t target, std::int32_t) {
+                firstTo[target] = first[edge];
+            });
+        forEachInbound(
+            u, [&result, &first, &firstTo](std::size_t edge, std::size_t v) {
+                const std::size_t forward{firstTo[v]};
+
+                if (forward != none) {
+                    result.representative[forward]
+                        = std::min(forward, first[edge]);
+                }
+            });
+        forEachOutbound(
+            u,
+            [&result, &first, &firstTo](
+                std::size_t edge, std::size_t target, std::int32_t) {
+                std::size_t& pair{result.representative[first[edge]]};
+
+                if (pair == none) { pair = first[edge]; }
+
+                result.representative[edge] = pair;
+                firstTo[target]             = none;
+            });
+    }
+
+    return result;
+}
+} // namespace detail
+
+/*!
+ * \brief Ford Fulkerson implementation for DirectedGraphs.
+ * \param graph The graph to operate on. The edge data shall have
+ *              a nullary capacity member function.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \param resource The memory resource to allocate the working state from.
+ * \return The maximum flow and the flow between every pair of vertices
+ *         connected by an edge.
+ * \note The capacities and the flow are kept in vectors indexed by the edge
+ *       indices, see detail::pairEdges. Every pair of vertices connected by
+ *       an edge in either direction shares one flow value and parallel edges
+ *       add up their capacities.
+ **/
 template<
     typename VertexIdentifier,
     typename VertexData,
@@ -29,66 +197,257 @@ template<
     typename EdgeData>
 Result<VertexIdentifier> algorithm(
     const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                            graph,
-    const VertexIdentifier& source,
-    const VertexIdentifier& sink)
+                               graph,
+    const VertexIdentifier&    source,
+    const VertexIdentifier&    sink,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
 {
     using graph_type
         = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
+    using index_type = typename graph_type::index_type;
+    using edge_range = typename graph_type::edge_range;
+    using iterator   = typename edge_range::iterator;
 
-    // Initialize empty flow.
-    std::int32_t maxFlow{INT32_C(0)};
-    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t> flow{};
-    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t> capacity{};
+    constexpr std::size_t none{SIZE_MAX};
+
+    // Group the edges by their endpoints, parallel edges add up their
+    // capacities.
+    detail::EdgePairs pairs{detail::pairEdges(
+        graph.vertexIndexBound(),
+        graph.edgeIndexBound(),
+        [&graph](std::size_t u, auto&& onEdge) {
+            const index_type vertex{static_cast<index_type>(u)};
+
+            if (not graph.hasVertexAt(vertex)) { return; }
+
+            const edge_range outbounds{graph.outboundEdgeRangeAt(vertex)};
 
-    for (const auto& vertex : graph.vertices()) {
-        const VertexIdentifier& v{vertex.identifier()};
+            for (iterator it{outbounds.begin()}; it != outbounds.end(); ++it) {
+                onEdge(
+                    it.slot(),
+                    graph.endpointIndices(it).target,
+                    it->data().capacity());
+            }
+        },
+        [&graph](std::size_t u, auto&& onEdge) {
+            const index_type vertex{static_cast<index_type>(u)};
 
-        for (const auto& vert : graph.vertices()) {
-            const VertexIdentifier& otherVert{vert.identifier()};
-            flow[VertexPair{v, otherVert}]     = INT32_C(0);
-            capacity[VertexPair{v, otherVert}] = INT32_C(0);
+            if (not graph.hasVertexAt(vertex)) { return; }
+
+            const edge_range inbounds{graph.inboundEdgeRangeAt(vertex)};
+
+            for (iterator it{inbounds.begin()}; it != inbounds.end(); ++it) {
+                onEdge(it.slot(), graph.endpointIndices(it).source);
+            }
+        },
+        resource)};
+    const std::pmr::vector<std::size_t>&  representative{pairs.representative};
+    const std::pmr::vector<std::int32_t>& capacity{pairs.capacity};
+    std::pmr::vector<std::int32_t> flow(capacity.size(), INT32_C(0), resource);
+
+    // Checks whether the edge at a given position points in the direction
+    // of the representative of its pair.
+    const auto isForward = [&graph, &representative](std::size_t edge) {
+        return graph.endpointIndicesAt(representative[edge]).source
+               == graph.endpointIndicesAt(edge).source;
+    };
+
+    // The flow along the edge at a given position.
+    const auto flowAlong
+        = [&representative, &flow, &isForward](std::size_t edge) {
+              const std::int32_t pairFlow{flow[representative[edge]]};
+              return isForward(edge) ? pairFlow : -pairFlow;
+          };
+
+    const auto residualCapacity = [&capacity, &flowAlong](std::size_t edge) {
+        return capacity[edge] - flowAlong(edge);
+    };
+
+    std::int32_t                   maxFlow{INT32_C(0)};
+    const tl::optional<index_type> sourceIndex{graph.vertexIndex(source)};
+    const tl::optional<index_type> sinkIndex{graph.vertexIndex(sink)};
+
+    // While there exists an augmenting path,
+    // increment the flow along this path.
+    if (sourceIndex.has_value() and sinkIndex.has_value()) {
+        for (tl::optional<std::pmr::vector<std::size_t>> pred{tl::nullopt};
+             (pred = breadthFirstSearch(
+                  graph, *sourceIndex, *sinkIndex, residualCapacity, resource))
+                 .has_value();) {
+            // Determine the amount by which we can increment the flow.
+            std::int32_t increment{INT32_MAX};
+
+            for (index_type v{*sinkIndex}; (*pred)[v] != none;
+                 v = graph.endpointIndicesAt((*pred)[v]).source) {
+                increment = std::min(increment, residualCapacity((*pred)[v]));
+            }
+
+            // Now increment the flow.
+            for (index_type v{*sinkIndex}; (*pred)[v] != none;
+                 v = graph.endpointIndicesAt((*pred)[v]).source) {
+                const std::size_t edge{(*pred)[v]};
+                flow[representative[edge]]
+                    += isForward(edge) ? increment : -increment;
+            }
+
+            maxFlow += increment;
         }
     }
 
-    // Set up capacity.
-    for (const edge_type& edge : graph.edges()) {
-        const VertexIdentifier& edgeSource{edge.source()};
-        const VertexIdentifier& edgeTarget{edge.target()};
-        capacity[VertexPair{edgeSource, edgeTarget}] = edge.data().capacity();
+    // Report the flow in both directions of every pair.
+    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t> result{};
+    result.reserve(2 * graph.edgeCount());
+
+    for (index_type u{0}; u < graph.vertexIndexBound(); ++u) {
+        if (not graph.hasVertexAt(u)) { continue; }
+
+        const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+        for (iterator it{outbounds.begin()}; it != outbounds.end(); ++it) {
+            const std::int32_t along{flowAlong(it.slot())};
+            result.emplace(VertexPair{it->source(), it->target()}, along);
+            result.emplace(VertexPair{it->target(), it->source()}, -along);
+        }
     }
 
+    // No augmenting path anymore. We are done.
+    return Result<VertexIdentifier>{maxFlow, std::move(result)};
+}
+
+/*!
+ * \brief Ford Fulkerson implementation for CompactGraphs.
+ * \param graph The graph to operate on. The edge data shall have
+ *              a nullary capacity member function.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \param resource The memory resource to allocate the working state from.
+ * \return The maximum flow and the flow between every pair of vertices
+ *         connected by an edge. Like the DirectedGraph overload, the flow is
+ *         0 if source or sink is not a vertex of graph.
+ * \note The capacities and the flow are kept in vectors indexed by the edge
+ *       indices, like in the DirectedGraph overload. The inbound edges are
+ *       grouped by target into a temporary CSR to pair up opposing edges.
+ **/
+template<typename VertexIdentifier, typename EdgeIdentifier, typename EdgeData>
+Result<VertexIdentifier> algorithm(
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph,
+    const VertexIdentifier&                                         source,
+    const VertexIdentifier&                                         sink,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    using graph_type = CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+    using index_type = typename graph_type::index_type;
+
+    constexpr std::size_t none{SIZE_MAX};
+
+    const tl::optional<index_type> sourceIndex{graph.index(source)};
+    const tl::optional<index_type> sinkIndex{graph.index(sink)};
+
+    const std::size_t              vertexCount{graph.vertexCount()};
+    const std::size_t              edgeCount{graph.edgeCount()};
+    const std::vector<index_type>& sources{graph.sources()};
+    const std::vector<index_type>& targets{graph.targets()};
+
+    // The inbound edges of the vertex with index v are at the positions
+    // [inboundOffsets[v], inboundOffsets[v + 1]) of inbound.
+    std::pmr::vector<std::size_t> inboundOffsets(vertexCount + 1, 0, resource);
+    std::pmr::vector<index_type>  inbound(edgeCount, 0, resource);
+
+    for (index_type target : targets) { ++inboundOffsets[target + 1]; }
+
+    for (std::size_t v{0}; v < vertexCount; ++v) {
+        inboundOffsets[v + 1] += inboundOffsets[v];
+    }
+
+    {
+        std::pmr::vector<std::size_t> cursor(
+            inboundOffsets.begin(), inboundOffsets.end() - 1, resource);
+
+        for (std::size_t e{0}; e < edgeCount; ++e) {
+            inbound[cursor[targets[e]]++] = static_cast<index_type>(e);
+        }
+    }
+
+    // Group the edges by their endpoints, parallel edges add up their
+    // capacities.
+    detail::EdgePairs pairs{detail::pairEdges(
+        vertexCount,
+        edgeCount,
+        [&graph](std::size_t u, auto&& onEdge) {
+            for (const typename graph_type::EdgeReference edge :
+                 graph.outboundEdges(static_cast<index_type>(u))) {
+                onEdge(
+                    edge.index(), edge.targetIndex(), edge.data().capacity());
+            }
+        },
+        [&sources, &inboundOffsets, &inbound](std::size_t v, auto&& onEdge) {
+            for (std::size_t i{inboundOffsets[v]}; i < inboundOffsets[v + 1];
+                 ++i) {
+                onEdge(inbound[i], sources[inbound[i]]);
+            }
+        },
+        resource)};
+    const std::pmr::vector<std::size_t>&  representative{pairs.representative};
+    const std::pmr::vector<std::int32_t>& capacity{pairs.capacity};
+    std::pmr::vector<std::int32_t> flow(edgeCount, INT32_C(0), resource);
+
+    // Checks whether the edge at a given position points in the direction
+    // of the representative of its pair.
+    const auto isForward = [&sources, &representative](std::size_t edge) {
+        return sources[representative[edge]] == sources[edge];
+    };
+
+    // The flow along the edge at a given position.
+    const auto flowAlong
+        = [&representative, &flow, &isForward](std::size_t edge) {
+              const std::int32_t pairFlow{flow[representative[edge]]};
+              return isForward(edge) ? pairFlow : -pairFlow;
+          };
+
+    const auto residualCapacity = [&capacity, &flowAlong](std::size_t edge) {
+        return capacity[edge] - flowAlong(edge);
+    };
+
+    std::int32_t maxFlow{INT32_C(0)};
+
     // While there exists an augmenting path,
     // increment the flow along this path.
-    for (tl::optional<std::unordered_map<
-             VertexIdentifier,
-             tl::optional<VertexIdentifier>>> pred{tl::nullopt};
-         (pred = breadthFirstSearch(graph, source, sink, capacity, flow))
-             .has_value();) {
-        // Determine the amount by which we can increment the flow.
-        std::int32_t increment{INT32_MAX};
-
-        for (VertexIdentifier u{sink}; (*pred)[u].has_value();
-             u = (*pred)[u].value()) {
-            increment = std::min(
-                increment,
-                capacity[VertexPair{(*pred)[u].value(), u}]
-                    - flow[VertexPair{(*pred)[u].value(), u}]);
-        }
+    if (sourceIndex.has_value() and sinkIndex.has_value()) {
+        for (tl::optional<std::pmr::vector<std::size_t>> pred{tl::nullopt};
+             (pred = breadthFirstSearch(
+                  graph, *sourceIndex, *sinkIndex, residualCapacity, resource))
+                 .has_value();) {
+            // Determine the amount by which we can increment the flow.
+            std::int32_t increment{INT32_MAX};
+
+            for (index_type v{*sinkIndex}; (*pred)[v] != none;
+                 v = sources[(*pred)[v]]) {
+                increment = std::min(increment, residualCapacity((*pred)[v]));
+            }
 
-        // Now increment the flow.
-        for (VertexIdentifier u{sink}; (*pred)[u].has_value();
-             u = (*pred)[u].value()) {
-            flow[VertexPair{(*pred)[u].value(), u}] += increment;
-            flow[VertexPair{u, (*pred)[u].value()}] -= increment;
+            // Now increment the flow.
+            for (index_type v{*sinkIndex}; (*pred)[v] != none;
+                 v = sources[(*pred)[v]]) {
+                const std::size_t edge{(*pred)[v]};
+                flow[representative[edge]]
+                    += isForward(edge) ? increment : -increment;
+            }
+
+            maxFlow += increment;
         }
+    }
 
-        maxFlow += increment;
+    // Report the flow in both directions of every pair.
+    std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t> result{};
+    result.reserve(2 * edgeCount);
+
+    for (const typename graph_type::EdgeReference edge : graph.edges()) {
+        const std::int32_t along{flowAlong(edge.index())};
+        result.emplace(VertexPair{edge.source(), edge.target()}, along);
+        result.emplace(VertexPair{edge.target(), edge.source()}, -along);
     }
 
-    // No augmenting path anymore. We are done.
-    return Result<VertexIdentifier>{maxFlow, std::move(flow)};
+    return Result<VertexIdentifier>{maxFlow, std::move(result)};
 }
 } // namespace ford_fulkerson
 } // namespace gp
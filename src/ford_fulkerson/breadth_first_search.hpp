@@ -1,14 +1,18 @@
 #ifndef INCG_GP_FORD_FULKERSON_BREADTH_FIRST_SEARCH_HPP
 #define INCG_GP_FORD_FULKERSON_BREADTH_FIRST_SEARCH_HPP
+#include "../compact_graph.hpp"          // gp::CompactGraph
 #include "../directed_graph.hpp"         // gp::DirectedGraph
 #include <ciso646>                       // and, not
-#include <cstdint>                       // std::int32_t
-#include <pl/algo/ranged_algorithms.hpp> // pl::algo::transform
+#include <cstddef>                       // std::size_t
+#include <cstdint>                       // std::int32_t, SIZE_MAX
+#include <deque>                         // std::pmr::deque
+#include <memory_resource>               // std::pmr::memory_resource
 #include <pl/hash.hpp>                   // pl::hash
 #include <queue>                         // std::queue
 #include <tl/optional.hpp>               // tl::optional
-#include <unordered_map>                 // std::unordered_map
-#include <utility>                       // std::move
+#include <unordered_map> // std::unordered_map, std::pmr::unordered_map
+#include <utility>       // std::move
+#include <vector>        // std::vector, std::pmr::vector
 
 namespace gp {
 namespace ford_fulkerson {
@@ -41,92 +45,164 @@ bool operator!=(
     return not(lhs == rhs);
 }
 
-template<typename VertexIdentifier>
-void enqueue(
-    std::queue<VertexIdentifier>&                q,
-    const VertexIdentifier&                      x,
-    std::unordered_map<VertexIdentifier, Color>& color)
+template<typename Index>
+using Queue = std::queue<Index, std::pmr::deque<Index>>;
+
+template<typename Index>
+void enqueue(Queue<Index>& q, Index x, std::pmr::vector<Color>& color)
 {
     q.push(x);
     color[x] = Color::Gray;
 }
 
-template<typename VertexIdentifier>
-VertexIdentifier dequeue(
-    std::queue<VertexIdentifier>&                q,
-    std::unordered_map<VertexIdentifier, Color>& color)
+template<typename Index>
+Index dequeue(Queue<Index>& q, std::pmr::vector<Color>& color)
 {
-    const VertexIdentifier x{q.front()};
+    const Index x{q.front()};
     q.pop();
     color[x] = Color::Black;
     return x;
 }
 
+/*!
+ * \brief Breadth first search over the dense vertex indices of a
+ *        DirectedGraph.
+ * \param graph The graph to search.
+ * \param start The index of the vertex to start at.
+ * \param target The index of the vertex to search for.
+ * \param residualCapacity Unary invocable returning the residual capacity
+ *                         of the edge at the edge index given.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \return The index of the edge leading to every vertex index, SIZE_MAX for
+ *         the vertices that weren't reached and the start, if 'target' was
+ *         reached using only edges with a positive residual capacity,
+ *         otherwise tl::nullopt.
+ **/
 template<
     typename VertexIdentifier,
     typename VertexData,
     typename EdgeIdentifier,
-    typename EdgeData>
-tl::optional<
-    std::unordered_map<VertexIdentifier, tl::optional<VertexIdentifier>>>
-breadthFirstSearch(
+    typename EdgeData,
+    typename ResidualCapacity>
+tl::optional<std::pmr::vector<std::size_t>> breadthFirstSearch(
     const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                            graph,
-    const VertexIdentifier& start,
-    const VertexIdentifier& target,
-    const std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t>&
-                                                                          capacity,
-    const std::unordered_map<VertexPair<VertexIdentifier>, std::int32_t>& flow)
+        graph,
+    typename DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>::index_type start,
+    typename DirectedGraph<
+        VertexIdentifier,
+        VertexData,
+        EdgeIdentifier,
+        EdgeData>::index_type  target,
+    const ResidualCapacity&    residualCapacity,
+    std::pmr::memory_resource* resource)
 {
     using graph_type
         = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
+    using index_type = typename graph_type::index_type;
+    using edge_range = typename graph_type::edge_range;
+
+    // The working state is kept in vectors indexed by the dense vertex
+    // indices of the graph.
+    const index_type indexBound{graph.vertexIndexBound()};
+
+    std::pmr::vector<Color>       color(indexBound, Color::White, resource);
+    std::pmr::vector<std::size_t> pred(indexBound, SIZE_MAX, resource);
+    Queue<index_type>             q{std::pmr::deque<index_type>{resource}};
+
+    enqueue(q, start, color);
 
-    std::unordered_map<VertexIdentifier, Color> color{};
-    std::unordered_map<VertexIdentifier, tl::optional<VertexIdentifier>> pred{};
-    std::queue<VertexIdentifier>                                         q{};
+    while (not q.empty()) {
+        const index_type u{dequeue(q, color)};
 
-    for (const auto& vertex : graph.vertices()) {
-        const VertexIdentifier& u{vertex.identifier()};
-        color[u] = Color::White;
-        pred[u]  = tl::nullopt;
+        // Search all adjacent white nodes v. If the capacity
+        // from u to v in the residual network is positive,
+        // enqueue v.
+        const edge_range outbounds{graph.outboundEdgeRangeAt(u)};
+
+        for (auto it{outbounds.begin()}; it != outbounds.end(); ++it) {
+            const index_type v{graph.endpointIndices(it).target};
+
+            if ((color[v] == Color::White)
+                and (residualCapacity(it.slot()) > 0)) {
+                enqueue(q, v, color);
+                pred[v] = it.slot();
+            }
+        }
     }
 
+    // If the color of the target node is not black now,
+    // it means that we didn't reach it.
+    if (color[target] != Color::Black) { return tl::nullopt; }
+
+    return tl::make_optional(std::move(pred));
+}
+
+/*!
+ * \brief Breadth first search over the dense vertex indices of a
+ *        CompactGraph.
+ * \param graph The graph to search.
+ * \param start The index of the vertex to start at.
+ * \param target The index of the vertex to search for.
+ * \param residualCapacity Unary invocable returning the residual capacity
+ *                         of the edge at the edge index given.
+ * \param resource The memory resource to allocate the working state and the
+ *                 result from.
+ * \return The index of the edge leading to every vertex index, SIZE_MAX for
+ *         the vertices that weren't reached and the start, if 'target' was
+ *         reached using only edges with a positive residual capacity,
+ *         otherwise tl::nullopt.
+ **/
+template<
+    typename VertexIdentifier,
+    typename EdgeIdentifier,
+    typename EdgeData,
+    typename ResidualCapacity>
+tl::optional<std::pmr::vector<std::size_t>> breadthFirstSearch(
+    const CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>& graph,
+    typename CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>::
+        index_type start,
+    typename CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>::
+        index_type             target,
+    const ResidualCapacity&    residualCapacity,
+    std::pmr::memory_resource* resource)
+{
+    using graph_type = CompactGraph<VertexIdentifier, EdgeIdentifier, EdgeData>;
+    using index_type = typename graph_type::index_type;
+
+    const std::size_t vertexCount{graph.vertexCount()};
+
+    std::pmr::vector<Color>       color(vertexCount, Color::White, resource);
+    std::pmr::vector<std::size_t> pred(vertexCount, SIZE_MAX, resource);
+    Queue<index_type>             q{std::pmr::deque<index_type>{resource}};
+
     enqueue(q, start, color);
 
     while (not q.empty()) {
-        const VertexIdentifier u{dequeue(q, color)};
+        const index_type u{dequeue(q, color)};
 
         // Search all adjacent white nodes v. If the capacity
         // from u to v in the residual network is positive,
         // enqueue v.
-        const std::vector<VertexIdentifier> targets{[&graph, &u] {
-            const std::vector<const edge_type*> outbounds{
-                graph.outboundEdges(u)};
-            std::vector<VertexIdentifier> vector(outbounds.size());
-            pl::algo::transform(
-                outbounds, vector.begin(), [](const edge_type* edge) {
-                    return edge->target();
-                });
-            return vector;
-        }()};
-
-        for (const VertexIdentifier& v : targets) {
+        for (const typename graph_type::EdgeReference edge :
+             graph.outboundEdges(u)) {
+            const index_type v{edge.targetIndex()};
+
             if ((color[v] == Color::White)
-                and ((
-                    capacity.at(VertexPair{u, v}) - flow.at(VertexPair{u, v})
-                    > 0))) {
+                and (residualCapacity(edge.index()) > 0)) {
                 enqueue(q, v, color);
-                pred[v] = u;
+                pred[v] = edge.index();
             }
         }
     }
 
-    // If the color of the target node is black now,
-    // it means that we reached it.
-    if (color[target] == Color::Black) { return tl::make_optional(pred); }
+    if (color[target] != Color::Black) { return tl::nullopt; }
 
-    return tl::nullopt;
+    return tl::make_optional(std::move(pred));
 }
 } // namespace ford_fulkerson
 } // namespace gp
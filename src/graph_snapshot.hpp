@@ -0,0 +1,76 @@
+#ifndef INCG_GP_GRAPH_SNAPSHOT_HPP
+#define INCG_GP_GRAPH_SNAPSHOT_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include <cstdint>            // std::uint64_t
+#include <memory>             // std::shared_ptr
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <utility>            // std::move
+
+namespace gp {
+/*!
+ * \brief An immutable version of a directed graph.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam VertexData The type of the data stored on a vertex.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ *
+ * Keeps the version of the graph it refers to alive, so it stays consistent
+ * for as long as the snapshot exists, no matter what is published after it.
+ * Snapshots are cheap to copy and may be used by any number of threads
+ * concurrently.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+class GraphSnapshot {
+public:
+    using this_type = GraphSnapshot;
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+
+    /*!
+     * \brief Creates a snapshot.
+     * \param graph The graph, must not be nullptr.
+     * \param version The version number of the graph.
+     **/
+    GraphSnapshot(
+        std::shared_ptr<const graph_type> graph,
+        std::uint64_t                     version)
+        : m_graph{std::move(graph)}, m_version{version}
+    {
+        PL_ASSERT(m_graph != nullptr);
+    }
+
+    /*!
+     * \brief Read accessor for the graph.
+     * \return The graph.
+     **/
+    PL_NODISCARD const graph_type& graph() const noexcept { return *m_graph; }
+
+    PL_NODISCARD const graph_type& operator*() const noexcept
+    {
+        return *m_graph;
+    }
+
+    PL_NODISCARD const graph_type* operator->() const noexcept
+    {
+        return m_graph.get();
+    }
+
+    /*!
+     * \brief Read accessor for the version number.
+     * \return The version number, incremented with every version published.
+     **/
+    PL_NODISCARD std::uint64_t version() const noexcept { return m_version; }
+
+private:
+    std::shared_ptr<const graph_type> m_graph;   /*!< The graph */
+    std::uint64_t                     m_version; /*!< The version number */
+};
+} // namespace gp
+#endif // INCG_GP_GRAPH_SNAPSHOT_HPP
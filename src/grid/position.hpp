@@ -2,8 +2,11 @@
 #define INCG_GP_GRID_POSITION_HPP
 #include "column.hpp"         // gp::grid::Column
 #include "row.hpp"            // gp::grid::Row
+#include <cstddef>            // std::size_t
+#include <functional>         // std::hash
 #include <iosfwd>             // std::ostream
 #include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/hash.hpp>        // pl::hash
 #include <total_order.hpp>    // GP_TOTAL_ORDER
 
 namespace gp {
@@ -30,4 +33,14 @@ PL_NODISCARD bool operator==(Position lhs, Position rhs) noexcept;
 GP_TOTAL_ORDER(Position)
 } // namspace grid
 } // namespace gp
+
+namespace std {
+template<>
+struct hash<::gp::grid::Position> {
+    size_t operator()(::gp::grid::Position position) const
+    {
+        return ::pl::hash(position.column().value(), position.row().value());
+    }
+};
+} // namespace std
 #endif // INCG_GP_GRID_POSITION_HPP
@@ -1,6 +1,7 @@
 #ifndef INCG_GP_HIERHOLZER_ALGORITHM_HPP
 #define INCG_GP_HIERHOLZER_ALGORITHM_HPP
 #include "../directed_graph.hpp"         // gp::DirectedGraph
+#include "../masked_graph.hpp"           // gp::MaskedGraph
 #include <pl/algo/ranged_algorithms.hpp> // pl::algo::find_if
 #include <pl/annotations.hpp>            // PL_NODISCARD
 #include <vector>                        // std::vector
@@ -23,16 +24,15 @@ int reverseEdgeOf(int edgeIdentifier);
 
 GP_GRAPH_TEMPLATE
 void removeEdge(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
-                   graph,
-    EdgeIdentifier edge)
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>& graph,
+    EdgeIdentifier                                                        edge)
 {
-    const bool hasSucceeded{graph.removeEdge(edge)};
-    assert(hasSucceeded and "Couldn't remove edge from graph");
+    const bool hasSucceeded{graph.hideEdge(edge)};
+    assert(hasSucceeded and "Couldn't hide edge in graph");
     (void)hasSucceeded;
 
-    const bool hasSucceeded2{graph.removeEdge(reverseEdgeOf(edge))};
-    assert(hasSucceeded2 and "Couldn't remove reverse edge from graph");
+    const bool hasSucceeded2{graph.hideEdge(reverseEdgeOf(edge))};
+    assert(hasSucceeded2 and "Couldn't hide reverse edge in graph");
     (void)hasSucceeded2;
 }
 
@@ -40,20 +40,20 @@ GP_GRAPH_TEMPLATE
 VertexIdentifier takeStep(
     VertexIdentifier             sourceVertex,
     std::vector<EdgeIdentifier>& eulerCircuit,
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
                                    graph,
     std::vector<VertexIdentifier>& openList)
 {
     using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+        = MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
     using edge_type = typename graph_type::edge_type;
 
-    const std::vector<const edge_type*> outboundEdges{
-        graph.outboundEdges(sourceVertex)};
+    const typename graph_type::edge_range outboundEdges{
+        graph.outboundEdgeRange(sourceVertex)};
     assert((not outboundEdges.empty()) and "Vertex has no outbound edges!");
-    const edge_type* const firstOutboundEdge{outboundEdges.front()};
-    const EdgeIdentifier   firstOutboundEdgeIdentifier{
-        firstOutboundEdge->identifier()};
+    const edge_type&     firstOutboundEdge{outboundEdges.front()};
+    const EdgeIdentifier firstOutboundEdgeIdentifier{
+        firstOutboundEdge.identifier()};
 
     eulerCircuit.push_back(firstOutboundEdgeIdentifier);
 
@@ -67,7 +67,7 @@ VertexIdentifier takeStep(
 GP_GRAPH_TEMPLATE
 std::vector<EdgeIdentifier> createCircuit(
     VertexIdentifier startVertex,
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
                                    graph,
     std::vector<VertexIdentifier>& openList)
 {
@@ -83,19 +83,13 @@ std::vector<EdgeIdentifier> createCircuit(
 
 GP_GRAPH_TEMPLATE
 VertexIdentifier chooseNextVertex(
-    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+    const MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
                                    graph,
     std::vector<VertexIdentifier>& openList)
 {
-    using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
+    const VertexIdentifier vertex{openList.front()};
 
-    const VertexIdentifier              vertex{openList.front()};
-    const std::vector<const edge_type*> outboundEdges{
-        graph.outboundEdges(vertex)};
-
-    if (outboundEdges.empty()) {
+    if (graph.outboundEdgeRange(vertex).empty()) {
         openList.erase(openList.begin());
         return chooseNextVertex(graph, openList);
     }
@@ -131,18 +125,12 @@ void insertInto(
 
 GP_GRAPH_TEMPLATE
 void createEulerTour(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+    MaskedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
                                    graph,
     std::vector<EdgeIdentifier>&   eulerCircuit,
     std::vector<VertexIdentifier>& openList)
 {
-    using graph_type
-        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
-    using edge_type = typename graph_type::edge_type;
-
-    const std::vector<edge_type>& edges{graph.edges()};
-
-    if (edges.empty()) { return; }
+    if (not graph.hasEdges()) { return; }
 
     const VertexIdentifier chosenVertex{chooseNextVertex(graph, openList)};
     const std::vector<EdgeIdentifier> subCircuit{
@@ -155,7 +143,8 @@ void createEulerTour(
 
 GP_GRAPH_TEMPLATE
 PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
-    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData> graph)
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+        graph)
 {
     static_assert(
         std::is_same_v<EdgeIdentifier, int>,
@@ -170,10 +159,13 @@ PL_NODISCARD std::vector<EdgeIdentifier> algorithm(
     const VertexIdentifier startVertex{graph.vertices().front().identifier()};
     std::vector<VertexIdentifier> openList{};
 
+    // The edges traversed are hidden instead of removed from a copy.
+    MaskedGraph view{graph};
+
     std::vector<EdgeIdentifier> eulerCircuit{
-        detail::createCircuit(startVertex, graph, openList)};
+        detail::createCircuit(startVertex, view, openList)};
 
-    detail::createEulerTour(graph, eulerCircuit, openList);
+    detail::createEulerTour(view, eulerCircuit, openList);
 
     return eulerCircuit;
 }
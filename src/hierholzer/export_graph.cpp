@@ -16,7 +16,7 @@ PL_NODISCARD bool exportGraph(
 
     constexpr std::int32_t edgeLabel{INT32_C(0)};
 
-    const std::vector<edge_type>& edges{graph.edges()};
+    const graph_type::edge_list edges{graph.edges()};
 
     graph_format::DataStructure gf{};
 
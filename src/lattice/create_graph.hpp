@@ -0,0 +1,80 @@
+#ifndef INCG_GP_LATTICE_CREATE_GRAPH_HPP
+#define INCG_GP_LATTICE_CREATE_GRAPH_HPP
+#include "../directed_graph.hpp" // gp::DirectedGraph
+#include <algorithm>             // std::shuffle
+#include <cstddef>               // std::nullptr_t, std::size_t
+#include <numeric>               // std::iota
+#include <pl/annotations.hpp>    // PL_NODISCARD
+#include <random>                // std::mt19937, std::bernoulli_distribution
+#include <vector>                // std::vector
+
+namespace gp {
+namespace lattice {
+/*!
+ * \brief The type of the lattice graphs, the edge data is the edge length.
+ **/
+using graph_type = DirectedGraph<int, std::nullptr_t, int, std::size_t>;
+
+/*!
+ * \brief The orders createGraph can insert the vertices in.
+ **/
+enum class InsertionOrder {
+    RowMajor, /*!< Row by row, so neighbours in a row get adjacent indices */
+    Shuffled  /*!< Randomly, like a graph loaded from a file */
+};
+
+/*!
+ * \brief Creates a road-like side x side lattice.
+ * \param side The amount of vertices per row and per column.
+ * \param lengths The distribution to draw the length of each street from,
+ *                for instance a std::uniform_int_distribution<std::size_t>.
+ * \param dropRate The probability of a street being left out.
+ * \param insertionOrder The order to insert the vertices in.
+ * \param seed The seed of the random number engine.
+ * \return The lattice graph.
+ *
+ * Vertex v is in row v / side and column v % side. Every street between
+ * neighbouring vertices is a pair of edges, one in each direction, of the
+ * same length. The result only depends on the arguments.
+ **/
+template<typename LengthDistribution>
+PL_NODISCARD graph_type createGraph(
+    int                       side,
+    LengthDistribution        lengths,
+    double                    dropRate       = 0.0,
+    InsertionOrder            insertionOrder = InsertionOrder::RowMajor,
+    std::mt19937::result_type seed           = 42)
+{
+    std::mt19937                engine{seed};
+    std::bernoulli_distribution isDropped{dropRate};
+    std::vector<int>            vertices(static_cast<std::size_t>(side * side));
+    graph_type                  graph{};
+    int                         edge{0};
+
+    std::iota(vertices.begin(), vertices.end(), 0);
+
+    if (insertionOrder == InsertionOrder::Shuffled) {
+        std::shuffle(vertices.begin(), vertices.end(), engine);
+    }
+
+    for (int vertex : vertices) { (void)graph.addVertex(vertex, nullptr); }
+
+    const auto addStreet = [&](int from, int to) {
+        if (isDropped(engine)) { return; }
+
+        const std::size_t length{lengths(engine)};
+        (void)graph.addEdge(edge++, from, to, length);
+        (void)graph.addEdge(edge++, to, from, length);
+    };
+
+    for (int vertex : vertices) {
+        if ((vertex % side) + 1 < side) { addStreet(vertex, vertex + 1); }
+
+        if (vertex + side < side * side) { addStreet(vertex, vertex + side); }
+    }
+
+    return graph;
+}
+} // namespace lattice
+} // namespace gp
+#endif // INCG_GP_LATTICE_CREATE_GRAPH_HPP
@@ -0,0 +1,503 @@
+#ifndef INCG_GP_MASKED_GRAPH_HPP
+#define INCG_GP_MASKED_GRAPH_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include "views.hpp"          // gp::views::Range
+#include <ciso646>            // not, and, or
+#include <cstddef>            // std::size_t, std::ptrdiff_t
+#include <iterator>           // std::forward_iterator_tag
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <tl/optional.hpp>    // tl::optional
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief Non-owning view of a DirectedGraph of which vertices and edges can
+ *        be hidden without modifying the graph.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam VertexData The type of the data stored on a vertex.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ * \tparam EdgeData The type of the data stored on an edge.
+ *
+ * The hidden vertices and edges are kept in bitmasks indexed by the dense
+ * vertex and edge indices of the graph, so algorithms that remove edges as
+ * they go can run on a MaskedGraph instead of on a copy of the graph.
+ * An edge is visible if neither the edge itself nor one of its endpoints is
+ * hidden. The traversal functions skip the edges that aren't visible.
+ * \warning The graph must outlive the MaskedGraph and must not be modified
+ *          while the MaskedGraph is in use.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+class MaskedGraph {
+public:
+    using this_type = MaskedGraph;
+    using graph_type
+        = DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>;
+    using vertex_identifier = typename graph_type::vertex_identifier;
+    using vertex_data       = typename graph_type::vertex_data;
+    using edge_identifier   = typename graph_type::edge_identifier;
+    using edge_data         = typename graph_type::edge_data;
+    using vertex_type       = typename graph_type::vertex_type;
+    using edge_type         = typename graph_type::edge_type;
+    using size_type         = typename graph_type::size_type;
+    using index_type        = typename graph_type::index_type;
+    using EndpointIndices   = typename graph_type::EndpointIndices;
+
+    /*!
+     * \brief Forward iterator over the visible edges of an edge_range of the
+     *        graph.
+     **/
+    class EdgeIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = edge_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const edge_type*;
+        using reference         = const edge_type&;
+        using base_iterator     = typename graph_type::edge_range::iterator;
+
+        EdgeIterator() noexcept : m_view{nullptr}, m_current{}, m_last{} {}
+
+        /*!
+         * \brief Creates an EdgeIterator.
+         * \param view The MaskedGraph to check the visibility with.
+         * \param current The iterator of the graph to start at.
+         * \param last The end of the edge_range of the graph.
+         **/
+        EdgeIterator(
+            const MaskedGraph& view,
+            base_iterator      current,
+            base_iterator      last) noexcept
+            : m_view{&view}, m_current{current}, m_last{last}
+        {
+            skip();
+        }
+
+        PL_NODISCARD reference operator*() const noexcept
+        {
+            return *m_current;
+        }
+
+        PL_NODISCARD pointer operator->() const noexcept { return &**this; }
+
+        /*!
+         * \brief Returns the underlying iterator of the graph.
+         * \return The underlying iterator.
+         **/
+        PL_NODISCARD base_iterator base() const noexcept { return m_current; }
+
+        EdgeIterator& operator++() noexcept
+        {
+            ++m_current;
+            skip();
+            return *this;
+        }
+
+        EdgeIterator operator++(int) noexcept
+        {
+            EdgeIterator copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(
+            const EdgeIterator& lhs,
+            const EdgeIterator& rhs) noexcept
+        {
+            return lhs.m_current == rhs.m_current;
+        }
+
+        friend bool operator!=(
+            const EdgeIterator& lhs,
+            const EdgeIterator& rhs) noexcept
+        {
+            return not(lhs == rhs);
+        }
+
+    private:
+        /*!
+         * \brief Advances to the next visible edge.
+         **/
+        void skip() noexcept
+        {
+            while ((m_current != m_last)
+                   and not m_view->isEdgeVisibleAt(m_current.slot())) {
+                ++m_current;
+            }
+        }
+
+        const MaskedGraph* m_view;
+        base_iterator      m_current;
+        base_iterator      m_last;
+    };
+
+    /*!
+     * \brief Non-allocating range over the visible edges selected by an
+     *        adjacency list.
+     * \note Invalidated by any modification of the graph. Hiding or unhiding
+     *       elements only affects the edges that haven't been reached yet.
+     **/
+    using edge_range = views::Range<EdgeIterator>;
+
+    /*!
+     * \brief Creates a MaskedGraph of which nothing is hidden.
+     * \param graph The graph to view.
+     * \note Allocates one bit per vertex index and one bit per edge index of
+     *       the graph.
+     **/
+    explicit MaskedGraph(const graph_type& graph)
+        : m_graph{&graph}
+        , m_hiddenVertices(graph.vertexIndexBound(), false)
+        , m_hiddenEdges(graph.edgeIndexBound(), false)
+        , m_vertexCount{graph.vertexCount()}
+        , m_edgeCount{graph.edgeCount()}
+    {
+    }
+
+    /*!
+     * \brief Read accessor for the graph viewed.
+     * \return The graph.
+     **/
+    PL_NODISCARD const graph_type& graph() const noexcept { return *m_graph; }
+
+    /*!
+     * \brief Returns the amount of visible vertices.
+     * \return The amount of vertices that aren't hidden.
+     **/
+    PL_NODISCARD size_type vertexCount() const noexcept
+    {
+        return m_vertexCount;
+    }
+
+    /*!
+     * \brief Returns the amount of visible edges.
+     * \return The amount of edges that aren't hidden and that don't have a
+     *         hidden endpoint.
+     **/
+    PL_NODISCARD size_type edgeCount() const noexcept { return m_edgeCount; }
+
+    /*!
+     * \brief Checks whether any vertex is visible.
+     * \return true if there is a visible vertex; otherwise false.
+     **/
+    PL_NODISCARD bool hasVertices() const noexcept
+    {
+        return m_vertexCount != 0;
+    }
+
+    /*!
+     * \brief Checks whether any edge is visible.
+     * \return true if there is a visible edge; otherwise false.
+     **/
+    PL_NODISCARD bool hasEdges() const noexcept { return m_edgeCount != 0; }
+
+    /*!
+     * \brief Checks whether a vertex is in the graph and visible.
+     * \param identifier The identifier of the vertex.
+     * \return true if the vertex is visible; otherwise false.
+     **/
+    PL_NODISCARD bool hasVertex(vertex_identifier identifier) const noexcept
+    {
+        const tl::optional<index_type> index{m_graph->vertexIndex(identifier)};
+        return index.has_value() and not m_hiddenVertices[*index];
+    }
+
+    /*!
+     * \brief Checks whether an edge is in the graph and visible.
+     * \param identifier The identifier of the edge.
+     * \return true if the edge is visible; otherwise false.
+     **/
+    PL_NODISCARD bool hasEdge(edge_identifier identifier) const noexcept
+    {
+        const tl::optional<size_type> index{m_graph->edgeIndex(identifier)};
+        return index.has_value() and isEdgeVisibleAt(*index);
+    }
+
+    /*!
+     * \brief Fetches the dense index of a vertex.
+     * \param identifier The unique identifier of the vertex.
+     * \return The index or nullopt if there is no such vertex. Hidden
+     *         vertices keep their index.
+     **/
+    PL_NODISCARD tl::optional<index_type> vertexIndex(
+        vertex_identifier identifier) const noexcept
+    {
+        return m_graph->vertexIndex(identifier);
+    }
+
+    /*!
+     * \brief Returns one past the largest vertex index.
+     * \return The bound.
+     **/
+    PL_NODISCARD index_type vertexIndexBound() const noexcept
+    {
+        return m_graph->vertexIndexBound();
+    }
+
+    /*!
+     * \brief Checks whether a vertex index refers to a visible vertex.
+     * \param index The index, must be less than vertexIndexBound().
+     * \return true if there is a visible vertex with that index; otherwise
+     *         false.
+     **/
+    PL_NODISCARD bool hasVertexAt(index_type index) const noexcept
+    {
+        return m_graph->hasVertexAt(index) and not m_hiddenVertices[index];
+    }
+
+    /*!
+     * \brief Fetches a vertex by its dense index.
+     * \param index The index, hasVertexAt(index) must be true.
+     * \return A reference to the vertex.
+     **/
+    PL_NODISCARD const vertex_type& vertexAt(index_type index) const noexcept
+    {
+        PL_ASSERT(hasVertexAt(index));
+        return m_graph->vertexAt(index);
+    }
+
+    /*!
+     * \brief Returns a lazy range over the visible inbound edges of a vertex.
+     * \param index The dense index of the vertex, must refer to a vertex of
+     *              the graph.
+     * \return The range, empty if the vertex is hidden.
+     * \note Doesn't allocate.
+     **/
+    PL_NODISCARD edge_range inboundEdgeRangeAt(index_type index) const
+        noexcept
+    {
+        return mask(m_graph->inboundEdgeRangeAt(index));
+    }
+
+    /*!
+     * \brief Returns a lazy range over the visible outbound edges of a vertex.
+     * \param index The dense index of the vertex, must refer to a vertex of
+     *              the graph.
+     * \return The range, empty if the vertex is hidden.
+     * \note Doesn't allocate.
+     **/
+    PL_NODISCARD edge_range outboundEdgeRangeAt(index_type index) const
+        noexcept
+    {
+        return mask(m_graph->outboundEdgeRangeAt(index));
+    }
+
+    /*!
+     * \brief Returns a lazy range over the visible inbound edges of a vertex.
+     * \param vertex The vertex.
+     * \return The range, empty if there is no such vertex.
+     * \note Doesn't allocate.
+     **/
+    PL_NODISCARD edge_range inboundEdgeRange(vertex_identifier vertex) const
+        noexcept
+    {
+        return mask(m_graph->inboundEdgeRange(vertex));
+    }
+
+    /*!
+     * \brief Returns a lazy range over the visible outbound edges of a vertex.
+     * \param vertex The vertex.
+     * \return The range, empty if there is no such vertex.
+     * \note Doesn't allocate.
+     **/
+    PL_NODISCARD edge_range outboundEdgeRange(vertex_identifier vertex) const
+        noexcept
+    {
+        return mask(m_graph->outboundEdgeRange(vertex));
+    }
+
+    /*!
+     * \brief Fetches the dense indices of the endpoints of an edge without
+     *        hashing its source and target.
+     * \param edge Iterator to the edge, obtained from an edge_range.
+     * \return The indices of the source and the target vertex.
+     **/
+    PL_NODISCARD EndpointIndices endpointIndices(EdgeIterator edge) const
+        noexcept
+    {
+        return m_graph->endpointIndices(edge.base());
+    }
+
+    /*!
+     * \brief Hides an edge.
+     * \param edge The identifier of the edge.
+     * \return true if the edge was hidden; false if there is no such edge or
+     *         if it already was hidden.
+     * \note Constant complexity.
+     **/
+    bool hideEdge(edge_identifier edge) noexcept
+    {
+        return setEdgeHidden(edge, true);
+    }
+
+    /*!
+     * \brief Makes a hidden edge visible again.
+     * \param edge The identifier of the edge.
+     * \return true if the edge was unhidden; false if there is no such edge
+     *         or if it wasn't hidden.
+     * \note Constant complexity. The edge stays invisible while one of its
+     *       endpoints is hidden.
+     **/
+    bool unhideEdge(edge_identifier edge) noexcept
+    {
+        return setEdgeHidden(edge, false);
+    }
+
+    /*!
+     * \brief Hides a vertex along with the edges incident to it.
+     * \param vertex The identifier of the vertex.
+     * \return true if the vertex was hidden; false if there is no such vertex
+     *         or if it already was hidden.
+     * \note Complexity is linear in the degree of the vertex, as the amount of
+     *       visible edges is kept up to date.
+     **/
+    bool hideVertex(vertex_identifier vertex) noexcept
+    {
+        return setVertexHidden(vertex, true);
+    }
+
+    /*!
+     * \brief Makes a hidden vertex visible again.
+     * \param vertex The identifier of the vertex.
+     * \return true if the vertex was unhidden; false if there is no such
+     *         vertex or if it wasn't hidden.
+     * \note Complexity is linear in the degree of the vertex.
+     **/
+    bool unhideVertex(vertex_identifier vertex) noexcept
+    {
+        return setVertexHidden(vertex, false);
+    }
+
+    /*!
+     * \brief Checks whether an edge is hidden itself.
+     * \param edge The identifier of the edge.
+     * \return true if the edge is hidden; false if it isn't or if there is no
+     *         such edge.
+     **/
+    PL_NODISCARD bool isEdgeHidden(edge_identifier edge) const noexcept
+    {
+        const tl::optional<size_type> index{m_graph->edgeIndex(edge)};
+        return index.has_value() and m_hiddenEdges[*index];
+    }
+
+    /*!
+     * \brief Checks whether a vertex is hidden.
+     * \param vertex The identifier of the vertex.
+     * \return true if the vertex is hidden; false if it isn't or if there is
+     *         no such vertex.
+     **/
+    PL_NODISCARD bool isVertexHidden(vertex_identifier vertex) const noexcept
+    {
+        const tl::optional<index_type> index{m_graph->vertexIndex(vertex)};
+        return index.has_value() and m_hiddenVertices[*index];
+    }
+
+    /*!
+     * \brief Makes all the vertices and edges visible again.
+     * \note Complexity is linear in the size of the graph.
+     **/
+    void unhideAll() noexcept
+    {
+        m_hiddenVertices.assign(m_hiddenVertices.size(), false);
+        m_hiddenEdges.assign(m_hiddenEdges.size(), false);
+        m_vertexCount = m_graph->vertexCount();
+        m_edgeCount   = m_graph->edgeCount();
+    }
+
+private:
+    /*!
+     * \brief Checks whether an edge is visible.
+     * \param index The index of the edge.
+     * \return true if neither the edge nor its endpoints are hidden.
+     **/
+    PL_NODISCARD bool isEdgeVisibleAt(size_type index) const noexcept
+    {
+        if (m_hiddenEdges[index]) { return false; }
+
+        const EndpointIndices endpoints{m_graph->endpointIndicesAt(index)};
+        return not m_hiddenVertices[endpoints.source]
+               and not m_hiddenVertices[endpoints.target];
+    }
+
+    /*!
+     * \brief Wraps an edge_range of the graph, so that it skips the edges
+     *        that aren't visible.
+     * \param range The edge_range of the graph.
+     * \return The resulting edge_range.
+     **/
+    PL_NODISCARD edge_range mask(typename graph_type::edge_range range) const
+        noexcept
+    {
+        return edge_range{EdgeIterator{*this, range.begin(), range.end()},
+                          EdgeIterator{*this, range.end(), range.end()}};
+    }
+
+    bool setEdgeHidden(edge_identifier edge, bool isHidden) noexcept
+    {
+        const tl::optional<size_type> index{m_graph->edgeIndex(edge)};
+
+        if (not index.has_value() or (m_hiddenEdges[*index] == isHidden)) {
+            return false;
+        }
+
+        m_hiddenEdges[*index] = isHidden;
+
+        const EndpointIndices endpoints{m_graph->endpointIndicesAt(*index)};
+
+        if (not m_hiddenVertices[endpoints.source]
+            and not m_hiddenVertices[endpoints.target]) {
+            if (isHidden) { --m_edgeCount; }
+            else {
+                ++m_edgeCount;
+            }
+        }
+
+        return true;
+    }
+
+    bool setVertexHidden(vertex_identifier vertex, bool isHidden) noexcept
+    {
+        const tl::optional<index_type> index{m_graph->vertexIndex(vertex)};
+
+        if (not index.has_value() or (m_hiddenVertices[*index] == isHidden)) {
+            return false;
+        }
+
+        // The edges that change their visibility are the ones that are
+        // visible while the vertex is, loops are in both lists though.
+        m_hiddenVertices[*index] = false;
+        size_type changed{outboundEdgeRangeAt(*index).size()};
+        const edge_range inbounds{inboundEdgeRangeAt(*index)};
+
+        for (EdgeIterator it{inbounds.begin()}; it != inbounds.end(); ++it) {
+            if (endpointIndices(it).source != *index) { ++changed; }
+        }
+
+        m_hiddenVertices[*index] = isHidden;
+
+        if (isHidden) {
+            --m_vertexCount;
+            m_edgeCount -= changed;
+        }
+        else {
+            ++m_vertexCount;
+            m_edgeCount += changed;
+        }
+
+        return true;
+    }
+
+    const graph_type* m_graph;
+    std::vector<bool> m_hiddenVertices;
+    std::vector<bool> m_hiddenEdges;
+    size_type         m_vertexCount;
+    size_type         m_edgeCount;
+};
+} // namespace gp
+#endif // INCG_GP_MASKED_GRAPH_HPP
@@ -0,0 +1,123 @@
+#ifndef INCG_GP_MEMORY_USAGE_HPP
+#define INCG_GP_MEMORY_USAGE_HPP
+#include <cstddef>            // std::size_t
+#include <pl/annotations.hpp> // PL_NODISCARD
+
+namespace gp {
+/*!
+ * \brief The amount of bytes held by a graph or an algorithm result, broken
+ *        down by purpose.
+ * \note Memory owned by the identifiers and the data themselves, such as the
+ *       characters of a std::string identifier, isn't accounted for.
+ * \note The sizes of hash map and tree nodes are estimated from the layout
+ *       used by the common standard library implementations.
+ **/
+struct MemoryUsage {
+    std::size_t object;   /*!< The object itself, sizeof */
+    std::size_t vertices; /*!< Per vertex storage in use */
+    std::size_t edges;    /*!< Per edge (or vertex pair) storage in use */
+    std::size_t indices;  /*!< Indices, adjacency lists and bookkeeping */
+    std::size_t buckets;  /*!< The bucket arrays of the hash maps */
+    std::size_t slack;    /*!< Capacity allocated but not in use */
+
+    /*!
+     * \brief Returns the total amount of bytes.
+     * \return The sum of all the parts.
+     **/
+    PL_NODISCARD std::size_t total() const noexcept
+    {
+        return object + vertices + edges + indices + buckets + slack;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes allocated on the heap.
+     * \return The total without the object itself.
+     **/
+    PL_NODISCARD std::size_t heap() const noexcept { return total() - object; }
+
+    /*!
+     * \brief Adds the parts of another MemoryUsage to this one.
+     * \param other The other MemoryUsage.
+     * \return A reference to this object.
+     **/
+    MemoryUsage& operator+=(const MemoryUsage& other) noexcept
+    {
+        object += other.object;
+        vertices += other.vertices;
+        edges += other.edges;
+        indices += other.indices;
+        buckets += other.buckets;
+        slack += other.slack;
+        return *this;
+    }
+};
+
+namespace memory {
+/*!
+ * \brief Returns the bytes of the elements stored in a vector.
+ * \tparam Vector The type of the vector.
+ * \param vector The vector.
+ * \return The bytes in use.
+ **/
+template<typename Vector>
+PL_NODISCARD std::size_t usedBytes(const Vector& vector) noexcept
+{
+    return vector.size() * sizeof(typename Vector::value_type);
+}
+
+/*!
+ * \brief Returns the bytes of the capacity of a vector that is not in use.
+ * \tparam Vector The type of the vector.
+ * \param vector The vector.
+ * \return The bytes allocated but not in use.
+ **/
+template<typename Vector>
+PL_NODISCARD std::size_t slackBytes(const Vector& vector) noexcept
+{
+    return (vector.capacity() - vector.size())
+           * sizeof(typename Vector::value_type);
+}
+
+/*!
+ * \brief Estimates the bytes of the nodes of a hash map.
+ * \tparam HashMap The type of the hash map.
+ * \param map The hash map.
+ * \return The estimate, every node holding a next pointer, the cached hash
+ *         and the element.
+ **/
+template<typename HashMap>
+PL_NODISCARD std::size_t nodeBytes(const HashMap& map) noexcept
+{
+    return map.size()
+           * (sizeof(void*) + sizeof(std::size_t)
+              + sizeof(typename HashMap::value_type));
+}
+
+/*!
+ * \brief Returns the bytes of the bucket array of a hash map.
+ * \tparam HashMap The type of the hash map.
+ * \param map The hash map.
+ * \return The bytes, one pointer per bucket.
+ **/
+template<typename HashMap>
+PL_NODISCARD std::size_t bucketBytes(const HashMap& map) noexcept
+{
+    return map.bucket_count() * sizeof(void*);
+}
+
+/*!
+ * \brief Estimates the bytes of the nodes of an ordered set or map.
+ * \tparam Tree The type of the set or map.
+ * \param tree The set or map.
+ * \return The estimate, every node holding three pointers, the color and
+ *         the element.
+ **/
+template<typename Tree>
+PL_NODISCARD std::size_t treeNodeBytes(const Tree& tree) noexcept
+{
+    return tree.size()
+           * ((4 * sizeof(void*)) + sizeof(typename Tree::value_type));
+}
+} // namespace memory
+} // namespace gp
+#endif // INCG_GP_MEMORY_USAGE_HPP
@@ -0,0 +1,230 @@
+#ifndef INCG_GP_MUTATION_JOURNAL_HPP
+#define INCG_GP_MUTATION_JOURNAL_HPP
+#include "memory_usage.hpp"   // gp::MemoryUsage, gp::memory::usedBytes, ...
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint64_t
+#include <memory_resource>    // std::pmr::memory_resource, ...
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <tl/optional.hpp>    // tl::optional
+#include <utility>            // std::move
+#include <vector>             // std::vector, std::pmr::vector
+
+namespace gp {
+template<typename, typename, typename, typename, typename>
+class DirectedGraph;
+
+/*!
+ * \brief The kinds of mutations recorded by a MutationJournal.
+ **/
+enum class MutationKind {
+    AddVertex,   /*!< A vertex was added */
+    AddEdge,     /*!< An edge was added */
+    RemoveEdge,  /*!< An edge was removed */
+    RemoveVertex /*!< A vertex was removed */
+};
+
+/*!
+ * \brief Records the latest mutations of a DirectedGraph.
+ * \tparam VertexIdentifier The type of which instances are used to uniquely
+ *                          identify vertices.
+ * \tparam EdgeIdentifier The type of which instances are used to uniquely
+ *                        identify edges.
+ *
+ * Every mutation increments the version number. The records of the latest
+ * mutations are kept in a ring buffer of fixed capacity, so consumers that
+ * know the version they last saw can catch up without rescanning the graph,
+ * as long as they aren't more than capacity() mutations behind.
+ **/
+template<typename VertexIdentifier, typename EdgeIdentifier>
+class MutationJournal {
+public:
+    using this_type         = MutationJournal;
+    using vertex_identifier = VertexIdentifier;
+    using edge_identifier   = EdgeIdentifier;
+    using size_type         = std::size_t;
+    using version_type      = std::uint64_t;
+
+    /*!
+     * \brief The record of a single mutation.
+     **/
+    struct Mutation {
+        MutationKind kind;    /*!< What happened */
+        version_type version; /*!< The version the mutation resulted in */
+        tl::optional<vertex_identifier>
+            vertex; /*!< The vertex, set for vertex mutations */
+        tl::optional<edge_identifier>
+            edge; /*!< The edge, set for edge mutations */
+    };
+
+    /*!
+     * \brief Creates an empty journal.
+     * \param capacity The amount of records to keep, must not be 0.
+     * \param version The version to start at.
+     * \param resource The memory resource to allocate the records from.
+     **/
+    MutationJournal(
+        size_type                   capacity,
+        version_type                version,
+        std::pmr::memory_resource* resource)
+        : m_records{resource}
+        , m_capacity{capacity}
+        , m_head{0}
+        , m_version{version}
+    {
+        PL_ASSERT(m_capacity != 0);
+        m_records.reserve(m_capacity);
+    }
+
+    /*!
+     * \brief Copies a journal into a given memory resource.
+     * \param other The journal to copy.
+     * \param resource The memory resource the copy allocates from.
+     **/
+    MutationJournal(const this_type& other, std::pmr::memory_resource* resource)
+        : m_records{other.m_records, resource}
+        , m_capacity{other.m_capacity}
+        , m_head{other.m_head}
+        , m_version{other.m_version}
+    {
+        m_records.reserve(m_capacity);
+    }
+
+    /*!
+     * \brief Moves a journal into a given memory resource.
+     * \param other The journal to move.
+     * \param resource The memory resource the result allocates from. The
+     *                 records are copied if it isn't the one of other.
+     **/
+    MutationJournal(this_type&& other, std::pmr::memory_resource* resource)
+        : m_records{std::move(other.m_records), resource}
+        , m_capacity{other.m_capacity}
+        , m_head{other.m_head}
+        , m_version{other.m_version}
+    {
+        m_records.reserve(m_capacity);
+    }
+
+    MutationJournal(const this_type&) = default;
+    MutationJournal(this_type&&)      = default;
+    this_type& operator=(const this_type&) = default;
+    this_type& operator=(this_type&&) = default;
+
+    /*!
+     * \brief Read accessor for the version number.
+     * \return The version resulting from the latest mutation.
+     **/
+    PL_NODISCARD version_type version() const noexcept { return m_version; }
+
+    /*!
+     * \brief Returns the oldest version that changesSince can catch up from.
+     * \return The version before the oldest record kept.
+     **/
+    PL_NODISCARD version_type oldestVersion() const noexcept
+    {
+        return m_version - m_records.size();
+    }
+
+    /*!
+     * \brief Returns the amount of records kept.
+     * \return The amount of records, at most capacity().
+     **/
+    PL_NODISCARD size_type size() const noexcept { return m_records.size(); }
+
+    /*!
+     * \brief Returns the maximum amount of records kept.
+     * \return The capacity.
+     **/
+    PL_NODISCARD size_type capacity() const noexcept { return m_capacity; }
+
+    /*!
+     * \brief Returns the amount of bytes held by this journal.
+     * \return The bytes, the records count as indices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{sizeof(this_type),
+                           0,
+                           0,
+                           memory::usedBytes(m_records),
+                           0,
+                           memory::slackBytes(m_records)};
+    }
+
+    /*!
+     * \brief Fetches the mutations that happened after a given version.
+     * \param version The version, must not be greater than version().
+     * \return The records in the order the mutations happened or nullopt if
+     *         some of them have been overwritten already, that is if version
+     *         is less than oldestVersion().
+     * \note Complexity is linear in the amount of records returned.
+     **/
+    PL_NODISCARD tl::optional<std::vector<Mutation>> changesSince(
+        version_type version) const
+    {
+        PL_ASSERT(version <= m_version);
+
+        if (version < oldestVersion()) { return tl::nullopt; }
+
+        const size_type count{static_cast<size_type>(m_version - version)};
+        const size_type first{m_records.size() - count};
+
+        std::vector<Mutation> result{};
+        result.reserve(count);
+
+        for (size_type i{first}; i < m_records.size(); ++i) {
+            result.push_back(m_records[(m_head + i) % m_capacity]);
+        }
+
+        return result;
+    }
+
+private:
+    template<typename, typename, typename, typename, typename>
+    friend class DirectedGraph;
+
+    /*!
+     * \brief Records a mutation of a vertex.
+     * \param kind The kind of the mutation.
+     * \param identifier The identifier of the vertex.
+     **/
+    void recordVertex(MutationKind kind, const vertex_identifier& identifier)
+    {
+        record(Mutation{kind, m_version + 1, identifier, tl::nullopt});
+    }
+
+    /*!
+     * \brief Records a mutation of an edge.
+     * \param kind The kind of the mutation.
+     * \param identifier The identifier of the edge.
+     **/
+    void recordEdge(MutationKind kind, const edge_identifier& identifier)
+    {
+        record(Mutation{kind, m_version + 1, tl::nullopt, identifier});
+    }
+
+    /*!
+     * \brief Appends a record, overwriting the oldest one if the journal is
+     *        full.
+     * \param mutation The record.
+     **/
+    void record(Mutation&& mutation)
+    {
+        if (m_records.size() < m_capacity) {
+            m_records.push_back(std::move(mutation));
+        }
+        else {
+            m_records[m_head] = std::move(mutation);
+            m_head            = (m_head + 1) % m_capacity;
+        }
+
+        ++m_version;
+    }
+
+    std::pmr::vector<Mutation> m_records; /*!< The ring buffer */
+    size_type                  m_capacity; /*!< Maximum amount of records */
+    size_type    m_head;    /*!< Position of the oldest record when full */
+    version_type m_version; /*!< The version of the latest mutation */
+};
+} // namespace gp
+#endif // INCG_GP_MUTATION_JOURNAL_HPP
@@ -0,0 +1,160 @@
+#ifndef INCG_GP_NEAREST_SOURCES_HPP
+#define INCG_GP_NEAREST_SOURCES_HPP
+#include "memory_usage.hpp"   // gp::MemoryUsage, gp::memory::nodeBytes, ...
+#include <algorithm>          // std::reverse
+#include <ciso646>            // not
+#include <memory_resource>    // std::pmr::memory_resource
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/except.hpp>      // PL_THROW_WITH_SOURCE_INFO
+#include <stdexcept>          // std::logic_error
+#include <tl/optional.hpp>    // tl::optional
+#include <unordered_map>      // std::pmr::unordered_map
+#include <utility>            // std::move
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief The result of a search from several sources: the distance from
+ *        every vertex to its nearest source, the predecessor on the path
+ *        from there and the source itself, which partitions the vertices
+ *        into the Voronoi cells of the sources.
+ * \tparam VertexIdentifier The type of the unique identifiers of the
+ *                          vertices in the directed graph.
+ * \tparam Length The length type to use.
+ * \note The hash maps allocate from the memory resource they were created
+ *       with, like those of ShortestPaths.
+ **/
+template<typename VertexIdentifier, typename Length>
+class NearestSources {
+public:
+    using this_type       = NearestSources;
+    using identifier_type = VertexIdentifier;
+    using length_type     = Length;
+    using prev_map_type = std::pmr::
+        unordered_map<identifier_type, tl::optional<identifier_type>>;
+    using dist_map_type = std::pmr::unordered_map<identifier_type, length_type>;
+    using source_map_type = std::pmr::
+        unordered_map<identifier_type, tl::optional<identifier_type>>;
+
+    /*!
+     * \brief Creates a NearestSources object.
+     * \param prev The 'previous' hash map.
+     * \param dist The 'distance' hash map.
+     * \param sources The hash map associating the vertices with their nearest
+     *                source, nullopt for those that can't be reached.
+     **/
+    NearestSources(
+        prev_map_type   prev,
+        dist_map_type   dist,
+        source_map_type sources)
+        : m_prev{std::move(prev)}
+        , m_dist{std::move(dist)}
+        , m_sources{std::move(sources)}
+    {
+    }
+
+    /*!
+     * \brief Read accessor for the memory resource.
+     * \return The memory resource the hash maps allocate from.
+     **/
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_dist.get_allocator().resource();
+    }
+
+    /*!
+     * \brief Returns the source nearest to the given vertex.
+     * \param target The vertex.
+     * \return The source owning the vertex, nullopt if no source reaches it.
+     * \throws std::logic_error if the target was not found.
+     **/
+    PL_NODISCARD tl::optional<identifier_type> sourceOf(
+        identifier_type target) const
+    {
+        const auto it{m_sources.find(target)};
+
+        if (it == m_sources.end()) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::logic_error, "sources did not contain the given target");
+        }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Returns the shortest path from the nearest source to the given
+     *        target vertex.
+     * \param target The vertex to use as the target.
+     * \return The shortest path, empty if no source reaches the target.
+     * \throws std::logic_error if the target given isn't in
+     *                          the 'previous' hash map.
+     **/
+    PL_NODISCARD std::vector<identifier_type> shortestPathTo(
+        identifier_type target) const
+    {
+        std::vector<identifier_type> s{};
+
+        if (not sourceOf(target).has_value()) { return s; }
+
+        tl::optional<identifier_type> u{std::move(target)};
+
+        while (u.has_value()) {
+            const auto it{m_prev.find(*u)};
+
+            if (it == m_prev.end()) {
+                PL_THROW_WITH_SOURCE_INFO(
+                    std::logic_error, "prev did not contain \"u\"");
+            }
+
+            s.push_back(std::move(*u));
+            u = it->second;
+        }
+
+        std::reverse(s.begin(), s.end());
+        return s;
+    }
+
+    /*!
+     * \brief Returns the distance (cost) to the given target from its
+     *        nearest source, including the offset of the source.
+     * \param target The target vertex to use.
+     * \return The distance (cost) from the nearest source to the given
+     *         target vertex.
+     * \throws std::logic_error if the target was not found.
+     **/
+    PL_NODISCARD length_type distanceTo(identifier_type target) const
+    {
+        const auto it{m_dist.find(target)};
+
+        if (it == m_dist.end()) {
+            PL_THROW_WITH_SOURCE_INFO(
+                std::logic_error, "dist did not contain the given target");
+        }
+
+        return it->second;
+    }
+
+    /*!
+     * \brief Returns the amount of bytes held by this object.
+     * \return The bytes. The entries of the hash maps count as vertices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{
+            sizeof(this_type),
+            memory::nodeBytes(m_prev) + memory::nodeBytes(m_dist)
+                + memory::nodeBytes(m_sources),
+            0,
+            0,
+            memory::bucketBytes(m_prev) + memory::bucketBytes(m_dist)
+                + memory::bucketBytes(m_sources),
+            0};
+    }
+
+private:
+    prev_map_type   m_prev;
+    dist_map_type   m_dist;
+    source_map_type m_sources;
+};
+} // namespace gp
+#endif // INCG_GP_NEAREST_SOURCES_HPP
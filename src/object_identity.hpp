@@ -0,0 +1,62 @@
+#ifndef INCG_GP_OBJECT_IDENTITY_HPP
+#define INCG_GP_OBJECT_IDENTITY_HPP
+#include <atomic>             // std::atomic
+#include <cstdint>            // std::uint64_t
+#include <pl/annotations.hpp> // PL_NODISCARD
+
+namespace gp {
+namespace detail {
+/*!
+ * \brief A number identifying an object and the contents it was given.
+ *
+ * Every construction, copy, move and assignment draws a new number, so
+ * that two objects never share one, not even when one was assigned the
+ * other. Caches keyed on the identity of an object therefore can't mistake
+ * new contents for the old ones.
+ **/
+class ObjectIdentity {
+public:
+    using value_type = std::uint64_t;
+
+    ObjectIdentity() noexcept : m_value{next()} {}
+
+    ObjectIdentity(const ObjectIdentity&) noexcept : ObjectIdentity{} {}
+
+    ObjectIdentity(ObjectIdentity&&) noexcept : ObjectIdentity{} {}
+
+    ObjectIdentity& operator=(const ObjectIdentity&) noexcept
+    {
+        renew();
+        return *this;
+    }
+
+    ObjectIdentity& operator=(ObjectIdentity&&) noexcept
+    {
+        renew();
+        return *this;
+    }
+
+    /*!
+     * \brief Draws a new number, for objects whose contents were replaced.
+     **/
+    void renew() noexcept { m_value = next(); }
+
+    /*!
+     * \brief Read accessor for the number.
+     * \return The number, unique among all the ObjectIdentity objects of
+     *         the process.
+     **/
+    PL_NODISCARD value_type value() const noexcept { return m_value; }
+
+private:
+    static value_type next() noexcept
+    {
+        static std::atomic<value_type> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    value_type m_value;
+};
+} // namespace detail
+} // namespace gp
+#endif // INCG_GP_OBJECT_IDENTITY_HPP
@@ -1,11 +1,13 @@
 #ifndef INCG_GP_SHORTEST_PATHS_HPP
 #define INCG_GP_SHORTEST_PATHS_HPP
+#include "memory_usage.hpp"   // gp::MemoryUsage, gp::memory::nodeBytes, ...
 #include <ciso646>            // or
+#include <memory_resource>    // std::pmr::memory_resource
 #include <pl/annotations.hpp> // PL_NODISCARD
 #include <pl/except.hpp>      // PL_THROW_WITH_SOURCE_INFO
 #include <stdexcept>          // std::logic_error
 #include <tl/optional.hpp>    // tl::optional
-#include <unordered_map>      // std::unordered_map
+#include <unordered_map>      // std::pmr::unordered_map
 #include <utility>            // std::move
 #include <vector>             // std::vector
 
@@ -15,6 +17,8 @@ namespace gp {
  * \tparam VertexIdentifier The type of the unique identifiers of the
  *                          vertices in the directed graph.
  * \tparam Length The length type to use.
+ * \note The hash maps allocate from the memory resource they were created
+ *       with, which lets the algorithms place their results in an arena.
  **/
 template<typename VertexIdentifier, typename Length>
 class ShortestPaths {
@@ -22,9 +26,9 @@ public:
     using this_type       = ShortestPaths;
     using identifier_type = VertexIdentifier;
     using length_type     = Length;
-    using prev_map_type
-        = std::unordered_map<identifier_type, tl::optional<identifier_type>>;
-    using dist_map_type = std::unordered_map<identifier_type, length_type>;
+    using prev_map_type = std::pmr::
+        unordered_map<identifier_type, tl::optional<identifier_type>>;
+    using dist_map_type = std::pmr::unordered_map<identifier_type, length_type>;
 
     /*!
      * \brief Creates a ShortestPaths object.
@@ -51,6 +55,15 @@ public:
         return m_source;
     }
 
+    /*!
+     * \brief Read accessor for the memory resource.
+     * \return The memory resource the hash maps allocate from.
+     **/
+    PL_NODISCARD std::pmr::memory_resource* resource() const noexcept
+    {
+        return m_dist.get_allocator().resource();
+    }
+
     /*!
      * \brief Returns the shortest path to the given target vertex.
      * \param target The vertex to use as the target.
@@ -114,6 +127,21 @@ public:
         return distance;
     }
 
+    /*!
+     * \brief Returns the amount of bytes held by this object.
+     * \return The bytes. The entries of the hash maps count as vertices.
+     **/
+    PL_NODISCARD MemoryUsage memoryUsage() const noexcept
+    {
+        return MemoryUsage{
+            sizeof(this_type),
+            memory::nodeBytes(m_prev) + memory::nodeBytes(m_dist),
+            0,
+            0,
+            memory::bucketBytes(m_prev) + memory::bucketBytes(m_dist),
+            0};
+    }
+
 private:
     identifier_type m_source;
     prev_map_type   m_prev;
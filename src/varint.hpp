@@ -0,0 +1,74 @@
+#ifndef INCG_GP_VARINT_HPP
+#define INCG_GP_VARINT_HPP
+#include <cstdint>            // std::uint8_t, std::uint64_t, std::int64_t
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief Maps a signed integer to an unsigned one, so that values of small
+ *        magnitude get small encodings.
+ * \param value The signed value.
+ * \return 0 for 0, 1 for -1, 2 for 1, 3 for -2 and so on.
+ **/
+PL_NODISCARD constexpr std::uint64_t zigZagEncode(std::int64_t value) noexcept
+{
+    return (static_cast<std::uint64_t>(value) << 1U)
+           ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+/*!
+ * \brief Inverse of zigZagEncode.
+ * \param value The encoded value.
+ * \return The signed value.
+ **/
+PL_NODISCARD constexpr std::int64_t zigZagDecode(std::uint64_t value) noexcept
+{
+    return static_cast<std::int64_t>(value >> 1U)
+           ^ -static_cast<std::int64_t>(value & 1U);
+}
+
+/*!
+ * \brief Appends the LEB128 variable length encoding of a value to a buffer.
+ * \tparam Allocator The allocator type of the buffer.
+ * \param buffer The buffer to append to.
+ * \param value The value to encode.
+ * \note Takes 1 byte for values below 128, 2 bytes for values below 16384
+ *       and so on, up to 10 bytes.
+ **/
+template<typename Allocator>
+void encodeVarint(
+    std::vector<std::uint8_t, Allocator>& buffer,
+    std::uint64_t                         value)
+{
+    while (value >= 0x80U) {
+        buffer.push_back(static_cast<std::uint8_t>(value | 0x80U));
+        value >>= 7U;
+    }
+
+    buffer.push_back(static_cast<std::uint8_t>(value));
+}
+
+/*!
+ * \brief Decodes a value encoded by encodeVarint.
+ * \param position Pointer to the first byte of the encoding, advanced past
+ *                 the last one.
+ * \return The value.
+ * \warning The encoding must be complete, the end of the buffer isn't
+ *          checked.
+ **/
+PL_NODISCARD inline std::uint64_t decodeVarint(
+    const std::uint8_t*& position) noexcept
+{
+    std::uint64_t result{*position & 0x7FU};
+    unsigned      shift{7};
+
+    while ((*position++ & 0x80U) != 0) {
+        result |= static_cast<std::uint64_t>(*position & 0x7FU) << shift;
+        shift += 7;
+    }
+
+    return result;
+}
+} // namespace gp
+#endif // INCG_GP_VARINT_HPP
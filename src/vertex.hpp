@@ -1,5 +1,6 @@
 #ifndef INCG_GP_VERTEX_HPP
 #define INCG_GP_VERTEX_HPP
+#include "data_storage.hpp"   // gp::detail::DataStorage
 #include <ciso646>            // not
 #include <pl/annotations.hpp> // PL_NODISCARD
 #include <utility>            // std::move, std::swap
@@ -10,9 +11,13 @@ namespace gp {
  * \tparam VertexIdentifier The type of which instances are used to uniquely
  *                          identify vertices.
  * \tparam VertexData The type of the data stored on a vertex.
+ * \note Tag types, like std::nullptr_t or empty classes, used as VertexData
+ *       take no space.
  **/
 template<typename VertexIdentifier, typename VertexData>
-class Vertex {
+class Vertex : private detail::DataStorage<VertexData> {
+    using data_storage = detail::DataStorage<VertexData>;
+
 public:
     using this_type       = Vertex;
     using identifier_type = VertexIdentifier;
@@ -24,7 +29,7 @@ public:
      * \param data The data to store on this vertex.
      **/
     Vertex(identifier_type identifier, data_type data)
-        : m_identifier{std::move(identifier)}, m_data{std::move(data)}
+        : data_storage{std::move(data)}, m_identifier{std::move(identifier)}
     {
     }
 
@@ -41,7 +46,10 @@ public:
      * \brief Read accessor for the data stored on this vertex.
      * \return The data stored on this vertex.
      **/
-    PL_NODISCARD const data_type& data() const noexcept { return m_data; }
+    PL_NODISCARD const data_type& data() const noexcept
+    {
+        return data_storage::get();
+    }
 
     /*!
      * \brief Compares two vertices for equality.
@@ -76,12 +84,11 @@ public:
         using std::swap;
 
         swap(m_identifier, other.m_identifier);
-        swap(m_data, other.m_data);
+        data_storage::swap(other);
     }
 
 private:
     identifier_type m_identifier;
-    data_type       m_data;
 };
 
 /*!
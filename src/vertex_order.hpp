@@ -0,0 +1,257 @@
+#ifndef INCG_GP_VERTEX_ORDER_HPP
+#define INCG_GP_VERTEX_ORDER_HPP
+#include "directed_graph.hpp" // gp::DirectedGraph
+#include <algorithm>          // std::reverse, std::stable_sort
+#include <ciso646>            // not
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t, UINT32_MAX
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/assert.hpp>      // PL_ASSERT
+#include <utility>            // std::move
+#include <vector>             // std::vector
+
+namespace gp {
+/*!
+ * \brief The vertex orders that vertexPermutation can compute.
+ **/
+enum class VertexOrder {
+    BreadthFirst,        /*!< Breadth first search order */
+    ReverseCuthillMcKee, /*!< Reverse Cuthill-McKee order */
+    DegreeDescending     /*!< The vertices with the most edges first */
+};
+
+/*!
+ * \brief A permutation of the dense vertex indices of a graph.
+ *
+ * Maps the indices the vertices had before reordering to the indices they
+ * have afterwards and back, so results that are kept in vectors indexed by
+ * the dense vertex indices can be translated.
+ **/
+struct VertexPermutation {
+    using index_type = std::uint32_t;
+
+    /*!
+     * \brief Marks the old indices that didn't refer to a vertex.
+     **/
+    static constexpr index_type npos{UINT32_MAX};
+
+    /*!
+     * \brief The old index of every vertex, indexed by its new index.
+     **/
+    std::vector<index_type> order;
+
+    /*!
+     * \brief The new index of every vertex, indexed by its old index. npos
+     *        for the indices of vertices that had been removed.
+     **/
+    std::vector<index_type> position;
+
+    /*!
+     * \brief Returns the index a vertex had before reordering.
+     * \param newIndex The index the vertex has after reordering.
+     * \return The old index.
+     **/
+    PL_NODISCARD index_type oldIndex(index_type newIndex) const noexcept
+    {
+        return order[newIndex];
+    }
+
+    /*!
+     * \brief Returns the index a vertex has after reordering.
+     * \param oldIndex The index the vertex had before reordering.
+     * \return The new index.
+     **/
+    PL_NODISCARD index_type newIndex(index_type oldIndex) const noexcept
+    {
+        PL_ASSERT(position[oldIndex] != npos);
+        return position[oldIndex];
+    }
+};
+
+namespace detail {
+/*!
+ * \brief Returns the amount of edges incident to a vertex.
+ * \param graph The graph.
+ * \param index The dense index of the vertex.
+ * \return The inbound plus the outbound degree.
+ **/
+template<typename Graph>
+PL_NODISCARD std::size_t degreeAt(
+    const Graph&               graph,
+    typename Graph::index_type index) noexcept
+{
+    return graph.inboundEdgeRangeAt(index).size()
+           + graph.outboundEdgeRangeAt(index).size();
+}
+
+/*!
+ * \brief Orders the vertices by breadth first searches ignoring the
+ *        direction of the edges.
+ * \param graph The graph.
+ * \param roots The dense indices of the vertices to start the searches from,
+ *              in order. A search is started from the first root not yet
+ *              visited until every vertex is visited.
+ * \param byDegree Whether to visit the neighbours of a vertex ordered by
+ *                 their degree, lowest first, rather than in the order of
+ *                 the edges.
+ * \return The dense indices of the vertices in the order visited.
+ **/
+template<typename Graph>
+PL_NODISCARD std::vector<std::uint32_t> breadthFirstOrder(
+    const Graph&                      graph,
+    const std::vector<std::uint32_t>& roots,
+    bool                              byDegree)
+{
+    std::vector<std::uint32_t> order{};
+    std::vector<bool>          visited(graph.vertexIndexBound(), false);
+    std::vector<std::uint32_t> neighbours{};
+    order.reserve(graph.vertexCount());
+
+    const auto visit = [&order, &visited](std::uint32_t index) {
+        if (visited[index]) { return; }
+
+        visited[index] = true;
+        order.push_back(index);
+    };
+
+    for (std::uint32_t root : roots) {
+        if (visited[root]) { continue; }
+
+        // The order itself is the queue of the search.
+        std::size_t head{order.size()};
+        visit(root);
+
+        while (head < order.size()) {
+            const std::uint32_t current{order[head++]};
+            neighbours.clear();
+
+            for (auto it{graph.outboundEdgeRangeAt(current).begin()},
+                 end{graph.outboundEdgeRangeAt(current).end()};
+                 it != end;
+                 ++it) {
+                neighbours.push_back(graph.endpointIndices(it).target);
+            }
+
+            for (auto it{graph.inboundEdgeRangeAt(current).begin()},
+                 end{graph.inboundEdgeRangeAt(current).end()};
+                 it != end;
+                 ++it) {
+                neighbours.push_back(graph.endpointIndices(it).source);
+            }
+
+            if (byDegree) {
+                std::stable_sort(
+                    neighbours.begin(),
+                    neighbours.end(),
+                    [&graph](std::uint32_t lhs, std::uint32_t rhs) {
+                        return degreeAt(graph, lhs) < degreeAt(graph, rhs);
+                    });
+            }
+
+            for (std::uint32_t neighbour : neighbours) { visit(neighbour); }
+        }
+    }
+
+    return order;
+}
+} // namespace detail
+
+/*!
+ * \brief Computes an order of the vertices of a graph that improves the
+ *        locality of traversals.
+ * \param graph The graph.
+ * \param vertexOrder The order to compute.
+ * \return The permutation from the current dense vertex indices of graph to
+ *         the ones in the order requested.
+ * \note BreadthFirst and ReverseCuthillMcKee ignore the direction of the
+ *       edges, so vertices that are close in the graph end up close in
+ *       memory. BreadthFirst starts a search from the first vertex not yet
+ *       visited, in the current order. ReverseCuthillMcKee starts from the
+ *       vertex of the lowest degree not yet visited, visits the neighbours
+ *       by increasing degree and reverses the result. DegreeDescending puts
+ *       the vertices with the most edges, which are touched most often,
+ *       first and otherwise keeps the current order.
+ * \note Complexity is linear in the amount of vertices and edges, plus
+ *       sorting the vertices or the neighbours by degree.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+PL_NODISCARD VertexPermutation vertexPermutation(
+    const DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                graph,
+    VertexOrder vertexOrder)
+{
+    using index_type = VertexPermutation::index_type;
+
+    std::vector<index_type> vertices{};
+    vertices.reserve(graph.vertexCount());
+
+    for (index_type index{0}; index < graph.vertexIndexBound(); ++index) {
+        if (graph.hasVertexAt(index)) { vertices.push_back(index); }
+    }
+
+    const auto byDegreeAscending = [&graph](index_type lhs, index_type rhs) {
+        return detail::degreeAt(graph, lhs) < detail::degreeAt(graph, rhs);
+    };
+
+    VertexPermutation result{};
+
+    switch (vertexOrder) {
+    case VertexOrder::BreadthFirst:
+        result.order = detail::breadthFirstOrder(graph, vertices, false);
+        break;
+    case VertexOrder::ReverseCuthillMcKee:
+        std::stable_sort(vertices.begin(), vertices.end(), byDegreeAscending);
+        result.order = detail::breadthFirstOrder(graph, vertices, true);
+        std::reverse(result.order.begin(), result.order.end());
+        break;
+    case VertexOrder::DegreeDescending:
+        std::stable_sort(
+            vertices.begin(),
+            vertices.end(),
+            [&byDegreeAscending](index_type lhs, index_type rhs) {
+                return byDegreeAscending(rhs, lhs);
+            });
+        result.order = std::move(vertices);
+        break;
+    }
+
+    result.position.assign(graph.vertexIndexBound(), VertexPermutation::npos);
+
+    for (index_type i{0}; i < result.order.size(); ++i) {
+        result.position[result.order[i]] = i;
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Permutes the storage of the vertices and edges of a graph into an
+ *        order that improves the locality of traversals.
+ * \param graph The graph to reorder.
+ * \param vertexOrder The order to use, see vertexPermutation.
+ * \return The permutation applied, to map results kept by dense vertex index
+ *         back.
+ * \note The edges are stored grouped by their source vertex in the new order.
+ *       Removes the tombstones.
+ * \warning Invalidates all references, pointers and ranges into graph.
+ **/
+template<
+    typename VertexIdentifier,
+    typename VertexData,
+    typename EdgeIdentifier,
+    typename EdgeData>
+VertexPermutation reorder(
+    DirectedGraph<VertexIdentifier, VertexData, EdgeIdentifier, EdgeData>&
+                graph,
+    VertexOrder vertexOrder)
+{
+    VertexPermutation permutation{vertexPermutation(graph, vertexOrder)};
+    graph.reorderVertices(permutation.order);
+    return permutation;
+}
+} // namespace gp
+#endif // INCG_GP_VERTEX_ORDER_HPP
@@ -0,0 +1,639 @@
+/*!
+ * \file views.hpp
+ * \brief Exports lazy, non-allocating views used to iterate over the
+ *        elements of a graph.
+ **/
+#ifndef INCG_GP_VIEWS_HPP
+#define INCG_GP_VIEWS_HPP
+#include <ciso646>            // not, and
+#include <cstddef>            // std::size_t, std::ptrdiff_t
+#include <iterator>           // std::distance, std::forward_iterator_tag, ...
+#include <pl/annotations.hpp> // PL_NODISCARD
+#include <pl/invoke.hpp>      // pl::invoke
+#include <tl/optional.hpp>    // tl::optional
+#include <type_traits>        // std::decay_t
+#include <utility>            // std::move
+
+namespace gp {
+namespace views {
+namespace detail {
+/*!
+ * \brief Returns the element given.
+ * \param element The element.
+ * \return element
+ **/
+template<typename Element>
+PL_NODISCARD constexpr const Element& unwrap(const Element& element) noexcept
+{
+    return element;
+}
+
+/*!
+ * \brief Returns the element stored in an optional.
+ * \param element The optional, must contain a value.
+ * \return The value stored in the optional.
+ **/
+template<typename Element>
+PL_NODISCARD constexpr const Element& unwrap(
+    const tl::optional<Element>& element) noexcept
+{
+    return *element;
+}
+} // namespace detail
+
+/*!
+ * \brief A pair of iterators that can be used with range based for loops.
+ * \tparam Iterator The type of the iterators.
+ * \note Does not own the elements iterated over. The object that the
+ *       elements belong to must outlive the Range and must not be modified
+ *       while the Range is in use.
+ **/
+template<typename Iterator>
+class Range {
+public:
+    using iterator  = Iterator;
+    using size_type = std::size_t;
+
+    /*!
+     * \brief Creates a Range.
+     * \param first Iterator to the first element.
+     * \param last Iterator one past the last element.
+     **/
+    Range(Iterator first, Iterator last)
+        : m_first{first}, m_last{last}, m_size{tl::nullopt}
+    {
+    }
+
+    /*!
+     * \brief Creates a Range of which the size is already known.
+     * \param first Iterator to the first element.
+     * \param last Iterator one past the last element.
+     * \param size The amount of elements between first and last.
+     **/
+    Range(Iterator first, Iterator last, size_type size)
+        : m_first{first}, m_last{last}, m_size{size}
+    {
+    }
+
+    PL_NODISCARD Iterator begin() const { return m_first; }
+
+    PL_NODISCARD Iterator end() const { return m_last; }
+
+    PL_NODISCARD bool empty() const { return m_first == m_last; }
+
+    /*!
+     * \brief Returns the amount of elements in the range.
+     * \return The amount of elements.
+     * \note Constant complexity for random access iterators or if the size
+     *       was given on construction, linear otherwise.
+     **/
+    PL_NODISCARD size_type size() const
+    {
+        if (m_size.has_value()) { return *m_size; }
+
+        return static_cast<size_type>(std::distance(m_first, m_last));
+    }
+
+    /*!
+     * \brief Returns the first element.
+     * \return The first element.
+     * \warning The Range must not be empty.
+     **/
+    PL_NODISCARD decltype(auto) front() const { return *m_first; }
+
+private:
+    Iterator                m_first;
+    Iterator                m_last;
+    tl::optional<size_type> m_size;
+};
+
+/*!
+ * \brief Random access iterator over the elements of a vector that are
+ *        selected by a list of positions (slots) into that vector.
+ * \tparam Element The type of the elements.
+ * \tparam Storage The type stored in the vector, either Element or
+ *                 tl::optional<Element>. The optionals referred to by
+ *                 the slots must contain a value.
+ **/
+template<typename Element, typename Storage = Element>
+class SlotIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = Element;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Element*;
+    using reference         = const Element&;
+
+    SlotIterator() noexcept : m_elements{nullptr}, m_slot{nullptr} {}
+
+    /*!
+     * \brief Creates a SlotIterator.
+     * \param elements Pointer to the first element of the vector.
+     * \param slot Pointer to the current position in the slot list.
+     **/
+    SlotIterator(const Storage* elements, const std::size_t* slot) noexcept
+        : m_elements{elements}, m_slot{slot}
+    {
+    }
+
+    PL_NODISCARD reference operator*() const noexcept
+    {
+        return detail::unwrap(m_elements[*m_slot]);
+    }
+
+    PL_NODISCARD pointer operator->() const noexcept { return &**this; }
+
+    PL_NODISCARD reference operator[](difference_type offset) const noexcept
+    {
+        return detail::unwrap(m_elements[m_slot[offset]]);
+    }
+
+    /*!
+     * \brief Returns the position of the current element in its vector.
+     * \return The position.
+     **/
+    PL_NODISCARD std::size_t slot() const noexcept { return *m_slot; }
+
+    SlotIterator& operator++() noexcept
+    {
+        ++m_slot;
+        return *this;
+    }
+
+    SlotIterator operator++(int) noexcept
+    {
+        SlotIterator copy{*this};
+        ++*this;
+        return copy;
+    }
+
+    SlotIterator& operator--() noexcept
+    {
+        --m_slot;
+        return *this;
+    }
+
+    SlotIterator operator--(int) noexcept
+    {
+        SlotIterator copy{*this};
+        --*this;
+        return copy;
+    }
+
+    SlotIterator& operator+=(difference_type offset) noexcept
+    {
+        m_slot += offset;
+        return *this;
+    }
+
+    SlotIterator& operator-=(difference_type offset) noexcept
+    {
+        m_slot -= offset;
+        return *this;
+    }
+
+    friend SlotIterator operator+(
+        SlotIterator    iterator,
+        difference_type offset) noexcept
+    {
+        return iterator += offset;
+    }
+
+    friend SlotIterator operator+(
+        difference_type offset,
+        SlotIterator    iterator) noexcept
+    {
+        return iterator += offset;
+    }
+
+    friend SlotIterator operator-(
+        SlotIterator    iterator,
+        difference_type offset) noexcept
+    {
+        return iterator -= offset;
+    }
+
+    friend difference_type operator-(
+        SlotIterator lhs,
+        SlotIterator rhs) noexcept
+    {
+        return lhs.m_slot - rhs.m_slot;
+    }
+
+    friend bool operator==(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return lhs.m_slot == rhs.m_slot;
+    }
+
+    friend bool operator!=(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return not(lhs == rhs);
+    }
+
+    friend bool operator<(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return lhs.m_slot < rhs.m_slot;
+    }
+
+    friend bool operator>(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return not(rhs < lhs);
+    }
+
+    friend bool operator>=(SlotIterator lhs, SlotIterator rhs) noexcept
+    {
+        return not(lhs < rhs);
+    }
+
+private:
+    const Storage*     m_elements;
+    const std::size_t* m_slot;
+};
+
+/*!
+ * \brief Forward iterator over the elements of a vector of optionals that
+ *        skips the empty optionals.
+ * \tparam Element The type of the elements stored in the optionals.
+ **/
+template<typename Element>
+class LiveIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Element;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Element*;
+    using reference         = const Element&;
+
+    LiveIterator() noexcept : m_current{nullptr}, m_last{nullptr} {}
+
+    /*!
+     * \brief Creates a LiveIterator.
+     * \param current The optional to start at.
+     * \param last Pointer one past the last optional.
+     **/
+    LiveIterator(
+        const tl::optional<Element>* current,
+        const tl::optional<Element>* last) noexcept
+        : m_current{current}, m_last{last}
+    {
+        skip();
+    }
+
+    PL_NODISCARD reference operator*() const noexcept { return **m_current; }
+
+    PL_NODISCARD pointer operator->() const noexcept { return &**m_current; }
+
+    LiveIterator& operator++() noexcept
+    {
+        ++m_current;
+        skip();
+        return *this;
+    }
+
+    LiveIterator operator++(int) noexcept
+    {
+        LiveIterator copy{*this};
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(LiveIterator lhs, LiveIterator rhs) noexcept
+    {
+        return lhs.m_current == rhs.m_current;
+    }
+
+    friend bool operator!=(LiveIterator lhs, LiveIterator rhs) noexcept
+    {
+        return not(lhs == rhs);
+    }
+
+private:
+    /*!
+     * \brief Advances to the next optional that contains a value.
+     **/
+    void skip() noexcept
+    {
+        while ((m_current != m_last) and not m_current->has_value()) {
+            ++m_current;
+        }
+    }
+
+    const tl::optional<Element>* m_current;
+    const tl::optional<Element>* m_last;
+};
+
+/*!
+ * \brief Forward iterator that skips the elements of an underlying iterator
+ *        that don't satisfy a unary predicate.
+ * \tparam Iterator The type of the underlying iterator.
+ * \tparam UnaryPredicate The type of the unary predicate.
+ **/
+template<typename Iterator, typename UnaryPredicate>
+class FilterIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = typename std::iterator_traits<Iterator>::pointer;
+    using reference       = typename std::iterator_traits<Iterator>::reference;
+
+    /*!
+     * \brief Creates a FilterIterator.
+     * \param current The underlying iterator to start at.
+     * \param last The end of the underlying range.
+     * \param unaryPredicate The predicate that elements must satisfy.
+     **/
+    FilterIterator(
+        Iterator       current,
+        Iterator       last,
+        UnaryPredicate unaryPredicate)
+        : m_current{current}
+        , m_last{last}
+        , m_unaryPredicate{std::move(unaryPredicate)}
+    {
+        skip();
+    }
+
+    FilterIterator(const FilterIterator&) = default;
+
+    // Lambdas aren't copy assignable, so the predicate is reconstructed.
+    FilterIterator& operator=(const FilterIterator& other)
+    {
+        m_current = other.m_current;
+        m_last    = other.m_last;
+        m_unaryPredicate.emplace(*other.m_unaryPredicate);
+        return *this;
+    }
+
+    PL_NODISCARD reference operator*() const { return *m_current; }
+
+    PL_NODISCARD pointer operator->() const { return &*m_current; }
+
+    FilterIterator& operator++()
+    {
+        ++m_current;
+        skip();
+        return *this;
+    }
+
+    FilterIterator operator++(int)
+    {
+        FilterIterator copy{*this};
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(
+        const FilterIterator& lhs,
+        const FilterIterator& rhs)
+    {
+        return lhs.m_current == rhs.m_current;
+    }
+
+    friend bool operator!=(
+        const FilterIterator& lhs,
+        const FilterIterator& rhs)
+    {
+        return not(lhs == rhs);
+    }
+
+private:
+    /*!
+     * \brief Advances the underlying iterator to the next element that
+     *        satisfies the predicate.
+     **/
+    void skip()
+    {
+        while ((m_current != m_last)
+               and not pl::invoke(*m_unaryPredicate, *m_current)) {
+            ++m_current;
+        }
+    }
+
+    Iterator                     m_current;
+    Iterator                     m_last;
+    tl::optional<UnaryPredicate> m_unaryPredicate;
+};
+
+/*!
+ * \brief Forward iterator that yields the result of invoking a unary
+ *        invocable with the elements of an underlying iterator.
+ * \tparam Iterator The type of the underlying iterator.
+ * \tparam UnaryInvocable The type of the unary invocable.
+ * \note The invocable should return a reference, as operator-> is not
+ *       provided.
+ **/
+template<typename Iterator, typename UnaryInvocable>
+class TransformIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using reference         = decltype(pl::invoke(
+        std::declval<const UnaryInvocable&>(),
+        *std::declval<Iterator>()));
+    using value_type        = std::decay_t<reference>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+
+    /*!
+     * \brief Creates a TransformIterator.
+     * \param current The underlying iterator.
+     * \param unaryInvocable The unary invocable to transform with.
+     **/
+    TransformIterator(Iterator current, UnaryInvocable unaryInvocable)
+        : m_current{current}, m_unaryInvocable{std::move(unaryInvocable)}
+    {
+    }
+
+    TransformIterator(const TransformIterator&) = default;
+
+    // Lambdas aren't copy assignable, so the invocable is reconstructed.
+    TransformIterator& operator=(const TransformIterator& other)
+    {
+        m_current = other.m_current;
+        m_unaryInvocable.emplace(*other.m_unaryInvocable);
+        return *this;
+    }
+
+    PL_NODISCARD reference operator*() const
+    {
+        return pl::invoke(*m_unaryInvocable, *m_current);
+    }
+
+    TransformIterator& operator++()
+    {
+        ++m_current;
+        return *this;
+    }
+
+    TransformIterator operator++(int)
+    {
+        TransformIterator copy{*this};
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(
+        const TransformIterator& lhs,
+        const TransformIterator& rhs)
+    {
+        return lhs.m_current == rhs.m_current;
+    }
+
+    friend bool operator!=(
+        const TransformIterator& lhs,
+        const TransformIterator& rhs)
+    {
+        return not(lhs == rhs);
+    }
+
+private:
+    Iterator                     m_current;
+    tl::optional<UnaryInvocable> m_unaryInvocable;
+};
+
+/*!
+ * \brief Forward iterator that first traverses one range and then another.
+ * \tparam FirstIterator The type of the iterators of the first range.
+ * \tparam SecondIterator The type of the iterators of the second range.
+ * \note Both iterator types must have the same reference type.
+ **/
+template<typename FirstIterator, typename SecondIterator>
+class ConcatIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::iterator_traits<FirstIterator>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::iterator_traits<FirstIterator>::pointer;
+    using reference = typename std::iterator_traits<FirstIterator>::reference;
+
+    /*!
+     * \brief Creates a ConcatIterator.
+     * \param first The current position in the first range.
+     * \param firstLast The end of the first range.
+     * \param second The current position in the second range.
+     **/
+    ConcatIterator(
+        FirstIterator  first,
+        FirstIterator  firstLast,
+        SecondIterator second)
+        : m_first{first}, m_firstLast{firstLast}, m_second{second}
+    {
+    }
+
+    PL_NODISCARD reference operator*() const
+    {
+        if (m_first != m_firstLast) { return *m_first; }
+
+        return *m_second;
+    }
+
+    PL_NODISCARD pointer operator->() const { return &**this; }
+
+    ConcatIterator& operator++()
+    {
+        if (m_first != m_firstLast) { ++m_first; }
+        else {
+            ++m_second;
+        }
+
+        return *this;
+    }
+
+    ConcatIterator operator++(int)
+    {
+        ConcatIterator copy{*this};
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(
+        const ConcatIterator& lhs,
+        const ConcatIterator& rhs)
+    {
+        return (lhs.m_first == rhs.m_first) and (lhs.m_second == rhs.m_second);
+    }
+
+    friend bool operator!=(
+        const ConcatIterator& lhs,
+        const ConcatIterator& rhs)
+    {
+        return not(lhs == rhs);
+    }
+
+private:
+    FirstIterator  m_first;
+    FirstIterator  m_firstLast;
+    SecondIterator m_second;
+};
+
+/*!
+ * \brief Creates a lazy view of the elements of a range that satisfy a
+ *        unary predicate.
+ * \param range The range to filter.
+ * \param unaryPredicate The predicate.
+ * \return The resulting Range.
+ **/
+template<typename Range, typename UnaryPredicate>
+PL_NODISCARD auto filter(const Range& range, UnaryPredicate unaryPredicate)
+{
+    using std::begin;
+    using std::end;
+
+    using iterator = FilterIterator<
+        std::decay_t<decltype(begin(range))>,
+        std::decay_t<UnaryPredicate>>;
+
+    return views::Range<iterator>{
+        iterator{begin(range), end(range), unaryPredicate},
+        iterator{end(range), end(range), unaryPredicate}};
+}
+
+/*!
+ * \brief Creates a lazy view of the results of invoking a unary invocable
+ *        with the elements of a range.
+ * \param range The range to transform.
+ * \param unaryInvocable The unary invocable.
+ * \return The resulting Range.
+ **/
+template<typename Range, typename UnaryInvocable>
+PL_NODISCARD auto transform(const Range& range, UnaryInvocable unaryInvocable)
+{
+    using std::begin;
+    using std::end;
+
+    using iterator = TransformIterator<
+        std::decay_t<decltype(begin(range))>,
+        std::decay_t<UnaryInvocable>>;
+
+    return views::Range<iterator>{iterator{begin(range), unaryInvocable},
+                                  iterator{end(range), unaryInvocable}};
+}
+
+/*!
+ * \brief Creates a lazy view that traverses one range and then another.
+ * \param first The first range.
+ * \param second The second range.
+ * \return The resulting Range.
+ **/
+template<typename FirstRange, typename SecondRange>
+PL_NODISCARD auto concat(const FirstRange& first, const SecondRange& second)
+{
+    using std::begin;
+    using std::end;
+
+    using iterator = ConcatIterator<
+        std::decay_t<decltype(begin(first))>,
+        std::decay_t<decltype(begin(second))>>;
+
+    return views::Range<iterator>{
+        iterator{begin(first), end(first), begin(second)},
+        iterator{end(first), end(first), end(second)}};
+}
+} // namespace views
+} // namespace gp
+#endif // INCG_GP_VIEWS_HPP
@@ -9,7 +9,9 @@
 #include <nm/identifiers.hpp>
 #include <romania/city.hpp>
 #include <romania/create_graph.hpp>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace std;
 using namespace gp;
@@ -355,3 +357,75 @@ TEST_F(BellmanFordTest, positiveCycleTest)
     EXPECT_EQ(result.shortestPathTo("e"), eExpectedPath);
     EXPECT_EQ(result.shortestPathTo("f"), fExpectedPath);
 }
+
+TEST_F(BellmanFordTest, shouldSkipRemovedVertices)
+{
+    const string startVertex{"a"};
+    const auto   lengthInvocable
+        = [](const bellman_ford::NegativeEdgeGraph::graph_type::edge_type& e) {
+              return e.data().edgeLength();
+          };
+
+    EXPECT_TRUE(negativeEdgeGraph.removeVertex("b"));
+
+    const ShortestPaths<
+        bellman_ford::NegativeEdgeGraph::vertex_identifier,
+        std::int32_t>
+        result{bellman_ford::algorithm(
+            negativeEdgeGraph, startVertex, lengthInvocable)};
+
+    EXPECT_EQ(result.distanceTo("c"), 20);
+    EXPECT_EQ(result.distanceTo("d"), 40);
+    EXPECT_EQ(result.distanceTo("e"), 20);
+    EXPECT_EQ(result.distanceTo("f"), 21);
+    EXPECT_EQ(
+        result.shortestPathTo("f"),
+        (vector<string>{"a", "c", "d", "e", "f"}));
+    EXPECT_THROW((void)result.distanceTo("b"), std::logic_error);
+}
+
+TEST_F(BellmanFordTest, shouldMatchOnColumnStorage)
+{
+    using graph_type = bellman_ford::NegativeEdgeGraph::graph_type;
+    using column_graph_type = DirectedGraph<
+        graph_type::vertex_identifier,
+        graph_type::vertex_data,
+        graph_type::edge_identifier,
+        graph_type::edge_data,
+        ColumnStorage>;
+
+    column_graph_type columnGraph{};
+
+    for (const graph_type::vertex_type& vertex : negativeEdgeGraph.vertices()) {
+        ASSERT_TRUE(columnGraph.addVertex(vertex.identifier(), vertex.data()));
+    }
+
+    for (const graph_type::edge_type& edge : negativeEdgeGraph.edges()) {
+        ASSERT_TRUE(columnGraph.addEdge(
+            edge.identifier(), edge.source(), edge.target(), edge.data()));
+    }
+
+    EXPECT_TRUE(negativeEdgeGraph.removeVertex("b"));
+    EXPECT_TRUE(columnGraph.removeVertex("b"));
+
+    const string startVertex{"a"};
+    const auto   lengthInvocable
+        = [](const auto& e) { return e.data().edgeLength(); };
+
+    const ShortestPaths<
+        bellman_ford::NegativeEdgeGraph::vertex_identifier,
+        std::int32_t>
+        expected{bellman_ford::algorithm(
+            negativeEdgeGraph, startVertex, lengthInvocable)};
+    const ShortestPaths<
+        bellman_ford::NegativeEdgeGraph::vertex_identifier,
+        std::int32_t>
+        result{
+            bellman_ford::algorithm(columnGraph, startVertex, lengthInvocable)};
+
+    for (const string vertex : {"a", "c", "d", "e", "f"}) {
+        EXPECT_EQ(result.distanceTo(vertex), expected.distanceTo(vertex));
+        EXPECT_EQ(
+            result.shortestPathTo(vertex), expected.shortestPathTo(vertex));
+    }
+}
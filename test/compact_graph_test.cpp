@@ -0,0 +1,298 @@
+#include "gtest/gtest.h"
+#include <a_star/algorithm.hpp>
+#include <bellman_ford/algorithm.hpp>
+#include <compact_graph.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <ford_fulkerson/algorithm.hpp>
+#include <ford_fulkerson/create_graph.hpp>
+#include <length_edge_data.hpp>
+#include <nm/create_graph.hpp>
+#include <nm/heuristic.hpp>
+#include <nm/identifiers.hpp>
+#include <romania/city.hpp>
+#include <romania/create_graph.hpp>
+#include <romania/heuristic.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+class CompactGraphTest : public ::testing::Test {
+public:
+    using this_type = CompactGraphTest;
+    using base_type = ::testing::Test;
+
+    struct Romania {
+        using vertex_identifier = romania::City;
+        using vertex_data       = nullptr_t;
+        using edge_identifier   = int;
+        using edge_data         = LengthEdgeData<size_t>;
+        using graph_type        = DirectedGraph<
+            vertex_identifier,
+            vertex_data,
+            edge_identifier,
+            edge_data>;
+        using compact_graph_type
+            = CompactGraph<vertex_identifier, edge_identifier, edge_data>;
+        using edge_type = typename graph_type::edge_type;
+    };
+
+    struct Nm {
+        using vertex_identifier = string;
+        using vertex_data       = nullptr_t;
+        using edge_identifier   = int;
+        using edge_data         = LengthEdgeData<size_t>;
+        using graph_type        = DirectedGraph<
+            vertex_identifier,
+            vertex_data,
+            edge_identifier,
+            edge_data>;
+        using compact_graph_type
+            = CompactGraph<vertex_identifier, edge_identifier, edge_data>;
+        using edge_type = typename graph_type::edge_type;
+    };
+
+    CompactGraphTest()
+        : romaniaGraph{romania::createGraph()}
+        , nmGraph{nm::createGraph()}
+        , romaniaCompactGraph{romaniaGraph}
+        , nmCompactGraph{nmGraph}
+    {
+    }
+
+protected:
+    const Romania::graph_type         romaniaGraph;
+    const Nm::graph_type              nmGraph;
+    const Romania::compact_graph_type romaniaCompactGraph;
+    const Nm::compact_graph_type      nmCompactGraph;
+};
+
+TEST_F(CompactGraphTest, shouldHaveSameShapeAsSourceGraph)
+{
+    ASSERT_EQ(romaniaCompactGraph.vertexCount(), romaniaGraph.vertexCount());
+    ASSERT_EQ(romaniaCompactGraph.edgeCount(), romaniaGraph.edgeCount());
+    ASSERT_EQ(
+        romaniaCompactGraph.offsets().size(), romaniaGraph.vertexCount() + 1);
+
+    for (const auto& vertex : romaniaGraph.vertices()) {
+        const Romania::vertex_identifier& identifier{vertex.identifier()};
+        ASSERT_TRUE(romaniaCompactGraph.hasVertex(identifier));
+
+        const auto index{romaniaCompactGraph.index(identifier)};
+        ASSERT_TRUE(index.has_value());
+        EXPECT_EQ(romaniaCompactGraph.identifier(*index), identifier);
+
+        const vector<const Romania::edge_type*> expected{
+            romaniaGraph.outboundEdges(identifier)};
+        ASSERT_EQ(romaniaCompactGraph.outboundDegree(*index), expected.size());
+
+        size_t i{0};
+
+        for (const auto edge : romaniaCompactGraph.outboundEdges(*index)) {
+            EXPECT_EQ(edge.identifier(), expected[i]->identifier());
+            EXPECT_EQ(edge.source(), identifier);
+            EXPECT_EQ(edge.target(), expected[i]->target());
+            EXPECT_EQ(
+                edge.data().edgeLength(), expected[i]->data().edgeLength());
+            ++i;
+        }
+    }
+}
+
+TEST_F(CompactGraphTest, shouldNotFindUnknownVertex)
+{
+    EXPECT_FALSE(nmCompactGraph.hasVertex("not a vertex"));
+    EXPECT_FALSE(nmCompactGraph.index("not a vertex").has_value());
+}
+
+TEST_F(CompactGraphTest, shouldBeEmptyWhenDefaultConstructed)
+{
+    const Nm::compact_graph_type graph{};
+    EXPECT_EQ(graph.vertexCount(), 0U);
+    EXPECT_EQ(graph.edgeCount(), 0U);
+}
+
+TEST_F(CompactGraphTest, dijkstraShouldMatchDirectedGraph)
+{
+    const auto expected{dijkstra::algorithm(
+        romaniaGraph, romania::City::Arad, [](const Romania::edge_type& edge) {
+            return edge.data().edgeLength();
+        })};
+    const auto actual{dijkstra::algorithm(
+        romaniaCompactGraph, romania::City::Arad, [](const auto& edge) {
+            return edge.data().edgeLength();
+        })};
+
+    for (const auto& vertex : romaniaGraph.vertices()) {
+        EXPECT_EQ(
+            actual.distanceTo(vertex.identifier()),
+            expected.distanceTo(vertex.identifier()));
+        EXPECT_EQ(
+            actual.shortestPathTo(vertex.identifier()),
+            expected.shortestPathTo(vertex.identifier()));
+    }
+
+}
+
+TEST_F(CompactGraphTest, missingEndpointsShouldMatchDirectedGraph)
+{
+    const auto lengthOf
+        = [](const auto& edge) { return edge.data().edgeLength(); };
+    const Nm::vertex_identifier missing{"not a vertex"};
+
+    const auto expected{dijkstra::algorithm(nmGraph, missing, lengthOf)};
+    const auto actual{dijkstra::algorithm(nmCompactGraph, missing, lengthOf)};
+    EXPECT_EQ(actual.distanceTo(missing), 0U);
+    EXPECT_EQ(actual.distanceTo(missing), expected.distanceTo(missing));
+
+    const auto expectedBellmanFord{
+        bellman_ford::algorithm(nmGraph, missing, lengthOf)};
+    const auto actualBellmanFord{
+        bellman_ford::algorithm(nmCompactGraph, missing, lengthOf)};
+    EXPECT_EQ(actualBellmanFord.distanceTo(missing), 0);
+
+    for (const auto& vertex : nmGraph.vertices()) {
+        EXPECT_EQ(
+            actual.distanceTo(vertex.identifier()),
+            expected.distanceTo(vertex.identifier()));
+        EXPECT_EQ(actual.distanceTo(vertex.identifier()), SIZE_MAX);
+        EXPECT_EQ(
+            actualBellmanFord.distanceTo(vertex.identifier()),
+            expectedBellmanFord.distanceTo(vertex.identifier()));
+    }
+
+    const ford_fulkerson::types::graph_type flowGraph{
+        ford_fulkerson::createGraph()};
+    const CompactGraph compactFlowGraph{flowGraph};
+
+    for (const auto& endpoints : {pair{0, 42}, pair{42, 5}}) {
+        const ford_fulkerson::Result expectedFlow{ford_fulkerson::algorithm(
+            flowGraph, endpoints.first, endpoints.second)};
+        const ford_fulkerson::Result actualFlow{ford_fulkerson::algorithm(
+            compactFlowGraph, endpoints.first, endpoints.second)};
+        EXPECT_EQ(actualFlow.maxFlow, 0);
+        EXPECT_EQ(actualFlow.maxFlow, expectedFlow.maxFlow);
+        EXPECT_EQ(actualFlow.flow, expectedFlow.flow);
+    }
+}
+
+TEST_F(CompactGraphTest, bellmanFordShouldMatchDirectedGraph)
+{
+    const Nm::vertex_identifier source{nm::start};
+    const auto                  expected{bellman_ford::algorithm(
+        nmGraph, source, [](const Nm::edge_type& edge) {
+            return edge.data().edgeLength();
+        })};
+    const auto actual{bellman_ford::algorithm(
+        nmCompactGraph, source, [](const auto& edge) {
+            return edge.data().edgeLength();
+        })};
+
+    for (const auto& vertex : nmGraph.vertices()) {
+        EXPECT_EQ(
+            actual.distanceTo(vertex.identifier()),
+            expected.distanceTo(vertex.identifier()));
+    }
+}
+
+TEST_F(CompactGraphTest, aStarShouldMatchDirectedGraph)
+{
+    using C = romania::City;
+
+    const auto isGoal = [](C city) { return city == C::Bucharest; };
+
+    const a_star::Path<C> expected{a_star::algorithm(
+        romaniaGraph, {C::Arad}, isGoal, &romania::heuristic)};
+    const a_star::Path<C> actual{a_star::algorithm(
+        romaniaCompactGraph, {C::Arad}, isGoal, &romania::heuristic)};
+
+    EXPECT_EQ(actual.g(), expected.g());
+    EXPECT_EQ(actual.rawPath(), expected.rawPath());
+}
+
+TEST_F(CompactGraphTest, fordFulkersonShouldMatchDirectedGraph)
+{
+    const ford_fulkerson::types::graph_type graph{
+        ford_fulkerson::createGraph()};
+    const CompactGraph compactGraph{graph};
+
+    const ford_fulkerson::Result expected{
+        ford_fulkerson::algorithm(graph, 0, 5)};
+    const ford_fulkerson::Result actual{
+        ford_fulkerson::algorithm(compactGraph, 0, 5)};
+
+    EXPECT_EQ(actual.maxFlow, expected.maxFlow);
+    EXPECT_EQ(actual.flow, expected.flow);
+}
+
+TEST_F(CompactGraphTest, columnsShouldDescribeEveryEdge)
+{
+    using index_type = Romania::compact_graph_type::index_type;
+
+    const vector<index_type>& sources{romaniaCompactGraph.sources()};
+    const vector<index_type>& targets{romaniaCompactGraph.targets()};
+    ASSERT_EQ(sources.size(), romaniaGraph.edgeCount());
+    ASSERT_EQ(targets.size(), romaniaGraph.edgeCount());
+    ASSERT_EQ(romaniaCompactGraph.edges().size(), romaniaGraph.edgeCount());
+
+    index_type expectedIndex{0};
+
+    for (const auto edge : romaniaCompactGraph.edges()) {
+        ASSERT_EQ(edge.index(), expectedIndex);
+        EXPECT_EQ(edge.sourceIndex(), sources[expectedIndex]);
+        EXPECT_EQ(edge.targetIndex(), targets[expectedIndex]);
+
+        const auto original{romaniaGraph.edge(edge.identifier())};
+        ASSERT_TRUE(original.has_value());
+        EXPECT_EQ(edge.source(), original->source());
+        EXPECT_EQ(edge.target(), original->target());
+        EXPECT_EQ(
+            romaniaCompactGraph.edge(expectedIndex).identifier(),
+            edge.identifier());
+        ++expectedIndex;
+    }
+}
+
+TEST_F(CompactGraphTest, shouldFindEdges)
+{
+    using index_type = Romania::compact_graph_type::index_type;
+
+    const index_type bucharest{
+        *romaniaCompactGraph.index(romania::City::Bucharest)};
+
+    const vector<index_type> byTarget{
+        romaniaCompactGraph.findEdgesByTarget(bucharest)};
+    const vector<index_type> byPredicate{
+        romaniaCompactGraph.findEdges([](const auto& edge) {
+            return edge.target() == romania::City::Bucharest;
+        })};
+
+    EXPECT_EQ(byTarget, byPredicate);
+    EXPECT_EQ(
+        byTarget.size(), romaniaGraph.inboundDegree(romania::City::Bucharest));
+
+    for (const index_type edge : byTarget) {
+        EXPECT_EQ(romaniaCompactGraph.edge(edge).targetIndex(), bucharest);
+    }
+
+    EXPECT_TRUE(romaniaCompactGraph
+                    .findEdges([](const auto& edge) {
+                        return edge.data().edgeLength() == 0U;
+                    })
+                    .empty());
+}
+
+TEST_F(CompactGraphTest, inboundDegreeShouldMatchDirectedGraph)
+{
+    for (const auto& vertex : romaniaGraph.vertices()) {
+        EXPECT_EQ(
+            romaniaCompactGraph.inboundDegree(
+                *romaniaCompactGraph.index(vertex.identifier())),
+            romaniaGraph.inboundDegree(vertex.identifier()));
+    }
+}
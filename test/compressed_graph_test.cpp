@@ -0,0 +1,159 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <compressed_graph.hpp>
+#include <cstddef>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
+#include <random>
+#include <romania/city.hpp>
+#include <romania/create_graph.hpp>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <vertex_order.hpp>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using graph_type = lattice::graph_type;
+
+size_t lengthOf(const graph_type::edge_type& edge) { return edge.data(); }
+
+vector<pair<int, size_t>> neighborsOf(
+    const CompressedGraph<int>& compressed,
+    int                         vertex)
+{
+    vector<pair<int, size_t>> result{};
+
+    for (const auto& neighbor :
+         compressed.outboundEdges(*compressed.index(vertex))) {
+        result.emplace_back(
+            compressed.identifier(neighbor.target), neighbor.length);
+    }
+
+    return result;
+}
+} // namespace
+
+TEST(CompressedGraph, shouldBeEmptyWhenDefaultConstructed)
+{
+    const CompressedGraph<int> graph{};
+    EXPECT_EQ(graph.vertexCount(), 0U);
+    EXPECT_EQ(graph.edgeCount(), 0U);
+    EXPECT_FALSE(graph.hasVertex(0));
+}
+
+TEST(CompressedGraph, shouldDecodeTheOutboundEdges)
+{
+    graph_type graph{};
+
+    for (int v{0}; v < 5; ++v) { EXPECT_TRUE(graph.addVertex(v, nullptr)); }
+
+    // Out of order, backwards, far and parallel edges.
+    EXPECT_TRUE(graph.addEdge(0, 2, 4, 7));
+    EXPECT_TRUE(graph.addEdge(1, 2, 0, 300));
+    EXPECT_TRUE(graph.addEdge(2, 2, 4, 5));
+    EXPECT_TRUE(graph.addEdge(3, 2, 2, 1));
+    EXPECT_TRUE(graph.addEdge(4, 4, 0, 100000));
+
+    const CompressedGraph compressed{graph, &lengthOf};
+    ASSERT_EQ(compressed.vertexCount(), 5U);
+    EXPECT_EQ(compressed.edgeCount(), 5U);
+    EXPECT_EQ(compressed.outboundDegree(2), 4U);
+    EXPECT_EQ(compressed.outboundDegree(4), 1U);
+    EXPECT_EQ(compressed.outboundDegree(0), 0U);
+    EXPECT_TRUE(compressed.outboundEdges(0).empty());
+
+    vector<pair<int, size_t>> actual{};
+
+    for (const auto& neighbor : compressed.outboundEdges(2)) {
+        actual.emplace_back(neighbor.target, neighbor.length);
+    }
+
+    EXPECT_EQ(
+        actual,
+        (vector<pair<int, size_t>>{{0, 300}, {2, 1}, {4, 5}, {4, 7}}));
+    EXPECT_EQ(compressed.outboundEdges(4).begin()->target, 0U);
+    EXPECT_EQ(compressed.outboundEdges(4).begin()->length, 100000U);
+}
+
+TEST(CompressedGraph, shouldQuantizeTheLengths)
+{
+    graph_type graph{};
+    EXPECT_TRUE(graph.addVertex(0, nullptr));
+    EXPECT_TRUE(graph.addVertex(1, nullptr));
+    EXPECT_TRUE(graph.addEdge(0, 0, 1, 14));
+    EXPECT_TRUE(graph.addEdge(1, 0, 1, 15));
+    EXPECT_TRUE(graph.addEdge(2, 0, 1, 1234));
+
+    const CompressedGraph compressed{graph, &lengthOf, 10};
+    EXPECT_EQ(compressed.lengthQuantum(), 10U);
+
+    vector<size_t> lengths{};
+
+    for (const auto& neighbor : compressed.outboundEdges(0)) {
+        lengths.push_back(neighbor.length);
+    }
+
+    EXPECT_EQ(lengths, (vector<size_t>{10, 20, 1230}));
+}
+
+TEST(CompressedGraph, dijkstraShouldMatchDirectedGraph)
+{
+    const auto romaniaGraph{romania::createGraph()};
+    const auto length = [](const auto& edge) {
+        return edge.data().edgeLength();
+    };
+    const CompressedGraph compressed{romaniaGraph, length};
+
+    const auto expected{
+        dijkstra::algorithm(romaniaGraph, romania::City::Arad, length)};
+    const auto actual{dijkstra::algorithm(compressed, romania::City::Arad)};
+
+    for (const auto& vertex : romaniaGraph.vertices()) {
+        EXPECT_EQ(
+            actual.distanceTo(vertex.identifier()),
+            expected.distanceTo(vertex.identifier()));
+        EXPECT_EQ(
+            actual.shortestPathTo(vertex.identifier()),
+            expected.shortestPathTo(vertex.identifier()));
+    }
+
+    EXPECT_THROW(
+        (void)dijkstra::algorithm(
+            compressed, static_cast<romania::City>(1000)),
+        logic_error);
+}
+
+TEST(CompressedGraph, shouldTakeLessThanFourBytesPerEdgeOnALattice)
+{
+    graph_type graph{
+        lattice::createGraph(64, uniform_int_distribution<size_t>{10, 99})};
+    ASSERT_EQ(graph.vertexCount(), 64U * 64U);
+    ASSERT_EQ(graph.edgeCount(), 4U * 64U * 63U);
+    (void)reorder(graph, VertexOrder::ReverseCuthillMcKee);
+    const CompressedGraph compressed{graph, &lengthOf};
+
+    ASSERT_EQ(compressed.edgeCount(), graph.edgeCount());
+    EXPECT_LT(
+        static_cast<double>(compressed.memoryUsage().edges)
+            / static_cast<double>(compressed.edgeCount()),
+        4.0);
+    EXPECT_EQ(compressed.memoryUsage().slack, 0U);
+
+    for (int v : {0, 65, 4095}) {
+        vector<pair<int, size_t>> expected{};
+
+        for (const auto* edge : graph.outboundEdges(v)) {
+            expected.emplace_back(edge->target(), edge->data());
+        }
+
+        sort(expected.begin(), expected.end(), [&graph](auto lhs, auto rhs) {
+            return *graph.vertexIndex(lhs.first)
+                   < *graph.vertexIndex(rhs.first);
+        });
+        EXPECT_EQ(neighborsOf(compressed, v), expected);
+    }
+}
@@ -0,0 +1,142 @@
+#include "gtest/gtest.h"
+#include <a_star/algorithm.hpp>
+#include <atomic>
+#include <bellman_ford/algorithm.hpp>
+#include <concurrent_directed_graph.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/algorithm.hpp>
+#include <length_edge_data.hpp>
+#include <romania/city.hpp>
+#include <romania/create_graph.hpp>
+#include <romania/heuristic.hpp>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using C = romania::City;
+using concurrent_graph_type
+    = ConcurrentDirectedGraph<C, nullptr_t, int, LengthEdgeData<size_t>>;
+using graph_type = concurrent_graph_type::graph_type;
+
+size_t length(const graph_type::edge_type& edge)
+{
+    return edge.data().edgeLength();
+}
+} // namespace
+
+TEST(ConcurrentDirectedGraph, shouldStartAtVersionZero)
+{
+    const concurrent_graph_type graph{};
+    EXPECT_EQ(graph.snapshot().version(), 0U);
+    EXPECT_FALSE(graph.snapshot()->hasVertices());
+}
+
+TEST(ConcurrentDirectedGraph, snapshotsShouldNotSeeLaterVersions)
+{
+    concurrent_graph_type graph{romania::createGraph()};
+
+    const concurrent_graph_type::snapshot_type before{graph.snapshot()};
+    const concurrent_graph_type::snapshot_type published{
+        graph.update([](graph_type& g) { (void)g.removeVertex(C::Pitesti); })};
+
+    EXPECT_EQ(before.version(), 0U);
+    EXPECT_EQ(published.version(), 1U);
+    EXPECT_EQ(graph.snapshot().version(), 1U);
+    EXPECT_TRUE(before->hasVertex(C::Pitesti));
+    EXPECT_FALSE(published->hasVertex(C::Pitesti));
+    EXPECT_FALSE(graph.snapshot()->hasVertex(C::Pitesti));
+
+    // Arad -> Sibiu -> Rimnicu Vilcea -> Pitesti -> Bucharest is the shortest
+    // route, which is closed in the new version.
+    EXPECT_EQ(
+        dijkstra::algorithm(before, C::Arad, &length).distanceTo(C::Bucharest),
+        418U);
+    EXPECT_EQ(
+        dijkstra::algorithm(published, C::Arad, &length)
+            .distanceTo(C::Bucharest),
+        450U);
+
+    const auto isGoal = [](C city) { return city == C::Bucharest; };
+    EXPECT_EQ(
+        a_star::algorithm(before, {C::Arad}, isGoal, &romania::heuristic).g(),
+        418U);
+    EXPECT_EQ(
+        a_star::algorithm(published, {C::Arad}, isGoal, &romania::heuristic)
+            .g(),
+        450U);
+
+    EXPECT_EQ(
+        bellman_ford::algorithm(published, C::Arad, &length)
+            .distanceTo(C::Bucharest),
+        450);
+
+    const concurrent_graph_type::snapshot_type replaced{
+        graph.replace(graph_type{})};
+    EXPECT_EQ(replaced.version(), 2U);
+    EXPECT_FALSE(replaced->hasVertices());
+    EXPECT_TRUE(before->hasVertex(C::Pitesti));
+}
+
+TEST(ConcurrentDirectedGraph, readersShouldSeeConsistentVersions)
+{
+    concurrent_graph_type graph{};
+    atomic<bool>          isDone{false};
+    atomic<size_t>        inconsistencies{0};
+    atomic<size_t>        reads{0};
+
+    // Every version is a path, so it has one edge less than it has vertices.
+    // The versions a reader sees must never decrease.
+    const auto read = [&graph, &isDone, &inconsistencies, &reads] {
+        uint64_t previousVersion{0};
+
+        while (not isDone or (reads < 1000)) {
+            const concurrent_graph_type::snapshot_type snapshot{
+                graph.snapshot()};
+            const size_t vertexCount{snapshot->vertexCount()};
+            const size_t expectedEdgeCount{
+                vertexCount == 0 ? 0 : vertexCount - 1};
+
+            if ((snapshot->edgeCount() != expectedEdgeCount)
+                or (snapshot.version() < previousVersion)) {
+                ++inconsistencies;
+            }
+
+            previousVersion = snapshot.version();
+            ++reads;
+        }
+    };
+
+    vector<thread> readers{};
+
+    for (int i{0}; i < 4; ++i) { readers.emplace_back(read); }
+
+    for (int i{0}; i < 200; ++i) {
+        const int city{i % 20};
+
+        (void)graph.update([i, city](graph_type& g) {
+            (void)g.addVertex(static_cast<C>(city), nullptr);
+
+            if (city != 0) {
+                (void)g.addEdge(
+                    i,
+                    static_cast<C>(city - 1),
+                    static_cast<C>(city),
+                    LengthEdgeData<size_t>{1});
+            }
+        });
+
+        // There are only 20 cities, so start over with an empty graph.
+        if (city == 19) { (void)graph.replace(graph_type{}); }
+    }
+
+    isDone = true;
+
+    for (thread& reader : readers) { reader.join(); }
+
+    EXPECT_EQ(graph.snapshot().version(), 210U);
+    EXPECT_EQ(inconsistencies, 0U);
+}
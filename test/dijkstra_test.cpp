@@ -1,15 +1,23 @@
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <cstddef>
 #include <dijkstra/algorithm.hpp>
+#include <dijkstra/bidirectional.hpp>
+#include <dijkstra/multi_source.hpp>
+#include <dijkstra/point_to_point.hpp>
 #include <directed_graph.hpp>
+#include <lattice/create_graph.hpp>
 #include <length_edge_data.hpp>
 #include <nm/create_graph.hpp>
 #include <nm/identifiers.hpp>
 #include <ostream>
+#include <random>
 #include <romania/city.hpp>
 #include <romania/create_graph.hpp>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace std;
 using namespace gp;
@@ -254,3 +262,505 @@ TEST_F(DijkstraTest, nonMonotonicTest)
     EXPECT_EQ(result.shortestPathTo(e), eExpectedPath);
     EXPECT_EQ(result.shortestPathTo(goal), goalExpectedPath);
 }
+
+TEST_F(DijkstraTest, queueKindsShouldAgree)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    const ShortestPaths<Romania::vertex_identifier, size_t> heap{
+        dijkstra::algorithm(
+            romaniaGraph,
+            romania::City::Arad,
+            lengthInvocable,
+            pmr::get_default_resource(),
+            dijkstra::QueueKind::IndexedHeap)};
+
+    for (dijkstra::QueueKind queueKind :
+         {dijkstra::QueueKind::SortedVector,
+          dijkstra::QueueKind::DialBuckets,
+          dijkstra::QueueKind::RadixHeap,
+          dijkstra::QueueKind::Automatic}) {
+        const ShortestPaths<Romania::vertex_identifier, size_t> other{
+            dijkstra::algorithm(
+                romaniaGraph,
+                romania::City::Arad,
+                lengthInvocable,
+                pmr::get_default_resource(),
+                queueKind)};
+
+        for (const Romania::vertex_type& vertex : romaniaGraph.vertices()) {
+            EXPECT_EQ(
+                heap.distanceTo(vertex.identifier()),
+                other.distanceTo(vertex.identifier()));
+            EXPECT_EQ(
+                heap.shortestPathTo(vertex.identifier()),
+                other.shortestPathTo(vertex.identifier()));
+        }
+    }
+}
+
+TEST_F(DijkstraTest, unreachableVerticesShouldStayInfinitelyFarAway)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+    EXPECT_TRUE(nmGraph.addVertex("y", nullptr));
+    EXPECT_TRUE(nmGraph.addEdge(1000, "x", "y", LengthEdgeData<size_t>{1}));
+
+    for (dijkstra::QueueKind queueKind :
+         {dijkstra::QueueKind::IndexedHeap,
+          dijkstra::QueueKind::SortedVector,
+          dijkstra::QueueKind::DialBuckets,
+          dijkstra::QueueKind::RadixHeap,
+          dijkstra::QueueKind::Automatic}) {
+        const ShortestPaths<Nm::vertex_identifier, size_t> result{
+            dijkstra::algorithm(
+                nmGraph,
+                string{nm::start},
+                lengthInvocable,
+                pmr::get_default_resource(),
+                queueKind)};
+
+        EXPECT_EQ(result.distanceTo("x"), SIZE_MAX);
+        EXPECT_EQ(result.distanceTo("y"), SIZE_MAX);
+        EXPECT_EQ(result.distanceTo(nm::goal), 20U);
+    }
+}
+
+TEST_F(DijkstraTest, dialBucketsShouldHandleHugeEdgeLengths)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    // A bucket per possible length would take petabytes.
+    constexpr size_t huge{size_t{1} << 50};
+
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+    EXPECT_TRUE(nmGraph.addVertex("y", nullptr));
+    EXPECT_TRUE(nmGraph.addEdge(
+        1000, string{nm::start}, "x", LengthEdgeData<size_t>{huge}));
+    EXPECT_TRUE(nmGraph.addEdge(1001, "x", "y", LengthEdgeData<size_t>{1}));
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> result{
+        dijkstra::algorithm(
+            nmGraph,
+            string{nm::start},
+            lengthInvocable,
+            pmr::get_default_resource(),
+            dijkstra::QueueKind::DialBuckets)};
+
+    EXPECT_EQ(result.distanceTo("x"), huge);
+    EXPECT_EQ(result.distanceTo("y"), huge + 1);
+    EXPECT_EQ(result.distanceTo(nm::goal), 20U);
+
+    // The seeds widen the window, too.
+    const NearestSources<Nm::vertex_identifier, size_t> offset{
+        dijkstra::nearestSources(
+            nmGraph,
+            vector<pair<Nm::vertex_identifier, size_t>>{{"y", SIZE_MAX - 1}},
+            lengthInvocable,
+            pmr::get_default_resource(),
+            dijkstra::QueueKind::DialBuckets)};
+
+    EXPECT_EQ(offset.distanceTo("y"), SIZE_MAX - 1);
+}
+
+TEST_F(DijkstraTest, pointToPointShouldMatchTheFullSearch)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    const ShortestPaths<Romania::vertex_identifier, size_t> full{
+        dijkstra::algorithm(
+            romaniaGraph, romania::City::Arad, lengthInvocable)};
+
+    for (const Romania::vertex_type& vertex : romaniaGraph.vertices()) {
+        for (dijkstra::QueueKind queueKind :
+             {dijkstra::QueueKind::IndexedHeap,
+              dijkstra::QueueKind::Automatic}) {
+            const ShortestPaths<Romania::vertex_identifier, size_t> result{
+                dijkstra::pointToPoint(
+                    romaniaGraph,
+                    romania::City::Arad,
+                    vertex.identifier(),
+                    lengthInvocable,
+                    pmr::get_default_resource(),
+                    queueKind)};
+
+            EXPECT_EQ(
+                result.distanceTo(vertex.identifier()),
+                full.distanceTo(vertex.identifier()));
+            EXPECT_EQ(
+                result.shortestPathTo(vertex.identifier()),
+                full.shortestPathTo(vertex.identifier()));
+        }
+    }
+}
+
+TEST_F(DijkstraTest, toTargetsShouldOnlyHoldTheExploredRegion)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    const ShortestPaths<Romania::vertex_identifier, size_t> result{
+        dijkstra::toTargets(
+            romaniaGraph,
+            romania::City::Arad,
+            {romania::City::Zerind, romania::City::Timisoara},
+            lengthInvocable)};
+
+    EXPECT_EQ(result.distanceTo(romania::City::Zerind), 75U);
+    EXPECT_EQ(result.distanceTo(romania::City::Timisoara), 118U);
+    EXPECT_EQ(
+        result.shortestPathTo(romania::City::Timisoara),
+        (vector<romania::City>{romania::City::Arad, romania::City::Timisoara}));
+    EXPECT_THROW(
+        (void)result.distanceTo(romania::City::Bucharest), logic_error);
+}
+
+TEST_F(DijkstraTest, toTargetsShouldReportUnreachableTargets)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> result{
+        dijkstra::toTargets(
+            nmGraph,
+            string{nm::start},
+            {string{"x"}, string{nm::goal}, string{"not a vertex"}},
+            lengthInvocable)};
+
+    EXPECT_EQ(result.distanceTo("x"), SIZE_MAX);
+    EXPECT_TRUE(result.shortestPathTo("x").empty());
+    EXPECT_EQ(result.distanceTo(nm::goal), 20U);
+    EXPECT_THROW((void)result.distanceTo("not a vertex"), logic_error);
+}
+
+TEST_F(DijkstraTest, pointToPointShouldReuseTheWorkspace)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    dijkstra::Workspace<Romania::graph_type::index_type> workspace{};
+
+    for (const Romania::vertex_type& source : romaniaGraph.vertices()) {
+        const ShortestPaths<Romania::vertex_identifier, size_t> full{
+            dijkstra::algorithm(
+                romaniaGraph, source.identifier(), lengthInvocable)};
+
+        for (const Romania::vertex_type& target : romaniaGraph.vertices()) {
+            for (dijkstra::QueueKind queueKind :
+                 {dijkstra::QueueKind::IndexedHeap,
+                  dijkstra::QueueKind::SortedVector,
+                  dijkstra::QueueKind::DialBuckets,
+                  dijkstra::QueueKind::RadixHeap}) {
+                const ShortestPaths<Romania::vertex_identifier, size_t>
+                    result{dijkstra::pointToPoint(
+                        romaniaGraph,
+                        source.identifier(),
+                        target.identifier(),
+                        lengthInvocable,
+                        workspace,
+                        queueKind)};
+
+                EXPECT_EQ(
+                    result.distanceTo(target.identifier()),
+                    full.distanceTo(target.identifier()));
+                EXPECT_EQ(
+                    result.shortestPathTo(target.identifier()),
+                    full.shortestPathTo(target.identifier()));
+            }
+        }
+    }
+}
+
+TEST_F(DijkstraTest, workspaceShouldNoticeGraphMutations)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    dijkstra::Workspace<Nm::graph_type::index_type> workspace{};
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> before{
+        dijkstra::pointToPoint(
+            nmGraph,
+            string{nm::start},
+            string{nm::goal},
+            lengthInvocable,
+            workspace,
+            dijkstra::QueueKind::DialBuckets)};
+
+    EXPECT_EQ(before.distanceTo(nm::goal), 20U);
+
+    // Longer than any edge the cached weight bound has seen.
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+    EXPECT_TRUE(nmGraph.addEdge(
+        1000, string{nm::start}, "x", LengthEdgeData<size_t>{500}));
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> after{
+        dijkstra::toTargets(
+            nmGraph,
+            string{nm::start},
+            {string{"x"}, string{nm::goal}},
+            lengthInvocable,
+            workspace,
+            dijkstra::QueueKind::DialBuckets)};
+
+    EXPECT_EQ(after.distanceTo("x"), 500U);
+    EXPECT_EQ(after.distanceTo(nm::goal), 20U);
+}
+
+TEST_F(DijkstraTest, workspaceShouldNoticeGraphAssignment)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    // Five mutations each, so both graphs end up with the same version.
+    const auto path = [](size_t length) {
+        Nm::graph_type graph{};
+        EXPECT_TRUE(graph.addVertex("a", nullptr));
+        EXPECT_TRUE(graph.addVertex("b", nullptr));
+        EXPECT_TRUE(graph.addVertex("c", nullptr));
+        EXPECT_TRUE(graph.addEdge(0, "a", "b", LengthEdgeData<size_t>{1}));
+        EXPECT_TRUE(
+            graph.addEdge(1, "b", "c", LengthEdgeData<size_t>{length}));
+        return graph;
+    };
+
+    dijkstra::Workspace<Nm::graph_type::index_type> workspace{};
+    Nm::graph_type                                  graph{path(1)};
+
+    EXPECT_EQ(
+        dijkstra::pointToPoint(
+            graph,
+            string{"a"},
+            string{"c"},
+            lengthInvocable,
+            workspace,
+            dijkstra::QueueKind::DialBuckets)
+            .distanceTo("c"),
+        2U);
+
+    graph = path(1000);
+    ASSERT_EQ(graph.version(), path(1).version());
+
+    EXPECT_EQ(
+        dijkstra::pointToPoint(
+            graph,
+            string{"a"},
+            string{"c"},
+            lengthInvocable,
+            workspace,
+            dijkstra::QueueKind::DialBuckets)
+            .distanceTo("c"),
+        1001U);
+}
+
+TEST_F(DijkstraTest, bidirectionalShouldMatchTheFullSearch)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    for (const Romania::vertex_type& from : romaniaGraph.vertices()) {
+        const ShortestPaths<Romania::vertex_identifier, size_t> full{
+            dijkstra::algorithm(
+                romaniaGraph, from.identifier(), lengthInvocable)};
+
+        for (const Romania::vertex_type& to : romaniaGraph.vertices()) {
+            const ShortestPaths<Romania::vertex_identifier, size_t> result{
+                dijkstra::bidirectional(
+                    romaniaGraph,
+                    from.identifier(),
+                    to.identifier(),
+                    lengthInvocable)};
+
+            EXPECT_EQ(
+                result.distanceTo(to.identifier()),
+                full.distanceTo(to.identifier()));
+            EXPECT_EQ(
+                result.shortestPathTo(to.identifier()),
+                full.shortestPathTo(to.identifier()));
+        }
+    }
+}
+
+TEST_F(DijkstraTest, bidirectionalShouldSettleFewerVerticesThanTheFullSearch)
+{
+    using graph_type = lattice::graph_type;
+
+    const auto lengthInvocable
+        = [](const graph_type::edge_type& edge) { return edge.data(); };
+
+    // Two vertices far apart in the middle rows of a lattice: a search from
+    // one side settles a disk reaching the other, a bidirectional search two
+    // disks of about half the radius.
+    constexpr int    side{64};
+    const graph_type graph{lattice::createGraph(
+        side, uniform_int_distribution<size_t>{1, 100})};
+    const int        source{(side / 2) * side + 8};
+    const int        target{(side / 2) * side + side - 8};
+
+    dijkstra::SearchStatistics unidirectionalStatistics{0};
+    const ShortestPaths<int, size_t> unidirectional{dijkstra::pointToPoint(
+        graph,
+        source,
+        target,
+        lengthInvocable,
+        pmr::get_default_resource(),
+        dijkstra::QueueKind::IndexedHeap,
+        &unidirectionalStatistics)};
+
+    dijkstra::SearchStatistics bidirectionalStatistics{0};
+    const ShortestPaths<int, size_t> bidirectional{dijkstra::bidirectional(
+        graph,
+        source,
+        target,
+        lengthInvocable,
+        pmr::get_default_resource(),
+        &bidirectionalStatistics)};
+
+    EXPECT_EQ(
+        bidirectional.distanceTo(target), unidirectional.distanceTo(target));
+    EXPECT_GT(bidirectionalStatistics.settledVertices, 0U);
+    EXPECT_LT(
+        bidirectionalStatistics.settledVertices,
+        unidirectionalStatistics.settledVertices);
+}
+
+TEST_F(DijkstraTest, bidirectionalShouldReportUnreachableTargets)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> result{
+        dijkstra::bidirectional(
+            nmGraph, string{nm::start}, string{"x"}, lengthInvocable)};
+
+    EXPECT_EQ(result.distanceTo("x"), SIZE_MAX);
+    EXPECT_TRUE(result.shortestPathTo("x").empty());
+
+    const ShortestPaths<Nm::vertex_identifier, size_t> self{
+        dijkstra::bidirectional(
+            nmGraph, string{nm::start}, string{nm::start}, lengthInvocable)};
+
+    EXPECT_EQ(self.distanceTo(nm::start), 0U);
+    EXPECT_EQ(self.shortestPathTo(nm::start), vector<string>{nm::start});
+}
+
+TEST_F(DijkstraTest, nearestSourcesShouldMatchTheClosestFullSearch)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    const vector<romania::City> depots{
+        romania::City::Arad, romania::City::Bucharest, romania::City::Iasi};
+
+    vector<ShortestPaths<Romania::vertex_identifier, size_t>> full{};
+
+    for (romania::City depot : depots) {
+        full.push_back(
+            dijkstra::algorithm(romaniaGraph, depot, lengthInvocable));
+    }
+
+    for (dijkstra::QueueKind queueKind :
+         {dijkstra::QueueKind::IndexedHeap,
+          dijkstra::QueueKind::DialBuckets,
+          dijkstra::QueueKind::RadixHeap}) {
+        const NearestSources<Romania::vertex_identifier, size_t> result{
+            dijkstra::nearestSources(
+                romaniaGraph,
+                depots,
+                lengthInvocable,
+                pmr::get_default_resource(),
+                queueKind)};
+
+        for (const Romania::vertex_type& vertex : romaniaGraph.vertices()) {
+            const romania::City city{vertex.identifier()};
+            size_t              closest{SIZE_MAX};
+
+            for (const auto& paths : full) {
+                closest = min(closest, paths.distanceTo(city));
+            }
+
+            EXPECT_EQ(result.distanceTo(city), closest);
+
+            // The path leads from the owning source to the vertex.
+            const tl::optional<romania::City> owner{result.sourceOf(city)};
+            ASSERT_TRUE(owner.has_value());
+
+            const vector<romania::City> path{result.shortestPathTo(city)};
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), *owner);
+            EXPECT_EQ(path.back(), city);
+        }
+
+        for (romania::City depot : depots) {
+            EXPECT_EQ(result.distanceTo(depot), 0U);
+            EXPECT_EQ(result.sourceOf(depot), depot);
+            EXPECT_EQ(
+                result.shortestPathTo(depot), vector<romania::City>{depot});
+        }
+    }
+}
+
+TEST_F(DijkstraTest, nearestSourcesShouldApplyTheOffsets)
+{
+    const auto lengthInvocable = [](const Romania::edge_type& edge) {
+        return edge.data().edgeLength();
+    };
+
+    // Zerind is 75 away from Arad and 71 away from Oradea.
+    const NearestSources<Romania::vertex_identifier, size_t> plain{
+        dijkstra::nearestSources(
+            romaniaGraph,
+            vector<romania::City>{romania::City::Arad, romania::City::Oradea},
+            lengthInvocable)};
+    EXPECT_EQ(plain.sourceOf(romania::City::Zerind), romania::City::Oradea);
+    EXPECT_EQ(plain.distanceTo(romania::City::Zerind), 71U);
+
+    const NearestSources<Romania::vertex_identifier, size_t> offset{
+        dijkstra::nearestSources(
+            romaniaGraph,
+            vector<pair<romania::City, size_t>>{
+                {romania::City::Arad, 0}, {romania::City::Oradea, 10}},
+            lengthInvocable)};
+    EXPECT_EQ(offset.sourceOf(romania::City::Zerind), romania::City::Arad);
+    EXPECT_EQ(offset.distanceTo(romania::City::Zerind), 75U);
+    EXPECT_EQ(offset.distanceTo(romania::City::Oradea), 10U);
+    EXPECT_EQ(
+        offset.shortestPathTo(romania::City::Zerind),
+        (vector<romania::City>{romania::City::Arad, romania::City::Zerind}));
+}
+
+TEST_F(DijkstraTest, nearestSourcesShouldLeaveUnreachableVerticesUnowned)
+{
+    const auto lengthInvocable
+        = [](const Nm::edge_type& edge) { return edge.data().edgeLength(); };
+
+    EXPECT_TRUE(nmGraph.addVertex("x", nullptr));
+
+    const NearestSources<Nm::vertex_identifier, size_t> result{
+        dijkstra::nearestSources(
+            nmGraph,
+            vector<string>{string{nm::start}, string{"not a vertex"}},
+            lengthInvocable)};
+
+    EXPECT_EQ(result.distanceTo(nm::goal), 20U);
+    EXPECT_EQ(result.sourceOf(nm::goal), string{nm::start});
+    EXPECT_EQ(result.distanceTo("x"), SIZE_MAX);
+    EXPECT_FALSE(result.sourceOf("x").has_value());
+    EXPECT_TRUE(result.shortestPathTo("x").empty());
+    EXPECT_THROW((void)result.sourceOf("not a vertex"), logic_error);
+}
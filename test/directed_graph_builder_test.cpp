@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+#include <directed_graph.hpp>
+#include <directed_graph_builder.hpp>
+#include <execution>
+#include <iterator>
+#include <pl/meta/remove_cvref.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using builder_type = DirectedGraphBuilder<string, int, int, string>;
+using graph_type   = builder_type::graph_type;
+using vertex_type  = builder_type::vertex_type;
+using edge_type    = builder_type::edge_type;
+
+template<typename Range>
+auto identifiersOf(const Range& range)
+{
+    using element_type = pl::meta::remove_cvref_t<decltype(*range.begin())>;
+    vector<typename element_type::identifier_type> result{};
+
+    for (const auto& element : range) {
+        result.push_back(element.identifier());
+    }
+
+    return result;
+}
+
+// Feeds a mix of valid, duplicate and dangling elements to a builder.
+void fill(builder_type& builder)
+{
+    vector<vertex_type> vertices{
+        vertex_type{"B", 2}, vertex_type{"C", 3}, vertex_type{"A", 4}};
+    const vector<edge_type> edges{edge_type{2, "B", "C", "B->C"},
+                                  edge_type{3, "C", "D", "C->D"},
+                                  edge_type{1, "A", "C", "A->C"}};
+
+    builder.reserve(5, 7)
+        .addVertex("A", 1)
+        .addVertices(std::move(vertices))
+        .addVertex("D", 5)
+        .addEdge(1, "A", "B", "A->B")
+        .addEdge(4, "X", "A", "X->A")
+        .addEdges(edges.begin(), edges.end())
+        .addEdge(5, "D", "D", "D->D")
+        .addEdge(1, "D", "A", "D->A");
+}
+
+void expectFilled(const builder_type::Result& result)
+{
+    const graph_type& graph{result.graph};
+
+    EXPECT_FALSE(result.isComplete());
+    EXPECT_EQ(
+        identifiersOf(graph.vertices()),
+        (vector<string>{"A", "B", "C", "D"}));
+    EXPECT_EQ(identifiersOf(graph.edges()), (vector<int>{1, 2, 3, 5}));
+    EXPECT_EQ(graph.vertex("A")->data(), 1);
+    EXPECT_EQ(graph.edge(1)->data(), "A->B");
+
+    EXPECT_EQ(identifiersOf(result.duplicateVertices), (vector<string>{"A"}));
+    EXPECT_EQ(result.duplicateVertices.front().data(), 4);
+    EXPECT_EQ(identifiersOf(result.duplicateEdges), (vector<int>{1, 1}));
+    EXPECT_EQ(result.duplicateEdges.front().data(), "A->C");
+    EXPECT_EQ(identifiersOf(result.danglingEdges), (vector<int>{4}));
+
+    EXPECT_EQ(graph.outboundDegree("A"), 1U);
+    EXPECT_EQ(graph.inboundDegree("C"), 1U);
+    EXPECT_EQ(graph.degree("D"), 3U);
+    EXPECT_EQ(graph.maximumDegree().vertex, &*graph.vertex("D"));
+    EXPECT_EQ(graph.maximumDegree().degree, 3U);
+    EXPECT_EQ(graph.minimumDegree().degree, 1U);
+}
+} // namespace
+
+TEST(DirectedGraphBuilder, shouldBuildEmptyGraph)
+{
+    builder_type                builder{};
+    const builder_type::Result result{builder.build()};
+
+    EXPECT_TRUE(result.isComplete());
+    EXPECT_FALSE(result.graph.hasVertices());
+    EXPECT_FALSE(result.graph.hasEdges());
+}
+
+TEST(DirectedGraphBuilder, shouldMatchSequentialInsertion)
+{
+    builder_type builder{};
+    fill(builder);
+    EXPECT_EQ(builder.vertexCount(), 5U);
+    EXPECT_EQ(builder.edgeCount(), 7U);
+
+    expectFilled(builder.build());
+    EXPECT_EQ(builder.vertexCount(), 0U);
+    EXPECT_EQ(builder.edgeCount(), 0U);
+}
+
+TEST(DirectedGraphBuilder, shouldBuildInParallel)
+{
+    builder_type builder{};
+    fill(builder);
+    expectFilled(builder.build(std::execution::par));
+
+    fill(builder);
+    expectFilled(builder.build(std::execution::seq));
+}
+
+TEST(DirectedGraphBuilder, shouldAcceptMovedVertices)
+{
+    vector<vertex_type> vertices{vertex_type{"A", 1}, vertex_type{"B", 2}};
+
+    builder_type builder{};
+    builder
+        .addVertices(
+            make_move_iterator(vertices.begin()),
+            make_move_iterator(vertices.end()))
+        .addEdge(1, "A", "B", "A->B");
+
+    builder_type::Result result{builder.build()};
+    EXPECT_TRUE(result.isComplete());
+
+    // The graph built behaves like any other.
+    graph_type& graph{result.graph};
+    EXPECT_TRUE(graph.addVertex("C", 3));
+    EXPECT_TRUE(graph.addEdge(2, "B", "C", "B->C"));
+    EXPECT_FALSE(graph.addEdge(1, "C", "A", "C->A"));
+    EXPECT_EQ(graph.degree("B"), 2U);
+    EXPECT_EQ(graph.maximumDegree().vertex, &*graph.vertex("B"));
+    EXPECT_TRUE(graph.removeVertex("B"));
+    EXPECT_FALSE(graph.hasEdges());
+}
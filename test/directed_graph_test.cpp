@@ -1,10 +1,15 @@
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <ciso646>
+#include <cstddef>
 #include <cstdint>
 #include <directed_graph.hpp>
+#include <execution>
+#include <pl/meta/remove_cvref.hpp>
 #include <string>
 #include <tl/optional.hpp>
 #include <type_traits>
+#include <vector>
 
 using namespace std;
 using namespace gp;
@@ -291,8 +296,10 @@ TEST_F(DirectedGraphTest, hasEdgeEmpty)
 
 TEST_F(DirectedGraphTest, vertices)
 {
-    const std::vector<Vertex<Vertices, string>>& v{g.vertices()};
-    const std::vector<Vertex<Vertices, string>>  expected{
+    const graph_type::vertex_list               vertices{g.vertices()};
+    const std::vector<Vertex<Vertices, string>> v(
+        vertices.begin(), vertices.end());
+    const std::vector<Vertex<Vertices, string>> expected{
         Vertex<Vertices, string>{V1, "vertex 1"},
         Vertex<Vertices, string>{V2, "vertex 2"},
         Vertex<Vertices, string>{V3, "vertex 3"},
@@ -308,8 +315,10 @@ TEST_F(DirectedGraphTest, verticesEmpty)
 
 TEST_F(DirectedGraphTest, edges)
 {
-    const std::vector<Edge<Edges, string, Vertices>>& e{g.edges()};
-    const std::vector<Edge<Edges, string, Vertices>>  expected{
+    const graph_type::edge_list                      edges{g.edges()};
+    const std::vector<Edge<Edges, string, Vertices>> e(
+        edges.begin(), edges.end());
+    const std::vector<Edge<Edges, string, Vertices>> expected{
         Edge<Edges, string, Vertices>{E1, V1, V1, "edge 1"},
         Edge<Edges, string, Vertices>{E2, V1, V2, "edge 2"},
         Edge<Edges, string, Vertices>{E3, V2, V1, "edge 3"},
@@ -668,6 +677,139 @@ TEST_F(DirectedGraphTest, findEdges)
     EXPECT_TRUE(hasIdentifiers(result, expected));
 }
 
+TEST_F(DirectedGraphTest, findWithExecutionPolicy)
+{
+    const auto isOdd = [](const auto& element) {
+        return (static_cast<uint32_t>(element.identifier()) % UINT32_C(2))
+               == UINT32_C(1);
+    };
+
+    EXPECT_TRUE(g.removeEdge(E4));
+    EXPECT_EQ(g.findVertices(std::execution::par, isOdd), g.findVertices(isOdd));
+    EXPECT_EQ(g.findEdges(std::execution::par, isOdd), g.findEdges(isOdd));
+    EXPECT_EQ(g.findEdges(std::execution::seq, isOdd), g.findEdges(isOdd));
+    EXPECT_TRUE(empty.findEdges(std::execution::par, isOdd).empty());
+}
+
+TEST(DirectedGraph, findWithExecutionPolicyShouldMergeChunksInOrder)
+{
+    DirectedGraph<int, nullptr_t, int, nullptr_t> graph{};
+    constexpr int                                 count{20000};
+
+    for (int i{0}; i < count; ++i) { EXPECT_TRUE(graph.addVertex(i, nullptr)); }
+
+    for (int i{0}; i < count; ++i) {
+        EXPECT_TRUE(graph.addEdge(i, i, (i * 7) % count, nullptr));
+    }
+
+    // Leave tombstones behind in several chunks.
+    for (int i{0}; i < count; i += 3) { EXPECT_TRUE(graph.removeEdge(i)); }
+
+    const auto isSelected = [](const auto& element) {
+        return (element.identifier() % 5) != 0;
+    };
+
+    const auto edges{graph.findEdges(std::execution::par, isSelected)};
+    EXPECT_EQ(edges, graph.findEdges(isSelected));
+    EXPECT_EQ(
+        graph.findVertices(std::execution::par_unseq, isSelected),
+        graph.findVertices(isSelected));
+
+    for (size_t i{1}; i < edges.size(); ++i) {
+        EXPECT_LT(edges[i - 1]->identifier(), edges[i]->identifier());
+    }
+}
+
+template<typename Range>
+inline auto identifiersOf(const Range& range)
+{
+    std::vector<
+        pl::meta::remove_cvref_t<decltype((*range.begin()).identifier())>>
+        result{};
+
+    for (const auto& element : range) {
+        result.push_back(element.identifier());
+    }
+
+    return result;
+}
+
+TEST_F(DirectedGraphTest, edgeRangesEmpty)
+{
+    EXPECT_TRUE(empty.inboundEdgeRange(V1).empty());
+    EXPECT_TRUE(empty.outboundEdgeRange(V1).empty());
+    EXPECT_TRUE(empty.incidentEdgeRange(V1).empty());
+    EXPECT_TRUE(empty.adjacentVertexRange(V1).empty());
+    EXPECT_TRUE(
+        empty.findVertexRange([](const graph_type::vertex_type&) {
+                 return true;
+             })
+            .empty());
+    EXPECT_TRUE(
+        empty.findEdgeRange([](const graph_type::edge_type&) { return true; })
+            .empty());
+}
+
+TEST_F(DirectedGraphTest, inboundEdgeRange)
+{
+    const std::vector<Edges> e1{E1, E3, E8}, e5{E6, E9};
+
+    EXPECT_EQ(identifiersOf(g.inboundEdgeRange(V1)), e1);
+    EXPECT_EQ(identifiersOf(g.inboundEdgeRange(V5)), e5);
+    EXPECT_EQ(g.inboundEdgeRange(V1).size(), e1.size());
+}
+
+TEST_F(DirectedGraphTest, outboundEdgeRange)
+{
+    const std::vector<Edges> e1{E1, E2}, e5{E7, E8, E9};
+
+    EXPECT_EQ(identifiersOf(g.outboundEdgeRange(V1)), e1);
+    EXPECT_EQ(identifiersOf(g.outboundEdgeRange(V5)), e5);
+    EXPECT_EQ(g.outboundEdgeRange(V5).size(), e5.size());
+}
+
+TEST_F(DirectedGraphTest, incidentEdgeRange)
+{
+    const std::vector<Edges> e1{E1, E3, E8, E2}, e3{E4, E5},
+        e5{E6, E9, E7, E8};
+
+    EXPECT_EQ(identifiersOf(g.incidentEdgeRange(V1)), e1);
+    EXPECT_EQ(identifiersOf(g.incidentEdgeRange(V3)), e3);
+    EXPECT_EQ(identifiersOf(g.incidentEdgeRange(V5)), e5);
+}
+
+TEST_F(DirectedGraphTest, adjacentVertexRange)
+{
+    const std::vector<Vertices> v1{V1, V2, V5, V2}, v4{V3, V5};
+
+    EXPECT_EQ(identifiersOf(g.adjacentVertexRange(V1)), v1);
+    EXPECT_EQ(identifiersOf(g.adjacentVertexRange(V4)), v4);
+}
+
+TEST_F(DirectedGraphTest, findVertexRange)
+{
+    const std::vector<Vertices> expected{V2, V4};
+
+    EXPECT_EQ(
+        identifiersOf(
+            g.findVertexRange([](const graph_type::vertex_type& vertex) {
+                return (vertex.identifier() == V2)
+                       or (vertex.identifier() == V4);
+            })),
+        expected);
+}
+
+TEST_F(DirectedGraphTest, findEdgeRange)
+{
+    const std::vector<Edges> expected{E1, E9};
+
+    EXPECT_EQ(
+        identifiersOf(g.findEdgeRange([](const graph_type::edge_type& edge) {
+            return edge.source() == edge.target();
+        })),
+        expected);
+}
+
 TEST_F(DirectedGraphTest, inboundDegreeEmpty)
 {
     const size_t val1{empty.inboundDegree(V1)};
@@ -820,6 +962,37 @@ TEST_F(DirectedGraphTest, minimumDegree)
     EXPECT_EQ(expected, result);
 }
 
+TEST_F(DirectedGraphTest, degreesAfterMutations)
+{
+    const auto expectDegree = [this](
+                                  graph_type::VertexWithDegree result,
+                                  Vertices                     vertex,
+                                  std::size_t                  degree) {
+        ASSERT_NE(result.vertex, nullptr);
+        EXPECT_EQ(result.vertex->identifier(), vertex);
+        EXPECT_EQ(result.degree, degree);
+        EXPECT_EQ(g.degree(vertex), degree);
+    };
+
+    ASSERT_TRUE(g.removeEdge(E2));
+    expectDegree(g.maximumDegree(), V5, 5U);
+    expectDegree(g.minimumDegree(), V3, 2U);
+
+    ASSERT_TRUE(g.removeVertex(V3));
+    expectDegree(g.maximumDegree(), V5, 5U);
+    expectDegree(g.minimumDegree(), V4, 1U);
+
+    ASSERT_TRUE(g.addVertex(V3, "vertex 3"));
+    expectDegree(g.minimumDegree(), V3, 0U);
+
+    ASSERT_TRUE(g.addEdge(E2, V1, V1, "edge 2"));
+    expectDegree(g.maximumDegree(), V1, 6U);
+
+    g.clear();
+    EXPECT_EQ(g.maximumDegree(), empty.maximumDegree());
+    EXPECT_EQ(g.minimumDegree(), empty.minimumDegree());
+}
+
 TEST_F(DirectedGraphTest, addVertexAlreadyExists)
 {
     const bool b1{g.addVertex(V1, "")};
@@ -993,3 +1166,328 @@ TEST_F(DirectedGraphTest, swapTest)
     EXPECT_TRUE(graph.hasEdge(E8));
     EXPECT_TRUE(graph.hasEdge(E9));
 }
+
+TEST_F(DirectedGraphTest, identityShouldBeRenewedWhenTheContentsAreReplaced)
+{
+    graph_type copy{g};
+    EXPECT_NE(copy.identity(), g.identity());
+    EXPECT_EQ(copy.version(), g.version());
+
+    const graph_type::identity_type before{copy.identity()};
+    ASSERT_TRUE(copy.addVertex(static_cast<Vertices>(100), "V100"));
+    EXPECT_EQ(copy.identity(), before);
+
+    copy = g;
+    EXPECT_NE(copy.identity(), before);
+    EXPECT_NE(copy.identity(), g.identity());
+
+    const graph_type::identity_type assigned{copy.identity()};
+    const graph_type::identity_type original{g.identity()};
+    swap(copy, g);
+    EXPECT_NE(copy.identity(), assigned);
+    EXPECT_NE(g.identity(), original);
+}
+
+TEST_F(DirectedGraphTest, lookupAfterRemoveEdge)
+{
+    ASSERT_TRUE(g.removeEdge(E2));
+
+    for (Edges edge : {E1, E3, E4, E5, E6, E7, E8, E9}) {
+        const tl::optional<const graph_type::edge_type&> opt{g.edge(edge)};
+        ASSERT_TRUE(opt.has_value());
+        EXPECT_EQ(opt->identifier(), edge);
+    }
+
+    EXPECT_FALSE(g.edge(E2).has_value());
+    EXPECT_TRUE(g.addEdge(E2, V1, V2, "edge 2"));
+    EXPECT_EQ(g.edge(E2)->data(), "edge 2");
+}
+
+TEST_F(DirectedGraphTest, lookupAfterRemoveVertex)
+{
+    ASSERT_TRUE(g.removeVertex(V2));
+
+    for (Vertices vertex : {V1, V3, V4, V5}) {
+        const tl::optional<const graph_type::vertex_type&> opt{
+            g.vertex(vertex)};
+        ASSERT_TRUE(opt.has_value());
+        EXPECT_EQ(opt->identifier(), vertex);
+    }
+
+    for (Edges edge : {E1, E5, E6, E8, E9}) {
+        const tl::optional<const graph_type::edge_type&> opt{g.edge(edge)};
+        ASSERT_TRUE(opt.has_value());
+        EXPECT_EQ(opt->identifier(), edge);
+    }
+
+    EXPECT_FALSE(g.vertex(V2).has_value());
+    EXPECT_TRUE(g.addVertex(V2, "vertex 2"));
+    EXPECT_TRUE(g.hasVertex(V2));
+}
+
+TEST_F(DirectedGraphTest, adjacencyAfterRemoveEdge)
+{
+    ASSERT_TRUE(g.removeEdge(E3));
+    ASSERT_TRUE(g.removeEdge(E7));
+
+    const std::vector<Edges> out2{E4}, in1{E1, E8}, in2{E2}, out5{E8, E9};
+
+    EXPECT_TRUE(hasIdentifiers(g.outboundEdges(V2), out2));
+    EXPECT_TRUE(hasIdentifiers(g.inboundEdges(V1), in1));
+    EXPECT_TRUE(hasIdentifiers(g.inboundEdges(V2), in2));
+    EXPECT_TRUE(hasIdentifiers(g.outboundEdges(V5), out5));
+
+    ASSERT_TRUE(g.addEdge(E3, V2, V1, "edge 3"));
+
+    const std::vector<Edges> newOut2{E4, E3};
+
+    EXPECT_TRUE(hasIdentifiers(g.outboundEdges(V2), newOut2));
+}
+
+TEST_F(DirectedGraphTest, adjacencyAfterRemoveVertex)
+{
+    ASSERT_TRUE(g.removeVertex(V1));
+
+    const std::vector<Edges> out2{E4}, in2{E7}, out5{E7, E9}, in5{E6, E9};
+
+    EXPECT_TRUE(g.outboundEdges(V1).empty());
+    EXPECT_TRUE(g.inboundEdges(V1).empty());
+    EXPECT_TRUE(hasIdentifiers(g.outboundEdges(V2), out2));
+    EXPECT_TRUE(hasIdentifiers(g.inboundEdges(V2), in2));
+    EXPECT_TRUE(hasIdentifiers(g.outboundEdges(V5), out5));
+    EXPECT_TRUE(hasIdentifiers(g.inboundEdges(V5), in5));
+}
+
+TEST_F(DirectedGraphTest, removeEdgeKeepsReferencesValid)
+{
+    const graph_type::edge_type* const   e9{&*g.edge(E9)};
+    const graph_type::vertex_type* const v5{&*g.vertex(V5)};
+
+    ASSERT_TRUE(g.removeEdge(E2));
+    ASSERT_TRUE(g.removeVertex(V3));
+
+    EXPECT_EQ(&*g.edge(E9), e9);
+    EXPECT_EQ(&*g.vertex(V5), v5);
+    EXPECT_EQ(g.tombstoneCount(), 4U);
+}
+
+TEST_F(DirectedGraphTest, iterationSkipsTombstones)
+{
+    ASSERT_TRUE(g.removeEdge(E1));
+    ASSERT_TRUE(g.removeVertex(V3));
+
+    const std::vector<Vertices> vertices{V1, V2, V4, V5};
+    const std::vector<Edges>    edges{E2, E3, E6, E7, E8, E9};
+
+    EXPECT_EQ(identifiersOf(g.vertices()), vertices);
+    EXPECT_EQ(identifiersOf(g.edges()), edges);
+    EXPECT_EQ(g.vertices().size(), vertices.size());
+    EXPECT_EQ(g.edges().size(), edges.size());
+    EXPECT_EQ(g.vertexCount(), vertices.size());
+    EXPECT_EQ(g.edgeCount(), edges.size());
+}
+
+TEST_F(DirectedGraphTest, compact)
+{
+    ASSERT_TRUE(g.removeEdge(E1));
+    ASSERT_TRUE(g.removeVertex(V3));
+    ASSERT_NE(g.tombstoneCount(), 0U);
+
+    g.compact();
+
+    EXPECT_EQ(g.tombstoneCount(), 0U);
+
+    const std::vector<Vertices> vertices{V1, V2, V4, V5};
+    const std::vector<Edges>    edges{E2, E3, E6, E7, E8, E9};
+    EXPECT_EQ(identifiersOf(g.vertices()), vertices);
+    EXPECT_EQ(identifiersOf(g.edges()), edges);
+
+    // Removing E1 moved E8, the last inbound edge of V1, into its place.
+    const std::vector<Edges> out5{E7, E8, E9}, in1{E8, E3}, out4{E6};
+    EXPECT_EQ(identifiersOf(g.outboundEdgeRange(V5)), out5);
+    EXPECT_EQ(identifiersOf(g.inboundEdgeRange(V1)), in1);
+    EXPECT_EQ(identifiersOf(g.outboundEdgeRange(V4)), out4);
+    EXPECT_EQ(g.edge(E8)->target(), V1);
+    EXPECT_EQ(g.vertex(V4)->data(), "vertex 4");
+
+    EXPECT_EQ(g.maximumDegree().vertex, &*g.vertex(V5));
+    EXPECT_EQ(g.minimumDegree().vertex, &*g.vertex(V4));
+
+    ASSERT_TRUE(g.addEdge(E1, V4, V4, "edge 1"));
+    const std::vector<Edges> newOut4{E6, E1};
+    EXPECT_EQ(identifiersOf(g.outboundEdgeRange(V4)), newOut4);
+}
+
+TEST_F(DirectedGraphTest, automaticCompaction)
+{
+    EXPECT_EQ(g.compactionThreshold(), 1.0);
+
+    g.setCompactionThreshold(0.25);
+
+    ASSERT_TRUE(g.removeEdge(E1));
+    ASSERT_TRUE(g.removeEdge(E2));
+    EXPECT_EQ(g.tombstoneCount(), 2U);
+
+    // 3 of 9 edges are tombstones now, which exceeds a quarter.
+    ASSERT_TRUE(g.removeEdge(E3));
+    EXPECT_EQ(g.tombstoneCount(), 0U);
+
+    const std::vector<Edges> edges{E4, E5, E6, E7, E8, E9};
+    EXPECT_EQ(identifiersOf(g.edges()), edges);
+}
+
+TEST_F(DirectedGraphTest, denseVertexIndices)
+{
+    using index_type = graph_type::index_type;
+
+    // Checks that the endpoint indices of the outbound edges agree with the
+    // identifiers of their endpoints.
+    const auto expectConsistent = [this](index_type index) {
+        const graph_type::edge_range range{g.outboundEdgeRangeAt(index)};
+
+        for (auto it{range.begin()}; it != range.end(); ++it) {
+            const graph_type::EndpointIndices endpoints{g.endpointIndices(it)};
+            EXPECT_EQ(endpoints.source, index);
+            EXPECT_EQ(g.vertexAt(endpoints.source).identifier(), it->source());
+            EXPECT_EQ(g.vertexAt(endpoints.target).identifier(), it->target());
+        }
+    };
+
+    EXPECT_EQ(g.vertexIndexBound(), 5U);
+    EXPECT_FALSE(empty.vertexIndex(V1).has_value());
+    EXPECT_EQ(empty.vertexIndexBound(), 0U);
+
+    for (const auto& vertex : g.vertices()) {
+        const tl::optional<index_type> index{
+            g.vertexIndex(vertex.identifier())};
+        ASSERT_TRUE(index.has_value());
+        EXPECT_EQ(&g.vertexAt(*index), &vertex);
+        EXPECT_EQ(
+            identifiersOf(g.outboundEdgeRangeAt(*index)),
+            identifiersOf(g.outboundEdgeRange(vertex.identifier())));
+        EXPECT_EQ(
+            identifiersOf(g.inboundEdgeRangeAt(*index)),
+            identifiersOf(g.inboundEdgeRange(vertex.identifier())));
+        expectConsistent(*index);
+    }
+
+    // Removing a vertex keeps the other indices stable.
+    const index_type v5{*g.vertexIndex(V5)};
+    ASSERT_TRUE(g.removeVertex(V3));
+    EXPECT_FALSE(g.hasVertexAt(2));
+    EXPECT_EQ(g.vertexIndexBound(), 5U);
+    EXPECT_EQ(g.vertexIndex(V5), v5);
+
+    // Compacting renumbers them.
+    g.compact();
+    EXPECT_EQ(g.vertexIndexBound(), 4U);
+    EXPECT_EQ(g.vertexIndex(V5), index_type{3});
+
+    for (index_type index{0}; index < g.vertexIndexBound(); ++index) {
+        ASSERT_TRUE(g.hasVertexAt(index));
+        expectConsistent(index);
+    }
+}
+
+TEST(DirectedGraph, edgesBetweenShouldFindParallelEdges)
+{
+    for (const bool indexed : {false, true}) {
+        DirectedGraph<int, nullptr_t, int, nullptr_t> graph{};
+
+        if (indexed) { graph.enablePairIndex(); }
+
+        EXPECT_EQ(graph.hasPairIndex(), indexed);
+
+        for (int v{0}; v < 3; ++v) {
+            EXPECT_TRUE(graph.addVertex(v, nullptr));
+        }
+
+        EXPECT_TRUE(graph.addEdge(10, 0, 1, nullptr));
+        EXPECT_TRUE(graph.addEdge(11, 1, 0, nullptr));
+        EXPECT_TRUE(graph.addEdge(12, 0, 1, nullptr));
+        EXPECT_TRUE(graph.addEdge(13, 1, 2, nullptr));
+
+        const auto between = graph.edgesBetween(0, 1);
+        ASSERT_EQ(between.size(), 2U);
+        EXPECT_EQ(between[0]->identifier(), 10);
+        EXPECT_EQ(between[1]->identifier(), 12);
+        EXPECT_TRUE(graph.hasEdgeBetween(1, 0));
+        EXPECT_FALSE(graph.hasEdgeBetween(2, 1));
+        EXPECT_TRUE(graph.edgesBetween(0, 7).empty());
+
+        EXPECT_TRUE(graph.removeEdge(10));
+        ASSERT_EQ(graph.edgesBetween(0, 1).size(), 1U);
+        EXPECT_EQ(graph.edgesBetween(0, 1)[0]->identifier(), 12);
+
+        EXPECT_TRUE(graph.removeVertex(0));
+        graph.compact();
+        EXPECT_TRUE(graph.edgesBetween(1, 0).empty());
+        ASSERT_EQ(graph.edgesBetween(1, 2).size(), 1U);
+        EXPECT_EQ(graph.edgesBetween(1, 2)[0]->identifier(), 13);
+    }
+}
+
+TEST(DirectedGraph, removingEdgesShouldKeepTheAdjacencyListsConsistent)
+{
+    DirectedGraph<int, nullptr_t, int, nullptr_t> graph{};
+
+    for (int v{0}; v < 4; ++v) { EXPECT_TRUE(graph.addVertex(v, nullptr)); }
+
+    // Every ordered pair, self-loops included, so that removals hit the
+    // front, the middle and the back of the adjacency lists.
+    for (int e{0}; e < 16; ++e) {
+        EXPECT_TRUE(graph.addEdge(e, e / 4, e % 4, nullptr));
+    }
+
+    for (int e : {5, 0, 10, 15, 6, 3}) { EXPECT_TRUE(graph.removeEdge(e)); }
+
+    // Every vertex lists exactly the edges left that leave or enter it.
+    for (int v{0}; v < 4; ++v) {
+        std::vector<int> outbound{}, inbound{};
+
+        for (const auto& edge : graph.edges()) {
+            if (edge.source() == v) { outbound.push_back(edge.identifier()); }
+            if (edge.target() == v) { inbound.push_back(edge.identifier()); }
+        }
+
+        std::vector<int> actualOutbound{identifiersOf(
+            graph.outboundEdgeRange(v))};
+        std::vector<int> actualInbound{identifiersOf(
+            graph.inboundEdgeRange(v))};
+        std::sort(actualOutbound.begin(), actualOutbound.end());
+        std::sort(actualInbound.begin(), actualInbound.end());
+        EXPECT_EQ(actualOutbound, outbound);
+        EXPECT_EQ(actualInbound, inbound);
+    }
+
+    // The positions survive compaction and vertex removal.
+    graph.compact();
+    EXPECT_TRUE(graph.removeEdge(9));
+    EXPECT_TRUE(graph.removeVertex(2));
+    EXPECT_EQ(graph.edgeCount(), 5U);
+    EXPECT_EQ(graph.outboundDegree(0), 1U);
+    EXPECT_EQ(graph.inboundDegree(3), 1U);
+    EXPECT_EQ(graph.degree(1), 4U);
+}
+
+TEST(DirectedGraph, pairIndexShouldBeBuiltFromExistingEdges)
+{
+    DirectedGraph<int, nullptr_t, int, nullptr_t> graph{};
+    EXPECT_TRUE(graph.addVertex(1, nullptr));
+    EXPECT_TRUE(graph.addVertex(2, nullptr));
+    EXPECT_TRUE(graph.addEdge(1, 1, 2, nullptr));
+    EXPECT_TRUE(graph.addEdge(2, 1, 2, nullptr));
+
+    graph.enablePairIndex();
+    EXPECT_EQ(graph.edgeRangeBetween(1, 2).size(), 2U);
+    EXPECT_TRUE(graph.edgeRangeBetween(2, 1).empty());
+    EXPECT_TRUE(graph.edgeRangeBetween(1, 3).empty());
+
+    graph.clear();
+    EXPECT_TRUE(graph.hasPairIndex());
+    EXPECT_TRUE(graph.addVertex(1, nullptr));
+    EXPECT_TRUE(graph.edgeRangeBetween(1, 1).empty());
+
+    graph.disablePairIndex();
+    EXPECT_FALSE(graph.hasPairIndex());
+}
@@ -0,0 +1,248 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <directed_graph.hpp>
+#include <edge_storage.hpp>
+#include <execution>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+template<typename EdgeStorage>
+using storage_graph_type
+    = DirectedGraph<int, nullptr_t, string, int, EdgeStorage>;
+
+template<typename EdgePointer>
+vector<string> identifiersOf(const vector<EdgePointer>& edges)
+{
+    vector<string> result{};
+
+    for (const EdgePointer& edge : edges) {
+        result.push_back(edge->identifier());
+    }
+
+    return result;
+}
+
+template<typename Range>
+vector<string> identifiersIn(const Range& range)
+{
+    vector<string> result{};
+
+    for (const auto& edge : range) { result.push_back(edge.identifier()); }
+
+    return result;
+}
+} // namespace
+
+static_assert(
+    is_same<storage_graph_type<RowStorage>, DirectedGraph<int, nullptr_t, string, int>>::
+        value,
+    "RowStorage must be the default");
+static_assert(
+    is_same<
+        storage_graph_type<RowStorage>::edge_reference,
+        const storage_graph_type<RowStorage>::edge_type&>::value,
+    "");
+static_assert(
+    is_same<
+        storage_graph_type<RowStorage>::edge_pointer,
+        const storage_graph_type<RowStorage>::edge_type*>::value,
+    "");
+
+template<typename EdgeStorage>
+class EdgeStorageTest : public ::testing::Test {
+public:
+    using graph_type = storage_graph_type<EdgeStorage>;
+
+protected:
+    virtual void SetUp() override
+    {
+        for (int v{1}; v <= 4; ++v) { ASSERT_TRUE(graph.addVertex(v, nullptr)); }
+
+        ASSERT_TRUE(graph.addEdge("E1", 1, 2, 10));
+        ASSERT_TRUE(graph.addEdge("E2", 2, 3, 20));
+        ASSERT_TRUE(graph.addEdge("E3", 1, 3, 30));
+        ASSERT_TRUE(graph.addEdge("E4", 3, 3, 40));
+        ASSERT_TRUE(graph.addEdge("E5", 1, 2, 50));
+        ASSERT_TRUE(graph.addEdge("E6", 4, 1, 60));
+    }
+
+    graph_type graph;
+};
+
+using EdgeStorages = ::testing::Types<RowStorage, ColumnStorage>;
+TYPED_TEST_SUITE(EdgeStorageTest, EdgeStorages, );
+
+TYPED_TEST(EdgeStorageTest, shouldHandOutTheFieldsOfTheEdges)
+{
+    EXPECT_EQ(this->graph.edgeCount(), 6U);
+    EXPECT_FALSE(this->graph.addEdge("E1", 2, 1, 0));
+    EXPECT_FALSE(this->graph.addEdge("E7", 2, 5, 0));
+
+    const auto edge{this->graph.edge("E3")};
+    ASSERT_TRUE(edge.has_value());
+    EXPECT_EQ(edge->identifier(), "E3");
+    EXPECT_EQ(edge->source(), 1);
+    EXPECT_EQ(edge->target(), 3);
+    EXPECT_EQ(edge->data(), 30);
+    EXPECT_FALSE(this->graph.edge("E7").has_value());
+    EXPECT_EQ(this->graph.source("E6"), 4);
+    EXPECT_EQ(this->graph.target("E6"), 1);
+
+    EXPECT_EQ(this->graph.edges().size(), 6U);
+    EXPECT_EQ(
+        identifiersIn(this->graph.edges()),
+        (vector<string>{"E1", "E2", "E3", "E4", "E5", "E6"}));
+
+    int sum{0};
+
+    for (const auto& e : this->graph.edges()) { sum += e.data(); }
+
+    EXPECT_EQ(sum, 210);
+}
+
+TYPED_TEST(EdgeStorageTest, shouldAnswerAdjacencyQueries)
+{
+    EXPECT_EQ(
+        identifiersOf(this->graph.outboundEdges(1)),
+        (vector<string>{"E1", "E3", "E5"}));
+    EXPECT_EQ(
+        identifiersOf(this->graph.inboundEdges(3)),
+        (vector<string>{"E2", "E3", "E4"}));
+    EXPECT_EQ(this->graph.incidentEdges(3).size(), 3U);
+    EXPECT_EQ(
+        identifiersOf(this->graph.edgesBetween(1, 2)),
+        (vector<string>{"E1", "E5"}));
+    EXPECT_EQ(this->graph.adjacentVertices(1).size(), 3U);
+    EXPECT_EQ(this->graph.incidentVertices("E2").size(), 2U);
+    EXPECT_EQ(
+        identifiersIn(this->graph.incidentEdgeRange(3)),
+        (vector<string>{"E2", "E3", "E4"}));
+    EXPECT_EQ(this->graph.outboundDegree(1), 3U);
+    EXPECT_EQ(this->graph.degree(3), 4U);
+
+    this->graph.enablePairIndex();
+    EXPECT_EQ(
+        identifiersOf(this->graph.edgesBetween(1, 2)),
+        (vector<string>{"E1", "E5"}));
+    EXPECT_EQ(
+        identifiersIn(this->graph.edgeRangeBetween(1, 2)),
+        (vector<string>{"E1", "E5"}));
+    EXPECT_TRUE(this->graph.hasEdgeBetween(3, 3));
+    EXPECT_FALSE(this->graph.hasEdgeBetween(3, 1));
+
+    const auto outbounds{this->graph.outboundEdgeRange(1)};
+    ASSERT_EQ(outbounds.size(), 3U);
+    EXPECT_EQ(outbounds.begin()[2].identifier(), "E5");
+    EXPECT_EQ((outbounds.end() - 1)->data(), 50);
+    EXPECT_EQ(this->graph.edgeIndex("E5"), (outbounds.begin() + 2).slot());
+}
+
+TYPED_TEST(EdgeStorageTest, shouldFindEdges)
+{
+    const auto isLong = [](const auto& edge) { return edge.data() > 25; };
+
+    const vector<string> expected{"E3", "E4", "E5", "E6"};
+    EXPECT_EQ(identifiersOf(this->graph.findEdges(isLong)), expected);
+    EXPECT_EQ(
+        identifiersOf(
+            this->graph.findEdges(execution::par, isLong)),
+        expected);
+    EXPECT_EQ(identifiersIn(this->graph.findEdgeRange(isLong)), expected);
+}
+
+TYPED_TEST(EdgeStorageTest, shouldKeepTheEdgesThroughRemovalAndCompaction)
+{
+    EXPECT_TRUE(this->graph.removeEdge("E2"));
+    EXPECT_TRUE(this->graph.removeVertex(4));
+    EXPECT_FALSE(this->graph.hasEdge("E6"));
+    EXPECT_EQ(this->graph.edgeCount(), 4U);
+    EXPECT_EQ(this->graph.tombstoneCount(), 3U);
+    EXPECT_EQ(
+        identifiersIn(this->graph.edges()),
+        (vector<string>{"E1", "E3", "E4", "E5"}));
+
+    this->graph.compact();
+    EXPECT_EQ(this->graph.tombstoneCount(), 0U);
+    EXPECT_EQ(this->graph.edgeIndexBound(), 4U);
+    EXPECT_EQ(this->graph.edge("E5")->data(), 50);
+    EXPECT_EQ(this->graph.edgeIndex("E5"), 3U);
+    vector<string> inbounds{identifiersOf(this->graph.inboundEdges(3))};
+    sort(inbounds.begin(), inbounds.end());
+    EXPECT_EQ(inbounds, (vector<string>{"E3", "E4"}));
+
+    // Vertex 3 first, so that its loop becomes the first edge.
+    this->graph.reorderVertices({*this->graph.vertexIndex(3),
+                                 *this->graph.vertexIndex(1),
+                                 *this->graph.vertexIndex(2)});
+    EXPECT_EQ(
+        identifiersIn(this->graph.edges()),
+        (vector<string>{"E4", "E1", "E3", "E5"}));
+    EXPECT_EQ(this->graph.edge("E3")->target(), 3);
+    EXPECT_EQ(this->graph.edgeIndex("E4"), 0U);
+
+    this->graph.shrinkToFit();
+    EXPECT_EQ(this->graph.edge("E1")->data(), 10);
+}
+
+TYPED_TEST(EdgeStorageTest, shouldCopyMoveAndSwap)
+{
+    typename TestFixture::graph_type copy{this->graph};
+    EXPECT_TRUE(copy.removeEdge("E1"));
+    EXPECT_TRUE(this->graph.hasEdge("E1"));
+
+    typename TestFixture::graph_type other{};
+    other = this->graph;
+    EXPECT_EQ(identifiersIn(other.edges()), identifiersIn(this->graph.edges()));
+
+    swap(copy, other);
+    EXPECT_EQ(copy.edgeCount(), 6U);
+    EXPECT_EQ(other.edgeCount(), 5U);
+
+    const typename TestFixture::graph_type moved{std::move(copy)};
+    EXPECT_EQ(moved.edge("E4")->data(), 40);
+
+    other.clear();
+    EXPECT_FALSE(other.hasEdges());
+    EXPECT_TRUE(other.edges().empty());
+}
+
+TEST(ColumnStorageTest, shouldStoreTheFieldsAsColumns)
+{
+    using column_graph_type
+        = DirectedGraph<int, nullptr_t, int, nullptr_t, ColumnStorage>;
+
+    column_graph_type graph{};
+    constexpr int     edgeCount{64};
+
+    ASSERT_TRUE(graph.addVertex(0, nullptr));
+
+    for (int e{0}; e < edgeCount; ++e) {
+        ASSERT_TRUE(graph.addEdge(e, 0, 0, nullptr));
+    }
+
+    graph.shrinkToFit();
+
+    // A bit of liveness and the identifier, source and target columns. The
+    // tag type edge data takes no space.
+    EXPECT_EQ(
+        graph.memoryUsage().edges, (edgeCount / 8) + (3 * edgeCount * sizeof(int)));
+    EXPECT_EQ(graph.edge(42)->data(), nullptr);
+}
+
+TEST(ColumnStorageTest, shouldHandOutReferencesToBoolData)
+{
+    DirectedGraph<int, nullptr_t, int, bool, ColumnStorage> graph{};
+    ASSERT_TRUE(graph.addVertex(0, nullptr));
+    ASSERT_TRUE(graph.addEdge(1, 0, 0, true));
+    ASSERT_TRUE(graph.addEdge(2, 0, 0, false));
+
+    const bool& data{graph.edge(1)->data()};
+    EXPECT_TRUE(data);
+    EXPECT_FALSE(graph.edge(2)->data());
+}
@@ -1,10 +1,24 @@
 #include "gtest/gtest.h"
+#include <cstddef>
 #include <edge.hpp>
 #include <string>
 
 using namespace gp;
 using namespace std;
 
+namespace {
+struct Tag {
+};
+} // namespace
+
+// Tag types used as edge data take no space.
+static_assert(sizeof(Edge<int, nullptr_t, int>) == (3 * sizeof(int)), "");
+static_assert(sizeof(Edge<int, nullptr_t, char>) == (2 * sizeof(int)), "");
+static_assert(sizeof(Edge<int, Tag, int>) == (3 * sizeof(int)), "");
+static_assert(
+    sizeof(Edge<size_t, nullptr_t, size_t>) == (3 * sizeof(size_t)),
+    "");
+
 const Edge<string, int, string> e{"EDGE", "V1", "V2", 25};
 
 TEST(edge, identifier) { EXPECT_EQ(e.identifier(), string{"EDGE"}); }
@@ -56,4 +70,22 @@ TEST(edge, swap)
     EXPECT_EQ(e2.source(), string{"V1"});
     EXPECT_EQ(e2.target(), string{"V2"});
     EXPECT_EQ(e2.data(), 90);
-}
\ No newline at end of file
+}
+TEST(edge, tagData)
+{
+    Edge<int, nullptr_t, char> e1{1, 'A', 'B', nullptr};
+    Edge<int, nullptr_t, char> e2{2, 'B', 'C', nullptr};
+    EXPECT_TRUE(e1.data() == nullptr);
+
+    swap(e1, e2);
+    EXPECT_EQ(e1.identifier(), 2);
+    EXPECT_EQ(e1.source(), 'B');
+    EXPECT_EQ(e2.target(), 'B');
+    EXPECT_TRUE(e2.data() == nullptr);
+
+    const Edge<int, Tag, int> e3{3, 1, 2, Tag{}};
+    const Tag&                tag{e3.data()};
+    (void)tag;
+    EXPECT_EQ(e3.identifier(), 3);
+    EXPECT_EQ(e3.target(), 2);
+}
@@ -0,0 +1,54 @@
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <find_equal.hpp>
+#include <vector>
+
+using namespace gp;
+using namespace std;
+
+namespace {
+vector<uint32_t> findEqualScalar(const vector<uint32_t>& values, uint32_t value)
+{
+    vector<uint32_t> result{};
+
+    for (size_t i{0}; i < values.size(); ++i) {
+        if (values[i] == value) { result.push_back(static_cast<uint32_t>(i)); }
+    }
+
+    return result;
+}
+} // namespace
+
+TEST(findEqual, emptyTest)
+{
+    EXPECT_TRUE(findEqual({}, 1).empty());
+    EXPECT_EQ(countEqual({}, 1), 0U);
+}
+
+TEST(findEqual, shouldMatchScalarScan)
+{
+    // Covers whole blocks as well as the remaining elements for every block
+    // size.
+    for (uint32_t size{0}; size < 40; ++size) {
+        vector<uint32_t> values(size);
+
+        for (uint32_t i{0}; i < size; ++i) { values[i] = (i * 7) % 5; }
+
+        for (uint32_t value{0}; value < 6; ++value) {
+            const vector<uint32_t> expected{findEqualScalar(values, value)};
+            EXPECT_EQ(findEqual(values, value), expected);
+            EXPECT_EQ(countEqual(values, value), expected.size());
+        }
+    }
+}
+
+TEST(findEqual, shouldCompareAllBits)
+{
+    const vector<uint32_t> values{
+        UINT32_MAX, 0, UINT32_MAX - 1, 0x80000000, 0x7FFFFFFF, UINT32_MAX};
+
+    EXPECT_EQ(findEqual(values, UINT32_MAX), (vector<uint32_t>{0, 5}));
+    EXPECT_EQ(findEqual(values, 0x80000000), (vector<uint32_t>{3}));
+    EXPECT_EQ(countEqual(values, 0x7FFFFFFF), 1U);
+}
@@ -2,6 +2,7 @@
 #include <array>
 #include <fleury/is_bridge.hpp>
 #include <fleury/is_bridge_test_graph.hpp>
+#include <masked_graph.hpp>
 
 using namespace gp;
 
@@ -50,3 +51,23 @@ TEST_F(IsBridgeTest, bridgeTest)
     EXPECT_EQ(expected(8), fleury::isBridge(graph, -8));
     EXPECT_EQ(expected(9), fleury::isBridge(graph, -9));
 }
+
+TEST_F(IsBridgeTest, shouldLeaveMaskedGraphUnchanged)
+{
+    MaskedGraph view{graph};
+
+    for (int edge{1}; edge <= 9; ++edge) {
+        EXPECT_EQ(expected(edge), fleury::isBridge(view, edge));
+        EXPECT_EQ(expected(edge), fleury::isBridge(view, -edge));
+    }
+
+    EXPECT_EQ(view.edgeCount(), graph.edgeCount());
+
+    // Without edge 6 (and its reverse) edge 8 becomes a bridge.
+    EXPECT_FALSE(fleury::isBridge(view, 8));
+    EXPECT_TRUE(view.hideEdge(6));
+    EXPECT_TRUE(view.hideEdge(-6));
+    EXPECT_TRUE(fleury::isBridge(view, 8));
+    EXPECT_TRUE(view.isEdgeHidden(6));
+    EXPECT_FALSE(view.isEdgeHidden(8));
+}
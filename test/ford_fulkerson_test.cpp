@@ -1,4 +1,7 @@
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <compact_graph.hpp>
+#include <cstdint>
 #include <ford_fulkerson/algorithm.hpp>
 #include <ford_fulkerson/create_graph.hpp>
 
@@ -30,16 +33,93 @@ TEST_F(FordFulkersonTest, basicTest)
     const std::int32_t expectedMaximumFlow{23};
     using K = ford_fulkerson::VertexPair<vertex_identifier>;
     const std::unordered_map<K, std::int32_t> expectedFlow{
-        {K{0, 0}, 0},   {K{0, 1}, 12},  {K{0, 2}, 11},  {K{0, 3}, 0},
-        {K{0, 4}, 0},   {K{0, 5}, 0},   {K{1, 0}, -12}, {K{1, 1}, 0},
-        {K{1, 2}, 0},   {K{1, 3}, 12},  {K{1, 4}, 0},   {K{1, 5}, 0},
-        {K{2, 0}, -11}, {K{2, 1}, 0},   {K{2, 2}, 0},   {K{2, 3}, 0},
-        {K{2, 4}, 11},  {K{2, 5}, 0},   {K{3, 0}, 0},   {K{3, 1}, -12},
-        {K{3, 2}, 0},   {K{3, 3}, 0},   {K{3, 4}, -7},  {K{3, 5}, 19},
-        {K{4, 0}, 0},   {K{4, 1}, 0},   {K{4, 2}, -11}, {K{4, 3}, 7},
-        {K{4, 4}, 0},   {K{4, 5}, 4},   {K{5, 0}, 0},   {K{5, 1}, 0},
-        {K{5, 2}, 0},   {K{5, 3}, -19}, {K{5, 4}, -4},  {K{5, 5}, 0}};
+        {K{0, 1}, 12},  {K{1, 0}, -12}, {K{0, 2}, 11}, {K{2, 0}, -11},
+        {K{1, 2}, 0},   {K{2, 1}, 0},   {K{1, 3}, 12}, {K{3, 1}, -12},
+        {K{2, 3}, 0},   {K{3, 2}, 0},   {K{2, 4}, 11}, {K{4, 2}, -11},
+        {K{3, 4}, -7},  {K{4, 3}, 7},   {K{3, 5}, 19}, {K{5, 3}, -19},
+        {K{4, 5}, 4},   {K{5, 4}, -4}};
 
     EXPECT_EQ(expectedMaximumFlow, result.maxFlow);
     EXPECT_EQ(expectedFlow, result.flow);
 }
+
+TEST_F(FordFulkersonTest, shouldUseThePairIndex)
+{
+    graph_type indexed{graph};
+    indexed.enablePairIndex();
+
+    const ford_fulkerson::Result expected{
+        ford_fulkerson::algorithm(graph, 0, 5)};
+    const ford_fulkerson::Result actual{
+        ford_fulkerson::algorithm(indexed, 0, 5)};
+
+    EXPECT_EQ(actual.maxFlow, expected.maxFlow);
+    EXPECT_EQ(actual.flow, expected.flow);
+    EXPECT_EQ(actual.flowBetween(3, 5), 19);
+    EXPECT_EQ(actual.flowBetween(5, 3), -19);
+    EXPECT_EQ(actual.flowBetween(0, 5), 0);
+}
+
+TEST_F(FordFulkersonTest, shouldHandleParallelAndOpposingEdges)
+{
+    graph_type g{};
+
+    for (int v{0}; v < 3; ++v) { EXPECT_TRUE(g.addVertex(v, nullptr)); }
+
+    EXPECT_TRUE(g.addEdge(0, 0, 1, edge_data{5}));
+    EXPECT_TRUE(g.addEdge(1, 0, 1, edge_data{3}));
+    EXPECT_TRUE(g.addEdge(2, 1, 0, edge_data{2}));
+    EXPECT_TRUE(g.addEdge(3, 1, 2, edge_data{10}));
+
+    const ford_fulkerson::Result result{ford_fulkerson::algorithm(g, 0, 2)};
+
+    // Parallel edges add up their capacities.
+    EXPECT_EQ(result.maxFlow, 8);
+    EXPECT_EQ(result.flowBetween(0, 1), 8);
+    EXPECT_EQ(result.flowBetween(1, 0), -8);
+    EXPECT_EQ(result.flowBetween(1, 2), 8);
+    EXPECT_EQ(result.flow.size(), 4U);
+
+    g.enablePairIndex();
+    EXPECT_EQ(ford_fulkerson::algorithm(g, 0, 2).flow, result.flow);
+
+    const CompactGraph compactGraph{g};
+    const ford_fulkerson::Result compact{
+        ford_fulkerson::algorithm(compactGraph, 0, 2)};
+    EXPECT_EQ(compact.maxFlow, 8);
+    EXPECT_EQ(compact.flow, result.flow);
+}
+
+TEST_F(FordFulkersonTest, shouldPairTheEdgesOfAHub)
+{
+    // Vertex 0 is a hub with two-way edges to every other vertex, which all
+    // lead on to the sink.
+    constexpr int leaves{50};
+    constexpr int sink{leaves + 1};
+    graph_type    g{};
+    int           edge{0};
+    std::int32_t  expectedMaxFlow{0};
+
+    for (int v{0}; v <= sink; ++v) { EXPECT_TRUE(g.addVertex(v, nullptr)); }
+
+    for (int leaf{1}; leaf <= leaves; ++leaf) {
+        EXPECT_TRUE(g.addEdge(edge++, 0, leaf, edge_data{leaf}));
+        EXPECT_TRUE(g.addEdge(edge++, leaf, 0, edge_data{1}));
+        EXPECT_TRUE(g.addEdge(edge++, leaf, sink, edge_data{leaf % 7}));
+        expectedMaxFlow += std::min(leaf, leaf % 7);
+    }
+
+    const ford_fulkerson::Result result{
+        ford_fulkerson::algorithm(g, 0, sink)};
+
+    EXPECT_EQ(result.maxFlow, expectedMaxFlow);
+    EXPECT_EQ(result.flowBetween(0, 10), 3);
+    EXPECT_EQ(result.flowBetween(10, 0), -3);
+    EXPECT_EQ(result.flow.size(), 4U * leaves);
+
+    const CompactGraph compactGraph{g};
+    const ford_fulkerson::Result compact{
+        ford_fulkerson::algorithm(compactGraph, 0, sink)};
+    EXPECT_EQ(compact.maxFlow, expectedMaxFlow);
+    EXPECT_EQ(compact.flow, result.flow);
+}
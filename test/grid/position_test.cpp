@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include <functional>
 #include <grid/position.hpp>
 #include <pl/size_t.hpp>
 #include <sstream>
@@ -32,3 +33,10 @@ TEST_F(PositionTest, printTest)
     EXPECT_EQ(
         oss.str(), "{\"column\": {\"value\": 5},\"row\": {\"value\": 7}}");
 }
+
+TEST_F(PositionTest, hashTest)
+{
+    const std::hash<Position> hasher{};
+
+    EXPECT_EQ(hasher(position), hasher(Position{Column{5}, Row{7}}));
+}
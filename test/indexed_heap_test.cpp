@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/indexed_heap.hpp>
+#include <dijkstra/sorted_queue.hpp>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+TEST(IndexedHeap, shouldPopInOrderOfPriority)
+{
+    dijkstra::IndexedHeap<uint32_t> heap{8, pmr::get_default_resource()};
+    EXPECT_TRUE(heap.empty());
+
+    heap.push(3, 30);
+    heap.push(5, 10);
+    heap.push(1, 20);
+    heap.push(7, 40);
+    EXPECT_EQ(heap.size(), 4U);
+    EXPECT_TRUE(heap.contains(7));
+    EXPECT_FALSE(heap.contains(0));
+
+    heap.decreaseKey(7, 5);
+
+    vector<uint32_t> order{};
+
+    while (not heap.empty()) { order.push_back(heap.pop().vertex()); }
+
+    EXPECT_EQ(order, (vector<uint32_t>{7, 5, 1, 3}));
+    EXPECT_FALSE(heap.contains(7));
+}
+
+TEST(IndexedHeap, shouldMatchTheSortedQueue)
+{
+    constexpr uint32_t indexBound{1000};
+    mt19937            engine{7};
+    uniform_int_distribution<size_t>   priorities{0, 10000};
+    uniform_int_distribution<uint32_t> vertices{0, indexBound - 1};
+
+    dijkstra::IndexedHeap<uint32_t, 3> heap{
+        indexBound, pmr::get_default_resource()};
+    dijkstra::SortedQueue<uint32_t> sorted{
+        indexBound, pmr::get_default_resource()};
+    vector<size_t> priority(indexBound, SIZE_MAX);
+
+    for (int step{0}; step < 20000; ++step) {
+        const uint32_t vertex{vertices(engine)};
+
+        if ((step % 3) == 0) {
+            if (heap.empty()) { continue; }
+
+            EXPECT_EQ(heap.pop().vertex(), sorted.pop().vertex());
+            continue;
+        }
+
+        ASSERT_EQ(heap.contains(vertex), sorted.contains(vertex));
+
+        // The priorities are unique, so that both pop the same vertex.
+        if (not heap.contains(vertex)) {
+            priority[vertex] = (priorities(engine) * indexBound) + vertex;
+            heap.push(vertex, priority[vertex]);
+            sorted.push(vertex, priority[vertex]);
+        }
+        else if (priority[vertex] >= indexBound) {
+            priority[vertex]
+                = ((priority[vertex] / indexBound / 2) * indexBound) + vertex;
+            heap.decreaseKey(vertex, priority[vertex]);
+            sorted.decreaseKey(vertex, priority[vertex]);
+        }
+
+        ASSERT_EQ(heap.size(), sorted.size());
+    }
+}
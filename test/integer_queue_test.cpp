@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/bucket_queue.hpp>
+#include <dijkstra/radix_heap.hpp>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+/*!
+ * \brief Feeds a queue the monotone priorities Dijkstra's algorithm produces
+ *        and checks that it always pops a lowest priority.
+ **/
+template<typename Queue>
+void expectToPopTheLowestPriorities(Queue& queue, size_t maxLength)
+{
+    constexpr uint32_t indexBound{1000};
+    mt19937            engine{11};
+    uniform_int_distribution<size_t>   lengths{0, maxLength};
+    uniform_int_distribution<uint32_t> vertices{0, indexBound - 1};
+
+    // The priorities of the vertices queued, SIZE_MAX for the others.
+    vector<size_t> priority(indexBound, SIZE_MAX);
+    size_t         last{0};
+
+    const auto popAndCheck = [&] {
+        const dijkstra::VertexWithPriority<uint32_t> popped{queue.pop()};
+        ASSERT_EQ(popped.priority(), priority[popped.vertex()]);
+        ASSERT_EQ(
+            popped.priority(), *min_element(priority.begin(), priority.end()));
+        priority[popped.vertex()] = SIZE_MAX;
+        last                      = popped.priority();
+    };
+
+    for (int step{0}; step < 20000; ++step) {
+        const uint32_t vertex{vertices(engine)};
+
+        if ((step % 3) == 0) {
+            if (not queue.empty()) { popAndCheck(); }
+
+            continue;
+        }
+
+        ASSERT_EQ(queue.contains(vertex), priority[vertex] != SIZE_MAX);
+
+        const size_t alt{last + lengths(engine)};
+
+        if (not queue.contains(vertex)) {
+            priority[vertex] = alt;
+            queue.push(vertex, alt);
+        }
+        else if (alt < priority[vertex]) {
+            priority[vertex] = alt;
+            queue.decreaseKey(vertex, alt);
+        }
+    }
+
+    while (not queue.empty()) { popAndCheck(); }
+
+    EXPECT_EQ(*min_element(priority.begin(), priority.end()), SIZE_MAX);
+}
+} // anonymous namespace
+
+TEST(BucketQueue, shouldPopInOrderOfPriority)
+{
+    dijkstra::BucketQueue<uint32_t> queue{8, 10, pmr::get_default_resource()};
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(3, 10);
+    queue.push(5, 4);
+    queue.push(1, 7);
+    queue.push(7, 9);
+    EXPECT_EQ(queue.size(), 4U);
+    EXPECT_TRUE(queue.contains(7));
+    EXPECT_FALSE(queue.contains(0));
+
+    queue.decreaseKey(7, 2);
+
+    vector<uint32_t> order{};
+
+    while (not queue.empty()) { order.push_back(queue.pop().vertex()); }
+
+    EXPECT_EQ(order, (vector<uint32_t>{7, 5, 1, 3}));
+    EXPECT_FALSE(queue.contains(7));
+}
+
+TEST(BucketQueue, shouldPopTheLowestPriorities)
+{
+    constexpr size_t                maxLength{37};
+    dijkstra::BucketQueue<uint32_t> queue{
+        1000, maxLength, pmr::get_default_resource()};
+    expectToPopTheLowestPriorities(queue, maxLength);
+}
+
+TEST(BucketQueue, shouldRejectAWindowThatCantBeCounted)
+{
+    EXPECT_THROW(
+        (dijkstra::BucketQueue<uint32_t>{
+            10, SIZE_MAX, pmr::get_default_resource()}),
+        length_error);
+}
+
+TEST(RadixHeap, shouldComputeTheBitWidth)
+{
+    EXPECT_EQ(dijkstra::detail::bitWidth(0), 0U);
+    EXPECT_EQ(dijkstra::detail::bitWidth(1), 1U);
+    EXPECT_EQ(dijkstra::detail::bitWidth(2), 2U);
+    EXPECT_EQ(dijkstra::detail::bitWidth(255), 8U);
+    EXPECT_EQ(dijkstra::detail::bitWidth(256), 9U);
+    EXPECT_EQ(dijkstra::detail::bitWidth(UINT64_MAX), 64U);
+}
+
+TEST(RadixHeap, shouldPopInOrderOfPriority)
+{
+    dijkstra::RadixHeap<uint32_t> heap{8, pmr::get_default_resource()};
+    EXPECT_TRUE(heap.empty());
+
+    heap.push(3, 3000);
+    heap.push(5, 40);
+    heap.push(1, 700);
+    heap.push(7, 1U << 20U);
+    EXPECT_EQ(heap.size(), 4U);
+
+    heap.decreaseKey(7, 2);
+
+    vector<uint32_t> order{};
+
+    while (not heap.empty()) { order.push_back(heap.pop().vertex()); }
+
+    EXPECT_EQ(order, (vector<uint32_t>{7, 5, 1, 3}));
+    EXPECT_FALSE(heap.contains(7));
+}
+
+TEST(RadixHeap, shouldPopTheLowestPriorities)
+{
+    dijkstra::RadixHeap<uint32_t> heap{1000, pmr::get_default_resource()};
+    expectToPopTheLowestPriorities(heap, 1000000);
+}
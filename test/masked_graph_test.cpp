@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <directed_graph.hpp>
+#include <masked_graph.hpp>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using graph_type = DirectedGraph<string, int, int, nullptr_t>;
+using view_type  = MaskedGraph<string, int, int, nullptr_t>;
+
+graph_type createGraph()
+{
+    graph_type graph{};
+    EXPECT_TRUE(graph.addVertex("A", 1));
+    EXPECT_TRUE(graph.addVertex("B", 2));
+    EXPECT_TRUE(graph.addVertex("C", 3));
+    EXPECT_TRUE(graph.addEdge(1, "A", "B", nullptr));
+    EXPECT_TRUE(graph.addEdge(2, "A", "C", nullptr));
+    EXPECT_TRUE(graph.addEdge(3, "B", "C", nullptr));
+    EXPECT_TRUE(graph.addEdge(4, "C", "A", nullptr));
+    EXPECT_TRUE(graph.addEdge(5, "C", "C", nullptr));
+    return graph;
+}
+
+vector<int> identifiers(const view_type::edge_range& range)
+{
+    vector<int> result{};
+
+    for (const auto& edge : range) { result.push_back(edge.identifier()); }
+
+    return result;
+}
+} // namespace
+
+TEST(MaskedGraph, shouldShowEverythingByDefault)
+{
+    const graph_type graph{createGraph()};
+    const view_type  view{graph};
+
+    EXPECT_EQ(&view.graph(), &graph);
+    EXPECT_EQ(view.vertexCount(), 3U);
+    EXPECT_EQ(view.edgeCount(), 5U);
+    EXPECT_TRUE(view.hasVertex("B"));
+    EXPECT_TRUE(view.hasEdge(3));
+    EXPECT_FALSE(view.hasEdge(6));
+    EXPECT_EQ(identifiers(view.outboundEdgeRange("A")), (vector<int>{1, 2}));
+    EXPECT_EQ(identifiers(view.inboundEdgeRange("C")), (vector<int>{2, 3, 5}));
+}
+
+TEST(MaskedGraph, shouldHideEdges)
+{
+    const graph_type graph{createGraph()};
+    view_type        view{graph};
+
+    EXPECT_TRUE(view.hideEdge(1));
+    EXPECT_FALSE(view.hideEdge(1));
+    EXPECT_FALSE(view.hideEdge(6));
+    EXPECT_TRUE(view.isEdgeHidden(1));
+    EXPECT_FALSE(view.hasEdge(1));
+    EXPECT_EQ(view.edgeCount(), 4U);
+    EXPECT_EQ(identifiers(view.outboundEdgeRange("A")), vector<int>{2});
+    EXPECT_TRUE(view.inboundEdgeRange("B").empty());
+
+    // The graph itself is left alone.
+    EXPECT_TRUE(graph.hasEdge(1));
+    EXPECT_EQ(graph.outboundDegree("A"), 2U);
+
+    EXPECT_TRUE(view.unhideEdge(1));
+    EXPECT_FALSE(view.unhideEdge(1));
+    EXPECT_EQ(view.edgeCount(), 5U);
+    EXPECT_EQ(identifiers(view.outboundEdgeRange("A")), (vector<int>{1, 2}));
+}
+
+TEST(MaskedGraph, shouldHideIncidentEdgesOfHiddenVertices)
+{
+    const graph_type graph{createGraph()};
+    view_type        view{graph};
+
+    EXPECT_TRUE(view.hideEdge(3));
+    EXPECT_TRUE(view.hideVertex("C"));
+    EXPECT_FALSE(view.hideVertex("C"));
+    EXPECT_TRUE(view.isVertexHidden("C"));
+    EXPECT_FALSE(view.hasVertex("C"));
+    EXPECT_EQ(view.vertexCount(), 2U);
+    EXPECT_EQ(view.edgeCount(), 1U);
+    EXPECT_FALSE(view.hasEdge(2));
+    EXPECT_FALSE(view.hasVertexAt(*view.vertexIndex("C")));
+    EXPECT_EQ(identifiers(view.outboundEdgeRange("A")), vector<int>{1});
+    EXPECT_TRUE(view.outboundEdgeRange("C").empty());
+
+    // Hidden edges stay hidden when their endpoint is unhidden.
+    EXPECT_TRUE(view.unhideVertex("C"));
+    EXPECT_EQ(view.edgeCount(), 4U);
+    EXPECT_FALSE(view.hasEdge(3));
+    EXPECT_EQ(identifiers(view.inboundEdgeRange("C")), (vector<int>{2, 5}));
+
+    EXPECT_TRUE(view.hideVertex("A"));
+    view.unhideAll();
+    EXPECT_EQ(view.vertexCount(), 3U);
+    EXPECT_EQ(view.edgeCount(), 5U);
+    EXPECT_TRUE(view.hasEdge(3));
+}
+
+TEST(MaskedGraph, shouldProvideEndpointIndices)
+{
+    const graph_type graph{createGraph()};
+    view_type        view{graph};
+    EXPECT_TRUE(view.hideEdge(2));
+
+    const view_type::edge_range outbounds{
+        view.outboundEdgeRangeAt(*view.vertexIndex("A"))};
+    ASSERT_EQ(outbounds.size(), 1U);
+
+    const view_type::EndpointIndices endpoints{
+        view.endpointIndices(outbounds.begin())};
+    EXPECT_EQ(endpoints.source, *view.vertexIndex("A"));
+    EXPECT_EQ(endpoints.target, *view.vertexIndex("B"));
+    EXPECT_EQ(view.vertexAt(endpoints.target).data(), 2);
+}
@@ -0,0 +1,253 @@
+#include "gtest/gtest.h"
+#include <a_star/algorithm.hpp>
+#include <bellman_ford/algorithm.hpp>
+#include <compact_graph.hpp>
+#include <cstddef>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <ford_fulkerson/algorithm.hpp>
+#include <ford_fulkerson/create_graph.hpp>
+#include <length_edge_data.hpp>
+#include <memory_resource>
+#include <nm/create_graph.hpp>
+#include <nm/identifiers.hpp>
+#include <romania/city.hpp>
+#include <romania/create_graph.hpp>
+#include <romania/heuristic.hpp>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+// Counts the allocations passed on to an upstream memory resource.
+class CountingResource : public pmr::memory_resource {
+public:
+    explicit CountingResource(
+        pmr::memory_resource* upstream = pmr::new_delete_resource())
+        : m_upstream{upstream}, m_allocations{0}
+    {
+    }
+
+    size_t allocations() const noexcept { return m_allocations; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++m_allocations;
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        m_upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    pmr::memory_resource* m_upstream;
+    size_t                m_allocations;
+};
+
+// Makes every allocation from the default memory resource fail while it is
+// alive.
+class NoDefaultResource {
+public:
+    NoDefaultResource()
+        : m_previous{pmr::set_default_resource(pmr::null_memory_resource())}
+    {
+    }
+
+    NoDefaultResource(const NoDefaultResource&) = delete;
+    NoDefaultResource& operator=(const NoDefaultResource&) = delete;
+
+    ~NoDefaultResource() { (void)pmr::set_default_resource(m_previous); }
+
+private:
+    pmr::memory_resource* m_previous;
+};
+
+using graph_type = DirectedGraph<string, int, int, string>;
+
+void fill(graph_type& graph)
+{
+    EXPECT_TRUE(graph.addVertex("A", 1));
+    EXPECT_TRUE(graph.addVertex("B", 2));
+    EXPECT_TRUE(graph.addVertex("C", 3));
+    EXPECT_TRUE(graph.addEdge(1, "A", "B", "A->B"));
+    EXPECT_TRUE(graph.addEdge(2, "B", "C", "B->C"));
+    EXPECT_TRUE(graph.addEdge(3, "C", "A", "C->A"));
+}
+
+const auto edgeLength
+    = [](const auto& edge) { return edge.data().edgeLength(); };
+} // namespace
+
+TEST(MemoryResource, directedGraphShouldAllocateFromGivenResource)
+{
+    CountingResource resource{};
+    graph_type       graph{&resource};
+    EXPECT_EQ(graph.resource(), &resource);
+
+    {
+        const NoDefaultResource noDefaultResource{};
+
+        fill(graph);
+        EXPECT_TRUE(graph.removeVertex("B"));
+        graph.compact();
+
+        const graph_type copy{graph, &resource};
+        EXPECT_EQ(copy.resource(), &resource);
+        EXPECT_EQ(copy.vertexCount(), 2U);
+        EXPECT_EQ(copy.edgeCount(), 1U);
+        EXPECT_EQ(copy.outboundDegree("C"), 1U);
+    }
+
+    EXPECT_GT(resource.allocations(), 0U);
+    EXPECT_EQ(graph_type{}.resource(), pmr::get_default_resource());
+}
+
+TEST(MemoryResource, pairIndexShouldBeCopiedIntoTheGivenResource)
+{
+    CountingResource resource{};
+    graph_type       graph{&resource};
+    fill(graph);
+    graph.enablePairIndex();
+
+    CountingResource            defaultResource{};
+    pmr::memory_resource* const previous{
+        pmr::set_default_resource(&defaultResource)};
+
+    const graph_type copy{graph, &resource};
+    graph_type       assigned{&resource};
+    assigned = graph;
+    assigned = graph_type{graph, &resource};
+
+    (void)pmr::set_default_resource(previous);
+
+    EXPECT_EQ(defaultResource.allocations(), 0U);
+    EXPECT_TRUE(copy.hasPairIndex());
+    EXPECT_TRUE(copy.hasEdgeBetween("A", "B"));
+    EXPECT_TRUE(assigned.hasEdgeBetween("C", "A"));
+    EXPECT_FALSE(assigned.hasEdgeBetween("B", "A"));
+}
+
+TEST(MemoryResource, journalShouldBeCopiedIntoTheGivenResource)
+{
+    CountingResource resource{};
+    graph_type       graph{&resource};
+    graph.enableJournal(16);
+    fill(graph);
+
+    CountingResource            defaultResource{};
+    pmr::memory_resource* const previous{
+        pmr::set_default_resource(&defaultResource)};
+
+    const graph_type copy{graph, &resource};
+    graph_type       assigned{&resource};
+    assigned = graph;
+    assigned = graph_type{graph, &resource};
+
+    (void)pmr::set_default_resource(previous);
+
+    EXPECT_EQ(defaultResource.allocations(), 0U);
+    ASSERT_TRUE(copy.journal().has_value());
+    EXPECT_EQ(copy.journal()->version(), 6U);
+    EXPECT_EQ(assigned.journal()->changesSince(0)->size(), 6U);
+}
+
+TEST(MemoryResource, directedGraphsShouldSwapAcrossResources)
+{
+    CountingResource resource{};
+    graph_type       arenaGraph{&resource};
+    graph_type       graph{};
+    fill(graph);
+
+    arenaGraph.swap(graph);
+
+    EXPECT_EQ(arenaGraph.resource(), &resource);
+    EXPECT_EQ(graph.resource(), pmr::get_default_resource());
+    EXPECT_FALSE(graph.hasVertices());
+    EXPECT_EQ(arenaGraph.vertexCount(), 3U);
+    EXPECT_EQ(arenaGraph.degree("B"), 2U);
+    EXPECT_EQ(arenaGraph.edge(2)->data(), "B->C");
+    EXPECT_GT(resource.allocations(), 0U);
+}
+
+TEST(MemoryResource, algorithmsShouldRunInArena)
+{
+    using C = romania::City;
+
+    const auto romaniaGraph{romania::createGraph()};
+    const auto nmGraph{nm::createGraph()};
+    const auto flowGraph{ford_fulkerson::createGraph()};
+    const CompactGraph compactGraph{romaniaGraph};
+    const auto         isGoal = [](C city) { return city == C::Bucharest; };
+
+    const auto expectedDijkstra{
+        dijkstra::algorithm(romaniaGraph, C::Arad, edgeLength)};
+    const auto expectedBellmanFord{
+        bellman_ford::algorithm(nmGraph, string{nm::start}, edgeLength)};
+    const ford_fulkerson::Result expectedFlow{
+        ford_fulkerson::algorithm(flowGraph, 0, 5)};
+    const a_star::Path<C> expectedPath{a_star::algorithm(
+        romaniaGraph, {C::Arad}, isGoal, &romania::heuristic)};
+
+    CountingResource               upstream{};
+    pmr::monotonic_buffer_resource arena{&upstream};
+
+    for (int query{0}; query < 3; ++query) {
+        {
+            const NoDefaultResource noDefaultResource{};
+
+            const auto dijkstraResult{dijkstra::algorithm(
+                romaniaGraph, C::Arad, edgeLength, &arena)};
+            const auto compactResult{dijkstra::algorithm(
+                compactGraph, C::Arad, edgeLength, &arena)};
+            EXPECT_EQ(dijkstraResult.resource(), &arena);
+
+            for (const auto& vertex : romaniaGraph.vertices()) {
+                EXPECT_EQ(
+                    dijkstraResult.distanceTo(vertex.identifier()),
+                    expectedDijkstra.distanceTo(vertex.identifier()));
+                EXPECT_EQ(
+                    compactResult.shortestPathTo(vertex.identifier()),
+                    expectedDijkstra.shortestPathTo(vertex.identifier()));
+            }
+
+            const auto bellmanFordResult{bellman_ford::algorithm(
+                nmGraph, string{nm::start}, edgeLength, &arena)};
+            EXPECT_EQ(bellmanFordResult.resource(), &arena);
+
+            for (const auto& vertex : nmGraph.vertices()) {
+                EXPECT_EQ(
+                    bellmanFordResult.distanceTo(vertex.identifier()),
+                    expectedBellmanFord.distanceTo(vertex.identifier()));
+            }
+
+            const ford_fulkerson::Result flow{
+                ford_fulkerson::algorithm(flowGraph, 0, 5, &arena)};
+            EXPECT_EQ(flow.maxFlow, expectedFlow.maxFlow);
+            EXPECT_EQ(flow.flow, expectedFlow.flow);
+
+            const a_star::Path<C> path{a_star::algorithm(
+                romaniaGraph,
+                {C::Arad},
+                isGoal,
+                &romania::heuristic,
+                true,
+                &arena)};
+            EXPECT_EQ(path.get_allocator().resource(), &arena);
+            EXPECT_EQ(path.rawPath(), expectedPath.rawPath());
+        }
+
+        // Everything allocated by the queries is gone at once.
+        arena.release();
+    }
+
+    EXPECT_GT(upstream.allocations(), 0U);
+}
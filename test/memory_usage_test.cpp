@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include <compact_graph.hpp>
+#include <cstddef>
+#include <directed_graph.hpp>
+#include <ford_fulkerson/algorithm.hpp>
+#include <ford_fulkerson/create_graph.hpp>
+#include <memory_usage.hpp>
+#include <shortest_paths.hpp>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using graph_type = DirectedGraph<int, nullptr_t, int, nullptr_t>;
+
+graph_type createGraph(int vertexCount)
+{
+    graph_type graph{};
+
+    for (int i{0}; i < vertexCount; ++i) {
+        EXPECT_TRUE(graph.addVertex(i, nullptr));
+    }
+
+    for (int i{0}; i < vertexCount; ++i) {
+        EXPECT_TRUE(graph.addEdge(i, i, (i + 1) % vertexCount, nullptr));
+    }
+
+    return graph;
+}
+} // namespace
+
+TEST(MemoryUsage, shouldSumTheParts)
+{
+    MemoryUsage usage{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(usage.total(), 21U);
+    EXPECT_EQ(usage.heap(), 20U);
+
+    usage += MemoryUsage{1, 1, 1, 1, 1, 1};
+    EXPECT_EQ(usage.total(), 27U);
+}
+
+TEST(MemoryUsage, emptyDirectedGraphShouldOnlyHoldItself)
+{
+    const graph_type  graph{};
+    const MemoryUsage usage{graph.memoryUsage()};
+
+    EXPECT_EQ(usage.object, sizeof(graph_type));
+    EXPECT_EQ(usage.vertices, 0U);
+    EXPECT_EQ(usage.edges, 0U);
+    EXPECT_EQ(usage.indices, 0U);
+    EXPECT_EQ(usage.slack, 0U);
+}
+
+TEST(MemoryUsage, directedGraphShouldAccountForItsElements)
+{
+    const graph_type  graph{createGraph(100)};
+    const MemoryUsage usage{graph.memoryUsage()};
+
+    EXPECT_EQ(
+        usage.vertices, 100U * sizeof(tl::optional<graph_type::vertex_type>));
+    EXPECT_EQ(
+        usage.edges, 100U * sizeof(tl::optional<graph_type::edge_type>));
+    EXPECT_GT(usage.indices, 0U);
+    EXPECT_GT(usage.buckets, 0U);
+}
+
+TEST(MemoryUsage, shrinkToFitShouldReclaimTheSlack)
+{
+    graph_type graph{createGraph(100)};
+    EXPECT_GT(graph.memoryUsage().slack, 0U);
+
+    const MemoryUsage before{graph.memoryUsage()};
+    graph.shrinkToFit();
+    const MemoryUsage after{graph.memoryUsage()};
+
+    EXPECT_EQ(after.slack, 0U);
+    EXPECT_EQ(after.vertices, before.vertices);
+    EXPECT_EQ(after.edges, before.edges);
+    EXPECT_EQ(after.indices, before.indices);
+    EXPECT_LT(after.total(), before.total());
+    EXPECT_EQ(graph.edgeCount(), 100U);
+    EXPECT_EQ(graph.outboundDegree(7), 1U);
+}
+
+TEST(MemoryUsage, journalShouldCountAsIndices)
+{
+    graph_type        graph{createGraph(10)};
+    const MemoryUsage before{graph.memoryUsage()};
+    graph.enableJournal(64);
+
+    EXPECT_GT(graph.memoryUsage().slack, before.slack);
+    EXPECT_EQ(graph.memoryUsage().object, before.object);
+}
+
+TEST(MemoryUsage, compactGraphShouldAccountForItsColumns)
+{
+    const CompactGraph<int, int, nullptr_t> graph{createGraph(10)};
+    const MemoryUsage                       usage{graph.memoryUsage()};
+
+    EXPECT_EQ(usage.vertices, 10U * sizeof(int));
+    EXPECT_GE(usage.edges, 10U * (2U * sizeof(uint32_t) + sizeof(int)));
+    EXPECT_GE(usage.indices, 11U * sizeof(uint32_t));
+}
+
+TEST(MemoryUsage, resultsShouldAccountForTheirHashMaps)
+{
+    ShortestPaths<int, int>::prev_map_type prev{};
+    ShortestPaths<int, int>::dist_map_type dist{};
+    prev[0] = tl::nullopt;
+    dist[0] = 0;
+    const ShortestPaths<int, int> paths{0, move(prev), move(dist)};
+
+    EXPECT_GT(paths.memoryUsage().vertices, 0U);
+    EXPECT_GT(paths.memoryUsage().buckets, 0U);
+
+    const auto flow{
+        ford_fulkerson::algorithm(ford_fulkerson::createGraph(), 0, 5)};
+    EXPECT_GE(
+        flow.memoryUsage().edges,
+        flow.flow.size() * sizeof(decltype(flow.flow)::value_type));
+}
@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <directed_graph.hpp>
+#include <mutation_journal.hpp>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using graph_type    = DirectedGraph<string, nullptr_t, int, nullptr_t>;
+using mutation_type = graph_type::journal_type::Mutation;
+
+vector<MutationKind> kindsOf(const vector<mutation_type>& mutations)
+{
+    vector<MutationKind> result{};
+
+    for (const mutation_type& mutation : mutations) {
+        result.push_back(mutation.kind);
+    }
+
+    return result;
+}
+} // namespace
+
+TEST(MutationJournal, shouldBeDisabledByDefault)
+{
+    graph_type graph{};
+    EXPECT_FALSE(graph.journal().has_value());
+    EXPECT_TRUE(graph.addVertex("A", nullptr));
+    EXPECT_FALSE(graph.journal().has_value());
+}
+
+TEST(MutationJournal, shouldRecordMutations)
+{
+    graph_type graph{};
+    EXPECT_TRUE(graph.addVertex("A", nullptr));
+    graph.enableJournal(16);
+    ASSERT_TRUE(graph.journal().has_value());
+
+    // The journal starts at the version of the graph.
+    EXPECT_EQ(graph.journal()->version(), 1U);
+
+    EXPECT_TRUE(graph.addVertex("B", nullptr));
+    EXPECT_TRUE(graph.addEdge(1, "A", "B", nullptr));
+    EXPECT_TRUE(graph.addEdge(2, "B", "A", nullptr));
+    EXPECT_FALSE(graph.addEdge(2, "B", "A", nullptr));
+    EXPECT_TRUE(graph.removeEdge(1));
+    EXPECT_TRUE(graph.removeVertex("A"));
+
+    EXPECT_EQ(graph.journal()->version(), 7U);
+    EXPECT_EQ(graph.journal()->size(), 6U);
+
+    const auto all{graph.journal()->changesSince(1)};
+    ASSERT_TRUE(all.has_value());
+    EXPECT_EQ(
+        kindsOf(*all),
+        (vector<MutationKind>{MutationKind::AddVertex,
+                              MutationKind::AddEdge,
+                              MutationKind::AddEdge,
+                              MutationKind::RemoveEdge,
+                              MutationKind::RemoveEdge,
+                              MutationKind::RemoveVertex}));
+    EXPECT_EQ((*all)[0].vertex, string{"B"});
+    EXPECT_FALSE((*all)[0].edge.has_value());
+    EXPECT_EQ((*all)[3].edge, 1);
+    EXPECT_EQ((*all)[4].edge, 2);
+    EXPECT_EQ((*all)[5].vertex, string{"A"});
+
+    for (size_t i{0}; i < all->size(); ++i) {
+        EXPECT_EQ((*all)[i].version, i + 2U);
+    }
+
+    const auto latest{graph.journal()->changesSince(5)};
+    ASSERT_TRUE(latest.has_value());
+    ASSERT_EQ(latest->size(), 2U);
+    EXPECT_EQ((*latest)[0].version, 6U);
+    EXPECT_TRUE(graph.journal()->changesSince(7)->empty());
+}
+
+TEST(MutationJournal, shouldOverwriteTheOldestRecords)
+{
+    graph_type graph{};
+    graph.enableJournal(3);
+
+    for (int i{0}; i < 5; ++i) {
+        EXPECT_TRUE(graph.addVertex(to_string(i), nullptr));
+    }
+
+    EXPECT_EQ(graph.journal()->version(), 5U);
+    EXPECT_EQ(graph.journal()->size(), 3U);
+    EXPECT_EQ(graph.journal()->oldestVersion(), 2U);
+    EXPECT_FALSE(graph.journal()->changesSince(1).has_value());
+
+    const auto changes{graph.journal()->changesSince(2)};
+    ASSERT_TRUE(changes.has_value());
+    ASSERT_EQ(changes->size(), 3U);
+    EXPECT_EQ((*changes)[0].vertex, string{"2"});
+    EXPECT_EQ((*changes)[2].vertex, string{"4"});
+}
+
+TEST(MutationJournal, shouldRecordClear)
+{
+    graph_type graph{};
+    EXPECT_TRUE(graph.addVertex("A", nullptr));
+    EXPECT_TRUE(graph.addEdge(1, "A", "A", nullptr));
+    graph.enableJournal(8);
+    const graph_type::version_type before{graph.version()};
+    graph.clear();
+
+    const auto changes{graph.journal()->changesSince(before)};
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_EQ(
+        kindsOf(*changes),
+        (vector<MutationKind>{MutationKind::RemoveEdge,
+                              MutationKind::RemoveVertex}));
+}
+
+TEST(MutationJournal, shouldKeepTheVersionWhenReenabled)
+{
+    graph_type graph{};
+    graph.enableJournal(8);
+    EXPECT_TRUE(graph.addVertex("A", nullptr));
+    graph.enableJournal(4);
+
+    EXPECT_EQ(graph.journal()->version(), 1U);
+    EXPECT_EQ(graph.journal()->capacity(), 4U);
+    EXPECT_FALSE(graph.journal()->changesSince(0).has_value());
+
+    graph.disableJournal();
+    EXPECT_FALSE(graph.journal().has_value());
+}
+
+TEST(MutationJournal, shouldKeepCountingWhileDisabled)
+{
+    graph_type graph{};
+    graph.enableJournal(8);
+    EXPECT_TRUE(graph.addVertex("A", nullptr));
+    const graph_type::version_type seen{graph.journal()->version()};
+
+    graph.disableJournal();
+    EXPECT_TRUE(graph.addVertex("B", nullptr));
+    EXPECT_TRUE(graph.addEdge(1, "A", "B", nullptr));
+    EXPECT_EQ(graph.version(), 3U);
+
+    graph.enableJournal(8);
+    EXPECT_EQ(graph.journal()->version(), 3U);
+    EXPECT_GE(graph.journal()->version(), seen);
+
+    // The consumer missed the mutations made while disabled.
+    EXPECT_FALSE(graph.journal()->changesSince(seen).has_value());
+
+    graph.clear();
+    EXPECT_EQ(graph.version(), 6U);
+    EXPECT_EQ(graph.journal()->version(), graph.version());
+}
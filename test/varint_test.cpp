@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <varint.hpp>
+#include <vector>
+
+using namespace std;
+using namespace gp;
+
+TEST(varint, zigZagShouldInterleaveTheSigns)
+{
+    EXPECT_EQ(zigZagEncode(0), 0U);
+    EXPECT_EQ(zigZagEncode(-1), 1U);
+    EXPECT_EQ(zigZagEncode(1), 2U);
+    EXPECT_EQ(zigZagEncode(-2), 3U);
+    EXPECT_EQ(zigZagEncode(INT64_MIN), UINT64_MAX);
+
+    for (int64_t value : {int64_t{0}, int64_t{-7}, int64_t{42}, INT64_MAX}) {
+        EXPECT_EQ(zigZagDecode(zigZagEncode(value)), value);
+    }
+}
+
+TEST(varint, shouldUseOneByteForSmallValues)
+{
+    vector<uint8_t> buffer{};
+    encodeVarint(buffer, 127);
+    EXPECT_EQ(buffer, (vector<uint8_t>{0x7F}));
+
+    buffer.clear();
+    encodeVarint(buffer, 300);
+    EXPECT_EQ(buffer, (vector<uint8_t>{0xAC, 0x02}));
+}
+
+TEST(varint, shouldRoundTrip)
+{
+    const vector<uint64_t> values{
+        0, 1, 127, 128, 16383, 16384, UINT32_MAX, UINT64_MAX};
+    vector<uint8_t> buffer{};
+
+    for (uint64_t value : values) { encodeVarint(buffer, value); }
+
+    EXPECT_EQ(buffer.size(), 1U + 1U + 1U + 2U + 2U + 3U + 5U + 10U);
+
+    const uint8_t* position{buffer.data()};
+
+    for (uint64_t value : values) { EXPECT_EQ(decodeVarint(position), value); }
+
+    EXPECT_EQ(position, buffer.data() + buffer.size());
+}
@@ -0,0 +1,201 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <compact_graph.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <dijkstra/algorithm.hpp>
+#include <directed_graph.hpp>
+#include <romania/city.hpp>
+#include <romania/create_graph.hpp>
+#include <vector>
+#include <vertex_order.hpp>
+
+using namespace std;
+using namespace gp;
+
+namespace {
+using graph_type = DirectedGraph<int, int, int, nullptr_t>;
+
+// A path 0 - 1 - ... - (vertexCount - 1) with the vertices inserted in a
+// scrambled order and edges in both directions.
+graph_type createPath(int vertexCount)
+{
+    graph_type graph{};
+
+    for (int i{0}; i < vertexCount; ++i) {
+        const int vertex{(i * 13) % vertexCount};
+        EXPECT_TRUE(graph.addVertex(vertex, vertex * 10));
+    }
+
+    for (int i{0}; i + 1 < vertexCount; ++i) {
+        EXPECT_TRUE(graph.addEdge(2 * i, i, i + 1, nullptr));
+        EXPECT_TRUE(graph.addEdge((2 * i) + 1, i + 1, i, nullptr));
+    }
+
+    return graph;
+}
+
+// The largest distance between the indices of the endpoints of an edge.
+size_t bandwidth(const graph_type& graph)
+{
+    size_t result{0};
+
+    for (const auto& edge : graph.edges()) {
+        const size_t source{*graph.vertexIndex(edge.source())};
+        const size_t target{*graph.vertexIndex(edge.target())};
+        result = max(result, max(source, target) - min(source, target));
+    }
+
+    return result;
+}
+
+bool isPermutation(const VertexPermutation& permutation, size_t size)
+{
+    vector<uint32_t> sorted{permutation.order};
+    sort(sorted.begin(), sorted.end());
+
+    for (size_t i{0}; i < sorted.size(); ++i) {
+        if (sorted[i] != i) { return false; }
+    }
+
+    for (uint32_t i{0}; i < permutation.order.size(); ++i) {
+        if (permutation.newIndex(permutation.oldIndex(i)) != i) {
+            return false;
+        }
+    }
+
+    return sorted.size() == size;
+}
+} // namespace
+
+TEST(VertexOrder, shouldComputePermutations)
+{
+    const graph_type graph{createPath(7)};
+
+    for (VertexOrder order : {VertexOrder::BreadthFirst,
+                              VertexOrder::ReverseCuthillMcKee,
+                              VertexOrder::DegreeDescending}) {
+        EXPECT_TRUE(isPermutation(vertexPermutation(graph, order), 7U));
+    }
+}
+
+TEST(VertexOrder, breadthFirstShouldStartFromTheFirstVertex)
+{
+    const graph_type        graph{createPath(7)};
+    const VertexPermutation permutation{
+        vertexPermutation(graph, VertexOrder::BreadthFirst)};
+
+    // Vertex 0 comes first and its only neighbour, vertex 1, next.
+    EXPECT_EQ(graph.vertexAt(permutation.oldIndex(0)).identifier(), 0);
+    EXPECT_EQ(graph.vertexAt(permutation.oldIndex(1)).identifier(), 1);
+}
+
+TEST(VertexOrder, reverseCuthillMcKeeShouldMinimizeTheBandwidthOfAPath)
+{
+    graph_type graph{createPath(10)};
+    EXPECT_GT(bandwidth(graph), 1U);
+
+    (void)reorder(graph, VertexOrder::ReverseCuthillMcKee);
+    EXPECT_EQ(bandwidth(graph), 1U);
+}
+
+TEST(VertexOrder, degreeDescendingShouldPutTheHubFirst)
+{
+    graph_type graph{};
+
+    for (int i{0}; i < 5; ++i) { EXPECT_TRUE(graph.addVertex(i, i)); }
+
+    for (int i{0}; i < 4; ++i) {
+        EXPECT_TRUE(graph.addEdge(i, i, 4, nullptr));
+    }
+
+    const VertexPermutation permutation{
+        reorder(graph, VertexOrder::DegreeDescending)};
+    EXPECT_EQ(permutation.newIndex(4), 0U);
+    EXPECT_EQ(graph.vertexAt(0).identifier(), 4);
+    EXPECT_EQ(graph.vertexIndex(0), 1U);
+}
+
+TEST(VertexOrder, reorderShouldKeepTheGraph)
+{
+    graph_type graph{createPath(9)};
+    const auto removed{graph.vertexIndex(3)};
+    EXPECT_TRUE(graph.removeVertex(3));
+    graph.enablePairIndex();
+    const graph_type copy{graph};
+
+    const VertexPermutation permutation{
+        reorder(graph, VertexOrder::ReverseCuthillMcKee)};
+
+    EXPECT_EQ(permutation.position.size(), copy.vertexIndexBound());
+    EXPECT_EQ(permutation.position[*removed], VertexPermutation::npos);
+    EXPECT_EQ(graph.tombstoneCount(), 0U);
+    EXPECT_EQ(graph.vertexCount(), copy.vertexCount());
+    EXPECT_EQ(graph.edgeCount(), copy.edgeCount());
+
+    for (const auto& vertex : copy.vertices()) {
+        const auto oldIndex{copy.vertexIndex(vertex.identifier())};
+        const auto newIndex{graph.vertexIndex(vertex.identifier())};
+        ASSERT_TRUE(newIndex.has_value());
+        EXPECT_EQ(permutation.newIndex(*oldIndex), *newIndex);
+        EXPECT_EQ(graph.vertexAt(*newIndex).data(), vertex.data());
+        EXPECT_EQ(
+            graph.inboundDegree(vertex.identifier()),
+            copy.inboundDegree(vertex.identifier()));
+        EXPECT_EQ(
+            graph.outboundDegree(vertex.identifier()),
+            copy.outboundDegree(vertex.identifier()));
+    }
+
+    for (const auto& edge : copy.edges()) {
+        const auto index{graph.edgeIndex(edge.identifier())};
+        ASSERT_TRUE(index.has_value());
+        const auto endpoints{graph.endpointIndicesAt(*index)};
+        EXPECT_EQ(
+            graph.vertexAt(endpoints.source).identifier(), edge.source());
+        EXPECT_EQ(
+            graph.vertexAt(endpoints.target).identifier(), edge.target());
+        EXPECT_TRUE(graph.hasEdgeBetween(edge.source(), edge.target()));
+    }
+}
+
+TEST(VertexOrder, dijkstraShouldMatchAfterReordering)
+{
+    const auto romaniaGraph{romania::createGraph()};
+    auto       reordered{romaniaGraph};
+    const auto lengthOf = [](const auto& edge) {
+        return edge.data().edgeLength();
+    };
+
+    (void)reorder(reordered, VertexOrder::BreadthFirst);
+    const auto expected{
+        dijkstra::algorithm(romaniaGraph, romania::City::Arad, lengthOf)};
+    const auto actual{
+        dijkstra::algorithm(reordered, romania::City::Arad, lengthOf)};
+
+    for (const auto& vertex : romaniaGraph.vertices()) {
+        EXPECT_EQ(
+            actual.distanceTo(vertex.identifier()),
+            expected.distanceTo(vertex.identifier()));
+    }
+}
+
+TEST(VertexOrder, compactGraphShouldStoreTheVerticesInOrder)
+{
+    const graph_type        graph{createPath(6)};
+    const VertexPermutation permutation{
+        vertexPermutation(graph, VertexOrder::ReverseCuthillMcKee)};
+    const CompactGraph<int, int, nullptr_t> compact{graph, permutation.order};
+
+    ASSERT_EQ(compact.vertexCount(), 6U);
+    ASSERT_EQ(compact.edgeCount(), 10U);
+
+    for (uint32_t i{0}; i < compact.vertexCount(); ++i) {
+        EXPECT_EQ(
+            compact.identifier(i),
+            graph.vertexAt(permutation.oldIndex(i)).identifier());
+        EXPECT_EQ(
+            compact.outboundDegree(i),
+            graph.outboundDegree(compact.identifier(i)));
+    }
+}
@@ -6,6 +6,17 @@
 using namespace std;
 using namespace gp;
 
+namespace {
+struct Tag {
+};
+} // namespace
+
+// Tag types used as vertex data take no space.
+static_assert(sizeof(Vertex<string, nullptr_t>) == sizeof(string), "");
+static_assert(sizeof(Vertex<int, nullptr_t>) == sizeof(int), "");
+static_assert(sizeof(Vertex<int, Tag>) == sizeof(int), "");
+static_assert(sizeof(Vertex<int, int>) == (2 * sizeof(int)), "");
+
 TEST(vertex, identifier)
 {
     const Vertex<string, nullptr_t> v{"MyVertex", nullptr};
@@ -53,3 +64,19 @@ TEST(vertex, swap)
     EXPECT_EQ(v2.identifier(), 0);
     EXPECT_EQ(v2.data(), 1);
 }
+
+TEST(vertex, tagData)
+{
+    Vertex<string, nullptr_t> v1{"A", nullptr};
+    Vertex<string, nullptr_t> v2{"B", nullptr};
+    EXPECT_TRUE(v1.data() == nullptr);
+
+    swap(v1, v2);
+    EXPECT_EQ(v1.identifier(), string{"B"});
+    EXPECT_EQ(v2.identifier(), string{"A"});
+
+    const Vertex<int, Tag> v3{3, Tag{}};
+    const Tag&             tag{v3.data()};
+    (void)tag;
+    EXPECT_EQ(v3.identifier(), 3);
+}
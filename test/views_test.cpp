@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <pl/meta/remove_cvref.hpp>
+#include <string>
+#include <vector>
+#include <views.hpp>
+
+using namespace gp;
+using namespace std;
+
+template<typename Range>
+inline auto toVector(const Range& range)
+{
+    vector<pl::meta::remove_cvref_t<decltype(*range.begin())>> result{};
+
+    for (const auto& element : range) { result.push_back(element); }
+
+    return result;
+}
+
+TEST(views, slotRange)
+{
+    const vector<string>              elements{"a", "b", "c", "d"};
+    const vector<size_t>              slots{3, 0, 2};
+    const views::SlotIterator<string> first{elements.data(), slots.data()};
+    const views::SlotIterator<string> last{
+        elements.data(), slots.data() + slots.size()};
+    const views::Range<views::SlotIterator<string>> range{first, last};
+
+    const vector<string> expected{"d", "a", "c"};
+    EXPECT_EQ(toVector(range), expected);
+    EXPECT_EQ(range.size(), 3U);
+    EXPECT_EQ(range.front(), "d");
+    EXPECT_EQ(first[2], "c");
+    EXPECT_EQ(first->size(), 1U);
+}
+
+TEST(views, filter)
+{
+    const vector<int> data{1, 2, 3, 4, 5, 6};
+    const vector<int> expected{2, 4, 6};
+
+    EXPECT_EQ(
+        toVector(views::filter(data, [](int i) { return i % 2 == 0; })),
+        expected);
+    EXPECT_TRUE(views::filter(data, [](int i) { return i > 6; }).empty());
+}
+
+TEST(views, transform)
+{
+    const vector<int> data{1, 2, 3};
+    const vector<int> expected{2, 4, 6};
+
+    EXPECT_EQ(
+        toVector(views::transform(data, [](int i) { return i * 2; })),
+        expected);
+}
+
+TEST(views, concat)
+{
+    const vector<int> first{1, 2};
+    const vector<int> second{3};
+    const vector<int> none{};
+
+    const vector<int> expected{1, 2, 3};
+    EXPECT_EQ(toVector(views::concat(first, second)), expected);
+    EXPECT_EQ(toVector(views::concat(none, second)), second);
+    EXPECT_EQ(toVector(views::concat(first, none)), first);
+    EXPECT_TRUE(views::concat(none, none).empty());
+}
+
+TEST(views, iteratorsShouldBeAssignable)
+{
+    const vector<int> data{1, 2, 3, 4};
+    const auto        range{views::filter(data, [](int i) { return i > 1; })};
+
+    auto it = range.begin();
+    it      = range.end();
+    EXPECT_EQ(it, range.end());
+}